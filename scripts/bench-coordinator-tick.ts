@@ -0,0 +1,164 @@
+/**
+ * Seshat Swarm — Coordinator Tick Benchmark
+ *
+ * Times Coordinator.tick() on a large simulated swarm flying the real
+ * catalog's sim-gazebo patterns. Each tick, a share of the drones report
+ * telemetry (moving enough to make and break ε links), a few trip a
+ * low-battery forced exit, and role reassignment runs every 10 ticks:
+ * the blast radius, the solver and role assignment all see work.
+ *
+ * Commands go to a no-op transport so only coordinator time is measured.
+ *
+ * Usage:
+ *   npx tsx scripts/bench-coordinator-tick.ts [--drones 1000] [--ticks 300]
+ */
+
+import { join } from 'node:path';
+import { Coordinator } from '../src/coordinator/main.js';
+import type { DroneComms, DroneTelemetry, TelemetryCallback } from '../src/coordinator/comms.js';
+import { loadCatalog } from '../src/catalog/lookup.js';
+import type { SensorState, Vec3 } from '../src/types/dimensions.js';
+
+// ---------------------------------------------------------------------------
+// Workload
+// ---------------------------------------------------------------------------
+
+const HOVER = 'hover-autonomous-performer-bare.sim-gazebo';
+const DENSITY = 0.02;           // drones per m³, ~8 within a 5 m range
+const SLAB_DEPTH_M = 10;
+const REPORTING_SHARE = 0.2;    // drones reporting per tick
+const STEP_M = 1.0;             // per report, so links churn
+const FORCED_EXITS_PER_TICK = 5;
+
+/** Deterministic LCG so runs are comparable. */
+function makeRng(seed: number): () => number {
+  let state = seed >>> 0;
+  return () => {
+    state = (Math.imul(state, 1664525) + 1013904223) >>> 0;
+    return state / 2 ** 32;
+  };
+}
+
+function sensorState(position: Vec3, battery: number): SensorState {
+  return {
+    position,
+    velocity: { x: 0, y: 0, z: 0 },
+    orientation: { x: 0, y: 0, z: 0 },
+    angular_velocity: { x: 0, y: 0, z: 0 },
+    battery: { voltage: 3.7, percentage: battery, discharge_rate: 2.5, estimated_remaining: 0 },
+    position_quality: 0.95,
+    wind_estimate: { x: 0, y: 0, z: 0 },
+  };
+}
+
+/** Transport that swallows commands and lets the bench inject telemetry. */
+class NullComms implements DroneComms {
+  private telemetry: TelemetryCallback = () => {};
+  async sendCommand(): Promise<void> {}
+  onTelemetry(callback: TelemetryCallback): void { this.telemetry = callback; }
+  onEvent(): void {}
+  async ackEvent(): Promise<void> {}
+  async connect(): Promise<void> {}
+  async disconnect(): Promise<void> {}
+  deliver(telemetry: DroneTelemetry): void { this.telemetry(telemetry); }
+}
+
+// ---------------------------------------------------------------------------
+// Measurement
+// ---------------------------------------------------------------------------
+
+export interface TickBenchResult {
+  drones: number;
+  ticks: number;
+  meanMs: number;
+  p99Ms: number;
+}
+
+export function benchCoordinatorTick(drones: number, ticks: number, catalogDir: string): TickBenchResult {
+  const rng = makeRng(drones);
+  const comms = new NullComms();
+  const coord = new Coordinator(comms, loadCatalog(catalogDir), { roleReassignmentInterval: 10 });
+  const side = Math.sqrt(drones / (DENSITY * SLAB_DEPTH_M));
+  const ids: string[] = [];
+
+  for (let i = 0; i < drones; i++) {
+    const id = `d${i}`;
+    ids.push(id);
+    coord.registerDrone(id, 'sim-gazebo', 'bare', HOVER, sensorState({
+      x: rng() * side, y: rng() * side, z: 1 + rng() * SLAB_DEPTH_M,
+    }, 0.5 + rng() * 0.5));
+  }
+  coord.tick(); // Settle registration-time links
+
+  const times: number[] = [];
+  for (let t = 0; t < ticks; t++) {
+    for (let i = 0; i < drones * REPORTING_SHARE; i++) {
+      const id = ids[Math.floor(rng() * drones)]!;
+      const drone = coord.world.getDrone(id)!;
+      const p = drone.lastTelemetry.position;
+      comms.deliver({
+        droneId: id,
+        currentPatternId: 0,
+        statusFlags: 0,
+        state: sensorState({
+          x: p.x + (rng() - 0.5) * STEP_M,
+          y: p.y + (rng() - 0.5) * STEP_M,
+          z: p.z + (rng() - 0.5) * STEP_M,
+        }, drone.lastTelemetry.battery.percentage),
+      });
+    }
+    for (let i = 0; i < FORCED_EXITS_PER_TICK; i++) {
+      const id = ids[Math.floor(rng() * drones)]!;
+      const drone = coord.world.getDrone(id)!;
+      coord.world.updatePattern(id, HOVER, 'hover', 'autonomous', drone.coordinate.chi, 'shared-corridor');
+      coord.world.updateTelemetry(id, sensorState(drone.lastTelemetry.position, 0.05));
+    }
+
+    const start = performance.now();
+    coord.tick();
+    times.push(performance.now() - start);
+
+    // Recharge whoever landed so the swarm stays in the air
+    for (const drone of coord.world.drones.values()) {
+      if (drone.lastTelemetry.battery.percentage < 0.1) {
+        coord.world.updateTelemetry(drone.id, sensorState(drone.lastTelemetry.position, 0.9));
+      }
+    }
+  }
+
+  times.sort((a, b) => a - b);
+  return {
+    drones,
+    ticks,
+    meanMs: times.reduce((sum, x) => sum + x, 0) / ticks,
+    p99Ms: times[Math.min(ticks - 1, Math.floor(ticks * 0.99))]!,
+  };
+}
+
+// ---------------------------------------------------------------------------
+// CLI Entry Point
+// ---------------------------------------------------------------------------
+
+const isDirectRun = process.argv[1]?.endsWith('bench-coordinator-tick.ts') ||
+                    process.argv[1]?.endsWith('bench-coordinator-tick.js');
+
+if (isDirectRun) {
+  const args = process.argv.slice(2);
+  let drones = 1000;
+  let ticks = 300;
+  let catalogDir = join(import.meta.dirname ?? '.', '..', 'catalog');
+
+  for (let i = 0; i < args.length; i++) {
+    const arg = args[i]!;
+    if (arg === '--drones') drones = Number(args[++i]);
+    else if (arg === '--ticks') ticks = Number(args[++i]);
+    else if (arg === '--catalog') catalogDir = args[++i]!;
+  }
+  if (!(drones > 0) || !(ticks > 0)) {
+    console.error('Usage: bench-coordinator-tick.ts [--drones N] [--ticks T] [--catalog DIR]');
+    process.exit(1);
+  }
+
+  const r = benchCoordinatorTick(drones, ticks, catalogDir);
+  console.log(`${r.drones} drones, ${r.ticks} ticks: mean ${r.meanMs.toFixed(3)} ms, p99 ${r.p99Ms.toFixed(3)} ms`);
+}
@@ -0,0 +1,148 @@
+/**
+ * Seshat Swarm — filterByCore Benchmark
+ *
+ * Times the solver's three partial-core queries (hardware match, hover
+ * fallback, emergency fallback) against synthetic catalogs of 1,500 to
+ * 15,000 patterns, answered by the bitmap core index and by the full
+ * scan it replaced.
+ *
+ * Synthetic patterns are copies of the real catalog's patterns with core
+ * dimensions drawn at random, so every value of every dimension occurs.
+ *
+ * Usage:
+ *   npx tsx scripts/bench-filter-by-core.ts [--sizes 1500,5000,15000]
+ *       [--queries 2000] [--catalog DIR]
+ */
+
+import { join } from 'node:path';
+import { loadCatalog, filterByCore, compileCoreIndex } from '../src/catalog/lookup.js';
+import type { BehavioralCatalog, BehavioralPattern } from '../src/catalog/types.js';
+import {
+  BEHAVIORAL_MODES,
+  AUTONOMY_LEVELS,
+  FORMATION_ROLES,
+  RESOURCE_OWNERSHIPS,
+  PHYSICAL_TRAITS,
+  HARDWARE_TARGETS,
+  type CorePattern,
+} from '../src/types/dimensions.js';
+
+// ---------------------------------------------------------------------------
+// Workload
+// ---------------------------------------------------------------------------
+
+/** Deterministic LCG so runs are comparable. */
+function makeRng(seed: number): () => number {
+  let state = seed >>> 0;
+  return () => {
+    state = (Math.imul(state, 1664525) + 1013904223) >>> 0;
+    return state / 2 ** 32;
+  };
+}
+
+function pick<T>(values: readonly T[], rng: () => number): T {
+  return values[Math.floor(rng() * values.length)]!;
+}
+
+function syntheticCatalog(templates: BehavioralPattern[], size: number, rng: () => number): BehavioralCatalog {
+  const patterns = new Map<string, BehavioralPattern>();
+  for (let i = 0; i < size; i++) {
+    const template = templates[i % templates.length]!;
+    const pattern: BehavioralPattern = {
+      ...template,
+      id: `${template.id}~${i}`,
+      core: {
+        sigma: pick(BEHAVIORAL_MODES, rng),
+        kappa: pick(AUTONOMY_LEVELS, rng),
+        chi: pick(FORMATION_ROLES, rng),
+        lambda: pick(RESOURCE_OWNERSHIPS, rng),
+        tau: pick(PHYSICAL_TRAITS, rng),
+        rho: pick(HARDWARE_TARGETS, rng),
+      },
+    };
+    patterns.set(pattern.id, pattern);
+  }
+  return { patterns, compatibility: [] };
+}
+
+/** The partial cores solveForDrone and its fallbacks ask for, per drone. */
+function solverQueries(count: number, rng: () => number): Partial<CorePattern>[] {
+  const queries: Partial<CorePattern>[] = [];
+  for (let i = 0; i < count; i++) {
+    const hardware = { rho: pick(HARDWARE_TARGETS, rng), tau: pick(PHYSICAL_TRAITS, rng) };
+    queries.push(hardware, { sigma: 'hover', ...hardware }, hardware);
+  }
+  return queries;
+}
+
+// ---------------------------------------------------------------------------
+// Measurement
+// ---------------------------------------------------------------------------
+
+export interface FilterBenchResult {
+  patterns: number;
+  meanMatches: number;
+  /** Mean wall time per query (µs) */
+  indexUs: number;
+  scanUs: number;
+}
+
+function timeQueries(catalog: BehavioralCatalog, queries: Partial<CorePattern>[]): { us: number; matches: number } {
+  let matches = 0;
+  const start = performance.now();
+  for (const query of queries) matches += filterByCore(catalog, query).length;
+  return { us: (performance.now() - start) * 1000 / queries.length, matches };
+}
+
+export function benchFilterByCore(templates: BehavioralPattern[], size: number, queryCount: number): FilterBenchResult {
+  const rng = makeRng(size);
+  const scanned = syntheticCatalog(templates, size, rng);
+  const indexed: BehavioralCatalog = { ...scanned, coreIndex: compileCoreIndex(scanned) };
+  const queries = solverQueries(queryCount, rng);
+
+  timeQueries(indexed, queries.slice(0, 300)); // Warm up both paths
+  timeQueries(scanned, queries.slice(0, 300));
+  const index = timeQueries(indexed, queries);
+  const scan = timeQueries(scanned, queries);
+  if (index.matches !== scan.matches) {
+    throw new Error(`Index and scan disagree: ${index.matches} vs ${scan.matches} matches`);
+  }
+
+  return { patterns: size, meanMatches: index.matches / queries.length, indexUs: index.us, scanUs: scan.us };
+}
+
+// ---------------------------------------------------------------------------
+// CLI Entry Point
+// ---------------------------------------------------------------------------
+
+const isDirectRun = process.argv[1]?.endsWith('bench-filter-by-core.ts') ||
+                    process.argv[1]?.endsWith('bench-filter-by-core.js');
+
+if (isDirectRun) {
+  const args = process.argv.slice(2);
+  let sizes = [1500, 5000, 15000];
+  let queries = 2000;
+  let catalogDir = join(import.meta.dirname ?? '.', '..', 'catalog');
+
+  for (let i = 0; i < args.length; i++) {
+    const arg = args[i]!;
+    if (arg === '--sizes') sizes = args[++i]!.split(',').map(Number);
+    else if (arg === '--queries') queries = Number(args[++i]);
+    else if (arg === '--catalog') catalogDir = args[++i]!;
+  }
+  if (sizes.some((n) => !(n > 0)) || !(queries > 0)) {
+    console.error('Usage: bench-filter-by-core.ts [--sizes 1500,...] [--queries Q] [--catalog DIR]');
+    process.exit(1);
+  }
+
+  const templates = Array.from(loadCatalog(catalogDir).patterns.values());
+  console.log('patterns  matches  index µs/query  scan µs/query  speedup');
+  for (const n of sizes) {
+    const r = benchFilterByCore(templates, n, queries);
+    console.log(
+      `${String(r.patterns).padStart(8)}  ${r.meanMatches.toFixed(1).padStart(7)}` +
+      `  ${r.indexUs.toFixed(2).padStart(14)}  ${r.scanUs.toFixed(2).padStart(13)}` +
+      `  ${(r.scanUs / r.indexUs).toFixed(1).padStart(6)}x`,
+    );
+  }
+}
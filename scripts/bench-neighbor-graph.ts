@@ -0,0 +1,148 @@
+/**
+ * Seshat Swarm — Neighbor Graph Benchmark
+ *
+ * Times one telemetry tick (every drone moves a little and reports, so
+ * updateTelemetry maintains its ε) for swarms of 10 to 10,000 drones,
+ * through WorldModel (spatial grid, links re-evaluated past the
+ * hysteresis band) and with the all-pairs scan it replaced.
+ *
+ * Drones are scattered over a 10 m-deep slab whose area grows with N, so
+ * density (and the neighbor count per drone) stays constant: the grid's
+ * cost per update should stay flat while the scan's grows linearly.
+ *
+ * Usage:
+ *   npx tsx scripts/bench-neighbor-graph.ts [--sizes 10,100,1000,10000]
+ *       [--ticks 5] [--density 0.02]
+ */
+
+import { WorldModel, vec3Distance } from '../src/coordinator/world-model.js';
+import type { SensorState, Vec3 } from '../src/types/dimensions.js';
+
+// ---------------------------------------------------------------------------
+// Workload
+// ---------------------------------------------------------------------------
+
+const SLAB_DEPTH_M = 10;
+const STEP_M = 0.1;
+
+/** Deterministic LCG so runs are comparable. */
+function makeRng(seed: number): () => number {
+  let state = seed >>> 0;
+  return () => {
+    state = (Math.imul(state, 1664525) + 1013904223) >>> 0;
+    return state / 2 ** 32;
+  };
+}
+
+function telemetryAt(position: Vec3): SensorState {
+  return {
+    position,
+    velocity: { x: 0, y: 0, z: 0 },
+    orientation: { x: 0, y: 0, z: 0 },
+    angular_velocity: { x: 0, y: 0, z: 0 },
+    battery: { voltage: 3.7, percentage: 0.8, discharge_rate: 2.5, estimated_remaining: 300 },
+    position_quality: 0.95,
+    wind_estimate: { x: 0, y: 0, z: 0 },
+  };
+}
+
+function buildSwarm(n: number, density: number, rng: () => number): WorldModel {
+  const side = Math.sqrt(n / (density * SLAB_DEPTH_M));
+  const world = new WorldModel();
+  for (let i = 0; i < n; i++) {
+    world.addDrone(`d${i}`, 'sim-gazebo', 'bare', 'hover', telemetryAt({
+      x: rng() * side, y: rng() * side, z: rng() * SLAB_DEPTH_M,
+    }));
+  }
+  return world;
+}
+
+/** The pre-grid ε scan: every drone against every other. */
+function scanNeighbors(world: WorldModel, droneId: string, position: Vec3): string[] {
+  const neighbors: string[] = [];
+  for (const [otherId, other] of world.drones) {
+    if (otherId === droneId) continue;
+    if (vec3Distance(position, other.lastTelemetry.position) <= world.config.commRange) {
+      neighbors.push(otherId);
+    }
+  }
+  return neighbors;
+}
+
+// ---------------------------------------------------------------------------
+// Measurement
+// ---------------------------------------------------------------------------
+
+export interface BenchResult {
+  drones: number;
+  meanNeighbors: number;
+  /** Mean wall time of one full telemetry tick (ms) */
+  gridTickMs: number;
+  scanTickMs: number;
+}
+
+export function benchNeighborGraph(n: number, ticks: number, density: number): BenchResult {
+  const rng = makeRng(n);
+  const world = buildSwarm(n, density, rng);
+  const ids = Array.from(world.drones.keys());
+  let neighborSum = 0;
+
+  const gridStart = performance.now();
+  for (let t = 0; t < ticks; t++) {
+    for (const id of ids) {
+      const p = world.getDrone(id)!.lastTelemetry.position;
+      world.updateTelemetry(id, telemetryAt({
+        x: p.x + (rng() - 0.5) * STEP_M,
+        y: p.y + (rng() - 0.5) * STEP_M,
+        z: p.z + (rng() - 0.5) * STEP_M,
+      }));
+    }
+  }
+  const gridTickMs = (performance.now() - gridStart) / ticks;
+
+  const scanStart = performance.now();
+  for (let t = 0; t < ticks; t++) {
+    for (const id of ids) {
+      neighborSum += scanNeighbors(world, id, world.getDrone(id)!.lastTelemetry.position).length;
+    }
+  }
+  const scanTickMs = (performance.now() - scanStart) / ticks;
+
+  return { drones: n, meanNeighbors: neighborSum / (ticks * n), gridTickMs, scanTickMs };
+}
+
+// ---------------------------------------------------------------------------
+// CLI Entry Point
+// ---------------------------------------------------------------------------
+
+const isDirectRun = process.argv[1]?.endsWith('bench-neighbor-graph.ts') ||
+                    process.argv[1]?.endsWith('bench-neighbor-graph.js');
+
+if (isDirectRun) {
+  const args = process.argv.slice(2);
+  let sizes = [10, 100, 1000, 10000];
+  let ticks = 5;
+  let density = 0.02;
+
+  for (let i = 0; i < args.length; i++) {
+    const arg = args[i]!;
+    if (arg === '--sizes') sizes = args[++i]!.split(',').map(Number);
+    else if (arg === '--ticks') ticks = Number(args[++i]);
+    else if (arg === '--density') density = Number(args[++i]);
+  }
+  if (sizes.some((n) => !(n > 0)) || !(ticks > 0) || !(density > 0)) {
+    console.error('Usage: bench-neighbor-graph.ts [--sizes 10,100,...] [--ticks T] [--density D]');
+    process.exit(1);
+  }
+
+  console.log('drones  neighbors  grid ms/tick  scan ms/tick  grid µs/update  speedup');
+  for (const n of sizes) {
+    const r = benchNeighborGraph(n, ticks, density);
+    console.log(
+      `${String(r.drones).padStart(6)}  ${r.meanNeighbors.toFixed(1).padStart(9)}` +
+      `  ${r.gridTickMs.toFixed(2).padStart(12)}  ${r.scanTickMs.toFixed(2).padStart(12)}` +
+      `  ${(r.gridTickMs * 1000 / n).toFixed(2).padStart(14)}` +
+      `  ${(r.scanTickMs / r.gridTickMs).toFixed(1).padStart(6)}x`,
+    );
+  }
+}
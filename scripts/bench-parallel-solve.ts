@@ -0,0 +1,177 @@
+/**
+ * Seshat Swarm — Parallel Solve Benchmark
+ *
+ * Times a swarm-wide re-solve (every drone affected, as after a formation
+ * change) with solveAssignment on the event loop and with SolverPool at
+ * each worker count, and checks the pool returns the same assignments.
+ * Besides wall time per solve, reports how long the pool holds the event
+ * loop before handing off to the workers (partitioning and snapshots),
+ * which is what delays telemetry ingestion; merging is a map lookup per
+ * drone. Speedup needs as many free cores as workers.
+ *
+ * Drones fly the real catalog's sim-gazebo patterns in small clusters,
+ * well out of ε range of each other, so the affected set splits into
+ * many components.
+ *
+ * Usage:
+ *   npx tsx scripts/bench-parallel-solve.ts [--drones 500] [--cluster 10]
+ *       [--threads 1,2,4] [--runs 20] [--catalog DIR]
+ */
+
+import { join } from 'node:path';
+import { availableParallelism } from 'node:os';
+import { isDeepStrictEqual } from 'node:util';
+import { WorldModel } from '../src/coordinator/world-model.js';
+import { solveAssignment, type SwarmObjective } from '../src/coordinator/constraint-engine.js';
+import { SolverPool } from '../src/coordinator/solver-pool.js';
+import { loadCatalog } from '../src/catalog/lookup.js';
+import type { BehavioralCatalog } from '../src/catalog/types.js';
+import type { SensorState, Vec3 } from '../src/types/dimensions.js';
+
+// ---------------------------------------------------------------------------
+// Workload
+// ---------------------------------------------------------------------------
+
+const HOVER = 'hover-autonomous-performer-bare.sim-gazebo';
+const COMM_RANGE_M = 5;
+const CLUSTER_SPACING_M = 20;
+const OBJECTIVES: SwarmObjective[][] = [[{ type: 'orbit' }], [{ type: 'formation' }]];
+
+/** Deterministic LCG so runs are comparable. */
+function makeRng(seed: number): () => number {
+  let state = seed >>> 0;
+  return () => {
+    state = (Math.imul(state, 1664525) + 1013904223) >>> 0;
+    return state / 2 ** 32;
+  };
+}
+
+function sensorState(position: Vec3, battery: number): SensorState {
+  return {
+    position,
+    velocity: { x: 0, y: 0, z: 0 },
+    orientation: { x: 0, y: 0, z: 0 },
+    angular_velocity: { x: 0, y: 0, z: 0 },
+    battery: { voltage: 3.7, percentage: battery, discharge_rate: 2.5, estimated_remaining: 0 },
+    position_quality: 0.95,
+    wind_estimate: { x: 0, y: 0, z: 0 },
+  };
+}
+
+/** Clusters of `cluster` drones within ε range, on a grid of clusters. */
+function clusteredWorld(drones: number, cluster: number, rng: () => number): WorldModel {
+  const world = new WorldModel({ commRange: COMM_RANGE_M });
+  const perRow = Math.ceil(Math.sqrt(drones / cluster));
+  for (let i = 0; i < drones; i++) {
+    const c = Math.floor(i / cluster);
+    world.addDrone(`d${i}`, 'sim-gazebo', 'bare', HOVER, sensorState({
+      x: (c % perRow) * CLUSTER_SPACING_M + rng() * 3,
+      y: Math.floor(c / perRow) * CLUSTER_SPACING_M + rng() * 3,
+      z: 1 + rng() * 3,
+    }, 0.2 + rng() * 0.8));
+  }
+  // Recompute neighbor graphs after all drones are added
+  for (const id of world.getActiveDroneIds()) {
+    world.updateTelemetry(id, world.getDrone(id)!.lastTelemetry);
+  }
+  return world;
+}
+
+// ---------------------------------------------------------------------------
+// Measurement
+// ---------------------------------------------------------------------------
+
+export interface ParallelSolveResult {
+  /** 0 = solveAssignment on the calling thread */
+  threads: number;
+  /** Mean wall time per re-solve (ms) */
+  meanMs: number;
+  /** Mean event-loop time to dispatch a re-solve (ms); all of it inline */
+  dispatchMs: number;
+}
+
+export async function benchParallelSolve(
+  catalog: BehavioralCatalog,
+  drones: number,
+  cluster: number,
+  threadCounts: number[],
+  runs: number,
+): Promise<ParallelSolveResult[]> {
+  const world = clusteredWorld(drones, cluster, makeRng(drones));
+  const affected = new Set(world.getActiveDroneIds());
+  const expected = OBJECTIVES.map((objectives) => solveAssignment(world, catalog, affected, objectives));
+
+  const results: ParallelSolveResult[] = [];
+  let start = performance.now();
+  for (let r = 0; r < runs; r++) solveAssignment(world, catalog, affected, OBJECTIVES[r % 2]!);
+  const inlineMs = (performance.now() - start) / runs;
+  results.push({ threads: 0, meanMs: inlineMs, dispatchMs: inlineMs });
+
+  for (const threads of threadCounts) {
+    const pool = new SolverPool(catalog, { threads, minParallelDrones: 0 });
+    try {
+      for (let r = 0; r < 2; r++) { // Warm up; also checks the results
+        const got = await pool.solve(world, affected, OBJECTIVES[r]!);
+        if (!isDeepStrictEqual(got, expected[r])) {
+          throw new Error(`${threads} threads: pool and solveAssignment disagree`);
+        }
+      }
+      let dispatchMs = 0;
+      start = performance.now();
+      for (let r = 0; r < runs; r++) {
+        const dispatched = performance.now();
+        const solving = pool.solve(world, affected, OBJECTIVES[r % 2]!);
+        dispatchMs += performance.now() - dispatched;
+        await solving;
+      }
+      results.push({ threads, meanMs: (performance.now() - start) / runs, dispatchMs: dispatchMs / runs });
+    } finally {
+      await pool.close();
+    }
+  }
+  return results;
+}
+
+// ---------------------------------------------------------------------------
+// CLI Entry Point
+// ---------------------------------------------------------------------------
+
+const isDirectRun = process.argv[1]?.endsWith('bench-parallel-solve.ts') ||
+                    process.argv[1]?.endsWith('bench-parallel-solve.js');
+
+if (isDirectRun) {
+  const args = process.argv.slice(2);
+  let drones = 500;
+  let cluster = 10;
+  let threadCounts: number[] = [];
+  let runs = 20;
+  let catalogDir = join(import.meta.dirname ?? '.', '..', 'catalog');
+
+  for (let i = 0; i < args.length; i++) {
+    const arg = args[i]!;
+    if (arg === '--drones') drones = Number(args[++i]);
+    else if (arg === '--cluster') cluster = Number(args[++i]);
+    else if (arg === '--threads') threadCounts = args[++i]!.split(',').map(Number);
+    else if (arg === '--runs') runs = Number(args[++i]);
+    else if (arg === '--catalog') catalogDir = args[++i]!;
+  }
+  if (threadCounts.length === 0) {
+    for (let n = 1; n <= availableParallelism(); n *= 2) threadCounts.push(n);
+  }
+  if (!(drones > 0) || !(cluster > 0) || !(runs > 0) || threadCounts.some((n) => !(n > 0))) {
+    console.error('Usage: bench-parallel-solve.ts [--drones N] [--cluster C] [--threads 1,2,...] [--runs R] [--catalog DIR]');
+    process.exit(1);
+  }
+
+  const results = await benchParallelSolve(loadCatalog(catalogDir), drones, cluster, threadCounts, runs);
+  const inline = results[0]!.meanMs;
+  console.log(`${drones} drones in clusters of ${cluster}, ${availableParallelism()} cores`);
+  console.log(' threads  ms/solve  speedup  dispatch ms');
+  for (const r of results) {
+    console.log(
+      `${(r.threads === 0 ? 'inline' : String(r.threads)).padStart(8)}` +
+      `  ${r.meanMs.toFixed(3).padStart(8)}  ${(inline / r.meanMs).toFixed(2).padStart(6)}x` +
+      `  ${r.dispatchMs.toFixed(3).padStart(11)}`,
+    );
+  }
+}
@@ -4,6 +4,7 @@ import {
   flattenBounds,
   compilePatterns,
   generateHeader,
+  generatorUsedMask,
   type CompiledPattern,
   type CompilationResult,
 } from './compile-catalog.js';
@@ -19,6 +20,7 @@ function makePattern(
   bounds: Record<string, { min: number; max: number }> = {},
   batteryFloor = 0.15,
   posQuality = 0.5,
+  rho = 'crazyflie-2.1',
 ) {
   return {
     id,
@@ -28,7 +30,7 @@ function makePattern(
       chi: 'performer',
       lambda: 'exclusive-volume',
       tau: 'bare',
-      rho: 'crazyflie-2.1',
+      rho,
     },
     preconditions: {
       battery_floor: batteryFloor,
@@ -199,6 +201,53 @@ describe('compilePatterns', () => {
   });
 });
 
+// ---------------------------------------------------------------------------
+// compilePatterns — per-target builds
+// ---------------------------------------------------------------------------
+
+describe('compilePatterns — per-target builds', () => {
+  const mixed = () => [
+    makePattern('a.sim-gazebo', 'idle', {}, {}, 0.0, 0.0, 'sim-gazebo'),
+    makePattern('b.crazyflie-2.1', 'position-hold', { altitude: 1.0 }),
+    makePattern('c.sim-gazebo', 'idle', {}, {}, 0.0, 0.0, 'sim-gazebo'),
+    makePattern('d.crazyflie-2.1', 'idle'),
+  ];
+
+  it('keeps only the requested target and numbers it densely', () => {
+    const result = compilePatterns(mixed(), 'crazyflie-2.1');
+    expect(result.rho).toBe('crazyflie-2.1');
+    expect(result.patterns.map((p) => p.stringId)).toEqual(['b.crazyflie-2.1', 'd.crazyflie-2.1']);
+    expect(result.patterns.map((p) => p.numericId)).toEqual([0, 1]);
+    expect(result.idMap).toEqual({ 'b.crazyflie-2.1': 0, 'd.crazyflie-2.1': 1 });
+  });
+
+  it('gives each target its own ID space', () => {
+    const sim = compilePatterns(mixed(), 'sim-gazebo');
+    expect(sim.idMap).toEqual({ 'a.sim-gazebo': 0, 'c.sim-gazebo': 1 });
+  });
+
+  it('unified build keeps every target', () => {
+    const result = compilePatterns(mixed());
+    expect(result.rho).toBeNull();
+    expect(result.patterns.length).toBe(4);
+  });
+
+  it('throws on unknown hardware target', () => {
+    expect(() => compilePatterns(mixed(), 'pixhawk')).toThrow('Unknown hardware target');
+  });
+
+  it('throws when the target has no patterns', () => {
+    expect(() => compilePatterns(mixed(), 'esp-drone')).toThrow('No patterns for hardware target');
+  });
+
+  it('records the target in the header', () => {
+    const header = generateHeader(compilePatterns(mixed(), 'sim-gazebo'));
+    expect(header).toContain('#define CATALOG_SIZE 2');
+    expect(header).toContain('#define CATALOG_RHO RHO_SIM_GAZEBO');
+    expect(generateHeader(compilePatterns(mixed()))).not.toContain('CATALOG_RHO');
+  });
+});
+
 // ---------------------------------------------------------------------------
 // generateHeader
 // ---------------------------------------------------------------------------
@@ -251,6 +300,23 @@ describe('generateHeader', () => {
     expect(header).toContain('#define PATTERN_HOVER_AUTO_CF 0');
   });
 
+  it('emits GEN_USED_MASK and per-generator feature macros', () => {
+    const result = compilePatterns([
+      makePattern('p1', 'position-hold'),
+      makePattern('p2', 'orbit-center'),
+      makePattern('p3', 'idle'),
+    ]);
+    expect(generatorUsedMask(result)).toBe((1 << 0) | (1 << 4) | (1 << 7));
+
+    const header = generateHeader(result);
+    expect(header).toContain('#define GEN_USED_MASK 0x91u');
+    expect(header).toContain('#define GEN_USES_POSITION_HOLD 1');
+    expect(header).toContain('#define GEN_USES_ORBIT_CENTER 1');
+    expect(header).toContain('#define GEN_USES_IDLE 1');
+    expect(header).toContain('#define GEN_USES_WAYPOINT_SEQUENCE 0');
+    expect(header).toContain('#define GEN_USES_VELOCITY_TRACK 0');
+  });
+
   it('contains AUTO-GENERATED warning', () => {
     const result = compilePatterns([]);
     const header = generateHeader(result);
@@ -9,6 +9,16 @@
  *
  * Pattern IDs are assigned as sequential uint16 values (0, 1, 2, ...),
  * deterministically sorted by pattern string ID for reproducibility.
+ *
+ * Per-target builds: `--rho <target>` keeps only that hardware target's
+ * patterns. The IDs are then dense within the target (0..N-1), so each
+ * flash image carries the smallest table and the firmware can index
+ * CATALOG[] directly. The emitted ID map is the matching ground-side
+ * translation table for drones flashed with that build.
+ *
+ * Usage:
+ *   pnpm compile-catalog                        # all patterns (unified ID space)
+ *   pnpm compile-catalog --rho crazyflie-2.1    # one hardware target
  */
 
 import { readFileSync, readdirSync, writeFileSync } from 'node:fs';
@@ -54,6 +64,15 @@ const GENERATOR_TYPE_MAP: Record<string, number> = {
   'idle': 7,
 };
 
+/** ρ string → HardwareTarget enum name in types.h. */
+const HARDWARE_TARGET_MAP: Record<string, string> = {
+  'crazyflie-2.1': 'RHO_CRAZYFLIE_2_1',
+  'crazyflie-bl': 'RHO_CRAZYFLIE_BL',
+  'esp-drone': 'RHO_ESP_DRONE',
+  'sim-gazebo': 'RHO_SIM_GAZEBO',
+  'sim-simple': 'RHO_SIM_SIMPLE',
+};
+
 /**
  * Parameter slot layout per generator type.
  * Each generator type defines a fixed ordering of named parameters
@@ -90,6 +109,8 @@ export interface CompiledPattern {
 export interface CompilationResult {
   patterns: CompiledPattern[];
   idMap: Record<string, number>;
+  /** Hardware target the catalog was filtered to, or null for a unified build. */
+  rho: string | null;
 }
 
 /**
@@ -140,10 +161,28 @@ export function flattenBounds(
 /**
  * Compile a list of pattern JSON objects into sequential PatternEntry data.
  * Patterns are sorted by string ID for deterministic ordering.
+ *
+ * When `rho` is given, only patterns for that hardware target are kept and
+ * numbered densely, giving the target its own ID space.
  */
-export function compilePatterns(patterns: PatternJSON[]): CompilationResult {
+export function compilePatterns(
+  patterns: PatternJSON[],
+  rho?: string,
+): CompilationResult {
+  if (rho !== undefined && HARDWARE_TARGET_MAP[rho] === undefined) {
+    throw new Error(`Unknown hardware target "${rho}"`);
+  }
+
+  const selected = rho === undefined
+    ? patterns
+    : patterns.filter((p) => p.core.rho === rho);
+  if (rho !== undefined && selected.length === 0) {
+    // A zero-length CATALOG[] is not valid C; there is nothing to flash.
+    throw new Error(`No patterns for hardware target "${rho}"`);
+  }
+
   // Sort by ID for deterministic ordering
-  const sorted = [...patterns].sort((a, b) => a.id.localeCompare(b.id));
+  const sorted = [...selected].sort((a, b) => a.id.localeCompare(b.id));
 
   const compiled: CompiledPattern[] = [];
   const idMap: Record<string, number> = {};
@@ -172,7 +211,7 @@ export function compilePatterns(patterns: PatternJSON[]): CompilationResult {
     idMap[p.id] = i;
   }
 
-  return { patterns: compiled, idMap };
+  return { patterns: compiled, idMap, rho: rho ?? null };
 }
 
 // ---------------------------------------------------------------------------
@@ -190,6 +229,23 @@ function floatArray(arr: number[]): string {
   return `{ ${arr.map(floatLiteral).join(', ')} }`;
 }
 
+/** GeneratorType enum suffix in types.h, e.g. 'orbit-center' → 'ORBIT_CENTER'. */
+function generatorMacroName(genType: string): string {
+  return genType.toUpperCase().replace(/-/g, '_');
+}
+
+/**
+ * Bitmask of generator types referenced by the compiled catalog
+ * (bit n set ⇔ some pattern uses GeneratorType n).
+ */
+export function generatorUsedMask(result: CompilationResult): number {
+  let mask = 0;
+  for (const p of result.patterns) {
+    mask |= 1 << p.generatorType;
+  }
+  return mask;
+}
+
 /**
  * Generate the C header file content.
  */
@@ -203,6 +259,7 @@ export function generateHeader(result: CompilationResult): string {
   lines.push(' * DO NOT EDIT MANUALLY — regenerate with: pnpm compile-catalog');
   lines.push(` * Generated: ${new Date().toISOString()}`);
   lines.push(` * Patterns: ${result.patterns.length}`);
+  lines.push(` * Target: ${result.rho ?? 'all (unified ID space)'}`);
   lines.push(' */');
   lines.push('');
   lines.push('#ifndef SESHAT_CATALOG_DATA_H');
@@ -211,7 +268,21 @@ export function generateHeader(result: CompilationResult): string {
   lines.push('#include "types.h"');
   lines.push('');
   lines.push(`#define CATALOG_SIZE ${result.patterns.length}`);
+  if (result.rho !== null) {
+    lines.push(`#define CATALOG_RHO ${HARDWARE_TARGET_MAP[result.rho]}`);
+  }
+  lines.push('');
+
+  // Generator usage, so the executor can compile out unused generators
+  const mask = generatorUsedMask(result);
+  lines.push('/* Generators referenced by this catalog (bit n = GeneratorType n) */');
+  lines.push(`#define GEN_USED_MASK 0x${mask.toString(16).toUpperCase().padStart(2, '0')}u`);
+  for (const [name, value] of Object.entries(GENERATOR_TYPE_MAP)) {
+    const used = (mask >> value) & 1;
+    lines.push(`#define GEN_USES_${generatorMacroName(name)} ${used}`);
+  }
   lines.push('');
+  lines.push('/* Entries are stored in ID order: CATALOG[i].id == i. */');
   lines.push('static const PatternEntry CATALOG[CATALOG_SIZE] = {');
 
   for (const p of result.patterns) {
@@ -255,6 +326,7 @@ export function compileCatalogFromDisk(
   catalogDir: string,
   outputHeader: string,
   outputIdMap: string,
+  rho?: string,
 ): CompilationResult {
   const patternsDir = join(catalogDir, 'patterns');
   const files = readdirSync(patternsDir).filter((f: string) =>
@@ -266,7 +338,7 @@ export function compileCatalogFromDisk(
     return JSON.parse(raw) as PatternJSON;
   });
 
-  const result = compilePatterns(patterns);
+  const result = compilePatterns(patterns, rho);
 
   // Write C header
   writeFileSync(outputHeader, generateHeader(result), 'utf-8');
@@ -287,9 +359,16 @@ if (isDirectRun) {
   const outputHeader = join(rootDir, 'src', 'firmware', 'catalog_data.h');
   const outputIdMap = join(rootDir, 'src', 'firmware', 'catalog_ids.json');
 
-  const result = compileCatalogFromDisk(catalogDir, outputHeader, outputIdMap);
+  const rhoIdx = process.argv.indexOf('--rho');
+  const rho = rhoIdx !== -1 ? process.argv[rhoIdx + 1] : undefined;
+  if (rhoIdx !== -1 && !rho) {
+    console.error('Usage: compile-catalog.ts [--rho <hardware-target>]');
+    process.exit(1);
+  }
+
+  const result = compileCatalogFromDisk(catalogDir, outputHeader, outputIdMap, rho);
 
-  console.log(`Compiled ${result.patterns.length} patterns`);
+  console.log(`Compiled ${result.patterns.length} patterns (target: ${result.rho ?? 'all'})`);
   console.log(`  Header: ${outputHeader}`);
   console.log(`  ID Map: ${outputIdMap}`);
 }
@@ -0,0 +1,141 @@
+import { describe, it, expect } from 'vitest';
+import { mkdtempSync, mkdirSync, readFileSync, writeFileSync } from 'node:fs';
+import { tmpdir } from 'node:os';
+import { join } from 'node:path';
+import {
+  mergeUsageDumps,
+  applyFleetUsage,
+  replaceVerificationBlock,
+  mergeIntoCatalog,
+  type FleetUsage,
+} from './merge-pattern-stats.js';
+import type { PatternVerification } from '../src/catalog/types.js';
+import type { PatternUsageDump } from '../src/coordinator/comms.js';
+
+// ---------------------------------------------------------------------------
+// Helpers
+// ---------------------------------------------------------------------------
+
+function makeVerification(overrides: Partial<PatternVerification> = {}): PatternVerification {
+  return {
+    status: 'unverified',
+    collision_clearance_m: 0.15,
+    max_velocity_ms: 1.5,
+    max_acceleration_ms2: 3.0,
+    energy_rate_js: 10.0,
+    max_duration_s: 10,
+    verified_transitions: [],
+    ...overrides,
+  };
+}
+
+function makeUsage(overrides: Partial<FleetUsage> = {}): FleetUsage {
+  return {
+    flights: 2,
+    entries: 5,
+    time_s: 100,
+    energy_j: 800,
+    peak_speed_ms: 0.4,
+    peak_attitude_deg: 5,
+    ...overrides,
+  };
+}
+
+const dump = (droneId: string, patterns: PatternUsageDump['patterns']): PatternUsageDump =>
+  ({ droneId, patterns });
+
+// ---------------------------------------------------------------------------
+// mergeUsageDumps
+// ---------------------------------------------------------------------------
+
+describe('mergeUsageDumps', () => {
+  it('sums totals and keeps the largest peaks across drones', () => {
+    const fleet = mergeUsageDumps([
+      dump('cf-1', { hover: { entries: 2, time_s: 30, energy_j: 240, peak_speed_ms: 0.2, peak_attitude_deg: 4 } }),
+      dump('cf-2', {
+        hover: { entries: 1, time_s: 10, energy_j: 90, peak_speed_ms: 0.3, peak_attitude_deg: 3 },
+        orbit: { entries: 1, time_s: 5, energy_j: 50, peak_speed_ms: 1.1, peak_attitude_deg: 9 },
+      }),
+    ]);
+
+    const hover = fleet.get('hover')!;
+    expect(hover.flights).toBe(2);
+    expect(hover.entries).toBe(3);
+    expect(hover.time_s).toBe(40);
+    expect(hover.energy_j).toBe(330);
+    expect(hover.peak_speed_ms).toBe(0.3);
+    expect(hover.peak_attitude_deg).toBe(4);
+    expect(fleet.get('orbit')!.flights).toBe(1);
+  });
+});
+
+// ---------------------------------------------------------------------------
+// applyFleetUsage
+// ---------------------------------------------------------------------------
+
+describe('applyFleetUsage', () => {
+  it('replaces the energy rate and derives endurance from the pack', () => {
+    const v = applyFleetUsage(makeVerification(), makeUsage(), { packEnergyJ: 3330, minSeconds: 10 })!;
+    expect(v.energy_rate_js).toBe(8);
+    expect(v.max_duration_s).toBe(416);
+    expect(v.flight_results).toEqual({ flights: 2, entries: 5, time_s: 100, energy_j: 800 });
+    expect(v.status).toBe('unverified');
+  });
+
+  it('only widens the velocity and acceleration envelope', () => {
+    const gentle = applyFleetUsage(makeVerification(), makeUsage())!;
+    expect(gentle.max_velocity_ms).toBe(1.5);
+    expect(gentle.max_acceleration_ms2).toBe(3.0);
+
+    const hard = applyFleetUsage(makeVerification(), makeUsage({ peak_speed_ms: 2.345, peak_attitude_deg: 30 }))!;
+    expect(hard.max_velocity_ms).toBe(2.35);
+    expect(hard.max_acceleration_ms2).toBeCloseTo(5.67, 2);
+  });
+
+  it('leaves patterns with too little flight time alone', () => {
+    expect(applyFleetUsage(makeVerification(), makeUsage({ time_s: 4 }), { packEnergyJ: 3330, minSeconds: 5 })).toBeNull();
+  });
+});
+
+// ---------------------------------------------------------------------------
+// Catalog files
+// ---------------------------------------------------------------------------
+
+describe('replaceVerificationBlock', () => {
+  it('rewrites only the verification object', () => {
+    const text = '{\n  "id": "hover",\n  "bounds": { "min": 0.2, "max": 1.0 },\n  "verification": {\n    "status": "unverified"\n  }\n}\n';
+    const out = replaceVerificationBlock(text, makeVerification({ energy_rate_js: 7.5 }));
+    expect(out.startsWith('{\n  "id": "hover",\n  "bounds": { "min": 0.2, "max": 1.0 },\n  "verification": {\n    "status"')).toBe(true);
+    expect(out.endsWith('\n    "verified_transitions": []\n  }\n}\n')).toBe(true);
+    expect(JSON.parse(out).verification.energy_rate_js).toBe(7.5);
+  });
+});
+
+describe('mergeIntoCatalog', () => {
+  it('writes merged usage into pattern files and reports the rest', () => {
+    const root = mkdtempSync(join(tmpdir(), 'merge-stats-'));
+    mkdirSync(join(root, 'patterns'));
+    const patternPath = join(root, 'patterns', 'hover.crazyflie-2.1.pattern.json');
+    writeFileSync(patternPath, JSON.stringify({ id: 'hover', verification: makeVerification() }, null, 2) + '\n');
+    writeFileSync(join(root, 'patterns', 'orbit.crazyflie-2.1.pattern.json'),
+      JSON.stringify({ id: 'orbit', verification: makeVerification() }, null, 2) + '\n');
+    const dumpPath = join(root, 'cf-1.json');
+    writeFileSync(dumpPath, JSON.stringify(dump('cf-1', {
+      hover: { entries: 3, time_s: 60, energy_j: 420, peak_speed_ms: 0.1, peak_attitude_deg: 2 },
+      orbit: { entries: 1, time_s: 2, energy_j: 20, peak_speed_ms: 1.0, peak_attitude_deg: 8 },
+      retired: { entries: 1, time_s: 30, energy_j: 300, peak_speed_ms: 1.0, peak_attitude_deg: 8 },
+    })));
+
+    const dry = mergeIntoCatalog(root, [dumpPath]);
+    expect(dry.updated).toEqual(['hover']);
+    expect(JSON.parse(readFileSync(patternPath, 'utf-8')).verification.energy_rate_js).toBe(10);
+
+    const report = mergeIntoCatalog(root, [dumpPath], undefined, true);
+    expect(report.skipped).toEqual(['orbit']);
+    expect(report.unknown).toEqual(['retired']);
+    const merged = JSON.parse(readFileSync(patternPath, 'utf-8')).verification;
+    expect(merged.energy_rate_js).toBe(7);
+    expect(merged.max_duration_s).toBe(475);
+    expect(merged.flight_results.flights).toBe(1);
+  });
+});
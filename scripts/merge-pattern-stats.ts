@@ -0,0 +1,221 @@
+/**
+ * Seshat Swarm — Pattern Usage Merger
+ *
+ * Folds onboard per-pattern usage (src/firmware/pattern_stats.h, collected
+ * on the ground by PatternUsageCollector) from any number of drone-flights
+ * back into the catalog's verification blocks.
+ *
+ * Input:  dump files, each a PatternUsageDump (one drone, one flight)
+ * Output: catalog/patterns/*.pattern.json verification fields (--write)
+ *
+ * Per pattern with at least --min-seconds of fleet time:
+ *   energy_rate_js        fleet energy / fleet time (a measured mean, replaced)
+ *   max_duration_s        --pack-j / energy_rate_js
+ *   max_velocity_ms       max(current, measured peak speed)
+ *   max_acceleration_ms2  max(current, g·tan(measured peak tilt command))
+ *   flight_results        fleet totals
+ * Envelope limits only ever widen: a handful of gentle flights must not
+ * shrink a bound the rest of the system plans separations against.
+ *
+ * Without --write the script only prints what would change.
+ *
+ * Usage:
+ *   npx tsx scripts/merge-pattern-stats.ts [--write] [--pack-j 3330]
+ *       [--min-seconds 10] [--catalog <dir>] dump.json...
+ */
+
+import { readFileSync, readdirSync, writeFileSync } from 'node:fs';
+import { join } from 'node:path';
+import type { PatternVerification } from '../src/catalog/types.js';
+import type { PatternUsageDump } from '../src/coordinator/comms.js';
+
+// ---------------------------------------------------------------------------
+// Types
+// ---------------------------------------------------------------------------
+
+/** One pattern's usage summed across the fleet. */
+export interface FleetUsage {
+  flights: number;
+  entries: number;
+  time_s: number;
+  energy_j: number;
+  peak_speed_ms: number;
+  peak_attitude_deg: number;
+}
+
+export interface MergeOptions {
+  /** Usable pack energy for max_duration_s (J). Crazyflie 2.1: 250 mAh × 3.7 V. */
+  packEnergyJ: number;
+  /** Fleet time below which a pattern's numbers are too thin to use (s). */
+  minSeconds: number;
+}
+
+export const DEFAULT_MERGE_OPTIONS: MergeOptions = {
+  packEnergyJ: 3330,
+  minSeconds: 10,
+};
+
+const GRAVITY = 9.81;
+
+// ---------------------------------------------------------------------------
+// Core Merge Logic
+// ---------------------------------------------------------------------------
+
+/** Sum usage per string pattern ID across dumps. */
+export function mergeUsageDumps(dumps: PatternUsageDump[]): Map<string, FleetUsage> {
+  const fleet = new Map<string, FleetUsage>();
+  for (const dump of dumps) {
+    for (const [id, u] of Object.entries(dump.patterns)) {
+      const f = fleet.get(id) ?? {
+        flights: 0, entries: 0, time_s: 0, energy_j: 0, peak_speed_ms: 0, peak_attitude_deg: 0,
+      };
+      f.flights++;
+      f.entries += u.entries;
+      f.time_s += u.time_s;
+      f.energy_j += u.energy_j;
+      f.peak_speed_ms = Math.max(f.peak_speed_ms, u.peak_speed_ms);
+      f.peak_attitude_deg = Math.max(f.peak_attitude_deg, u.peak_attitude_deg);
+      fleet.set(id, f);
+    }
+  }
+  return fleet;
+}
+
+const round2 = (x: number): number => Math.round(x * 100) / 100;
+const ceil2 = (x: number): number => Math.ceil(x * 100 - 1e-9) / 100;
+
+/**
+ * Verification block updated with fleet usage, or null if the usage is
+ * below `minSeconds` and the block should be left alone.
+ */
+export function applyFleetUsage(
+  verification: PatternVerification,
+  usage: FleetUsage,
+  options: MergeOptions = DEFAULT_MERGE_OPTIONS,
+): PatternVerification | null {
+  if (usage.time_s < options.minSeconds) return null;
+
+  const energyRate = round2(usage.energy_j / usage.time_s);
+  const tilt = (Math.min(usage.peak_attitude_deg, 89) * Math.PI) / 180;
+  return {
+    ...verification,
+    energy_rate_js: energyRate,
+    max_duration_s: energyRate > 0 ? Math.floor(options.packEnergyJ / energyRate) : verification.max_duration_s,
+    max_velocity_ms: Math.max(verification.max_velocity_ms, ceil2(usage.peak_speed_ms)),
+    max_acceleration_ms2: Math.max(verification.max_acceleration_ms2, ceil2(GRAVITY * Math.tan(tilt))),
+    flight_results: {
+      flights: usage.flights,
+      entries: usage.entries,
+      time_s: round2(usage.time_s),
+      energy_j: round2(usage.energy_j),
+    },
+  };
+}
+
+/**
+ * Replace the "verification" object in a pattern file's text, keeping the
+ * rest of the file byte for byte.
+ */
+export function replaceVerificationBlock(text: string, verification: PatternVerification): string {
+  const key = text.indexOf('"verification"');
+  if (key < 0) throw new Error('No "verification" block');
+  const open = text.indexOf('{', key);
+
+  let depth = 0;
+  let close = open;
+  for (; close < text.length; close++) {
+    if (text[close] === '{') depth++;
+    else if (text[close] === '}' && --depth === 0) break;
+  }
+
+  const lineStart = text.lastIndexOf('\n', key) + 1;
+  const indent = text.slice(lineStart, key);
+  const body = JSON.stringify(verification, null, 2).replace(/\n/g, `\n${indent}`);
+  return text.slice(0, open) + body + text.slice(close + 1);
+}
+
+// ---------------------------------------------------------------------------
+// Disk I/O
+// ---------------------------------------------------------------------------
+
+export interface MergeReport {
+  updated: string[];
+  /** Patterns with usage below minSeconds */
+  skipped: string[];
+  /** Pattern IDs in the dumps that are not in the catalog */
+  unknown: string[];
+}
+
+/** Merge dump files into the catalog's pattern files. */
+export function mergeIntoCatalog(
+  catalogDir: string,
+  dumpFiles: string[],
+  options: MergeOptions = DEFAULT_MERGE_OPTIONS,
+  write = false,
+): MergeReport {
+  const dumps = dumpFiles.map((f) => JSON.parse(readFileSync(f, 'utf-8')) as PatternUsageDump);
+  const fleet = mergeUsageDumps(dumps);
+  const report: MergeReport = { updated: [], skipped: [], unknown: [] };
+
+  const patternsDir = join(catalogDir, 'patterns');
+  const seen = new Set<string>();
+  for (const file of readdirSync(patternsDir).filter((f) => f.endsWith('.pattern.json'))) {
+    const path = join(patternsDir, file);
+    const text = readFileSync(path, 'utf-8');
+    const pattern = JSON.parse(text) as { id: string; verification: PatternVerification };
+    const usage = fleet.get(pattern.id);
+    if (!usage) continue;
+    seen.add(pattern.id);
+
+    const verification = applyFleetUsage(pattern.verification, usage, options);
+    if (!verification) {
+      report.skipped.push(pattern.id);
+      continue;
+    }
+    report.updated.push(pattern.id);
+    if (write) writeFileSync(path, replaceVerificationBlock(text, verification), 'utf-8');
+  }
+
+  report.unknown = Array.from(fleet.keys()).filter((id) => !seen.has(id));
+  return report;
+}
+
+// ---------------------------------------------------------------------------
+// CLI Entry Point
+// ---------------------------------------------------------------------------
+
+const isDirectRun = process.argv[1]?.endsWith('merge-pattern-stats.ts') ||
+                    process.argv[1]?.endsWith('merge-pattern-stats.js');
+
+if (isDirectRun) {
+  const args = process.argv.slice(2);
+  const options = { ...DEFAULT_MERGE_OPTIONS };
+  let catalogDir = join(import.meta.dirname ?? '.', '..', 'catalog');
+  let write = false;
+  const dumpFiles: string[] = [];
+
+  for (let i = 0; i < args.length; i++) {
+    const arg = args[i]!;
+    if (arg === '--write') write = true;
+    else if (arg === '--pack-j') options.packEnergyJ = Number(args[++i]);
+    else if (arg === '--min-seconds') options.minSeconds = Number(args[++i]);
+    else if (arg === '--catalog') catalogDir = args[++i]!;
+    else dumpFiles.push(arg);
+  }
+  if (dumpFiles.length === 0 || !(options.packEnergyJ > 0) || !(options.minSeconds >= 0)) {
+    console.error('Usage: merge-pattern-stats.ts [--write] [--pack-j J] [--min-seconds S] [--catalog DIR] dump.json...');
+    process.exit(1);
+  }
+
+  const report = mergeIntoCatalog(catalogDir, dumpFiles, options, write);
+  console.log(`${write ? 'Updated' : 'Would update'} ${report.updated.length} pattern(s) from ${dumpFiles.length} dump(s)`);
+  for (const id of report.updated) console.log(`  ${id}`);
+  if (report.skipped.length > 0) {
+    console.log(`Skipped ${report.skipped.length} with under ${options.minSeconds} s of flight:`);
+    for (const id of report.skipped) console.log(`  ${id}`);
+  }
+  if (report.unknown.length > 0) {
+    console.log(`Not in catalog (${report.unknown.length}):`);
+    for (const id of report.unknown) console.log(`  ${id}`);
+  }
+}
@@ -0,0 +1,94 @@
+import { describe, it, expect } from 'vitest';
+import {
+  parseCondition,
+  compareCondition,
+  compileForcedExits,
+  CONDITION_FIELDS,
+  CONDITION_OPS,
+} from './forced-exits.js';
+import { buildPatternIdMap } from './lookup.js';
+import type { BehavioralCatalog, BehavioralPattern } from './types.js';
+
+function makePattern(id: string, forcedExits: Array<[string, string]>): BehavioralPattern {
+  return {
+    id,
+    core: {
+      sigma: 'hover',
+      kappa: 'autonomous',
+      chi: 'performer',
+      lambda: 'shared-corridor',
+      tau: 'bare',
+      rho: 'crazyflie-2.1',
+    },
+    description: `Test pattern: ${id}`,
+    preconditions: { battery_floor: 0.1, position_quality_floor: 0.5, min_references: 0, valid_from: [] },
+    postconditions: {
+      valid_to: [],
+      forced_exits: forcedExits.map(([condition, target_pattern]) => ({ condition, target_pattern })),
+    },
+    generator: { type: 'position-hold', defaults: {}, bounds: {} },
+    verification: {
+      status: 'verified',
+      collision_clearance_m: 0.3,
+      max_velocity_ms: 1.0,
+      max_acceleration_ms2: 2.0,
+      energy_rate_js: 5.0,
+      max_duration_s: 300,
+      verified_transitions: [],
+    },
+  };
+}
+
+describe('parseCondition', () => {
+  it('parses every operator, with or without spaces', () => {
+    expect(parseCondition('battery < 0.10')).toEqual({ field: 'battery', op: '<', threshold: 0.1 });
+    expect(parseCondition('battery>=0.9')).toEqual({ field: 'battery', op: '>=', threshold: 0.9 });
+    expect(parseCondition(' altitude <= -1.5 ')).toEqual({ field: 'altitude', op: '<=', threshold: -1.5 });
+    for (const op of CONDITION_OPS) {
+      expect(parseCondition(`speed ${op} 2`)?.op).toBe(op);
+    }
+  });
+
+  it('rejects event conditions, unknown fields and malformed numbers', () => {
+    expect(parseCondition('operator_link_lost')).toBeNull();
+    expect(parseCondition('wind < 3')).toBeNull();
+    expect(parseCondition('battery < 0.1.2')).toBeNull();
+    expect(parseCondition('battery < ')).toBeNull();
+  });
+});
+
+describe('compareCondition', () => {
+  it('applies each operator and never matches NaN', () => {
+    const results = CONDITION_OPS.map((_, op) => compareCondition(op, 1, 2));
+    expect(results).toEqual([true, true, false, false, false, true]);
+    expect(CONDITION_OPS.map((_, op) => compareCondition(op, NaN, 2))).toEqual([false, false, false, false, false, false]);
+  });
+});
+
+describe('compileForcedExits', () => {
+  it('lays out each pattern\'s numeric exits in order, skipping events and unknown targets', () => {
+    const catalog: BehavioralCatalog = { patterns: new Map(), compatibility: [] };
+    for (const p of [
+      makePattern('b-hover', [
+        ['operator_link_lost', 'a-land'],
+        ['battery < 0.1', 'a-land'],
+        ['altitude > 9', 'gone'],
+        ['speed > 4', 'b-hover'],
+      ]),
+      makePattern('a-land', []),
+    ]) {
+      catalog.patterns.set(p.id, p);
+    }
+    const index = buildPatternIdMap(catalog);
+    const table = compileForcedExits(catalog, index);
+    const hover = index.get('b-hover')!;
+
+    expect(Array.from(table.start)).toEqual([0, 0, 2]);
+    expect(table.start[hover + 1] - table.start[hover]).toBe(2);
+    expect(Array.from(table.field)).toEqual([CONDITION_FIELDS.indexOf('battery'), CONDITION_FIELDS.indexOf('speed')]);
+    expect(Array.from(table.op)).toEqual([CONDITION_OPS.indexOf('<'), CONDITION_OPS.indexOf('>')]);
+    expect(Array.from(table.threshold)).toEqual([0.1, 4]);
+    expect(Array.from(table.target)).toEqual([index.get('a-land'), hover]);
+    expect(table.ids[table.target[0]]).toBe('a-land');
+  });
+});
@@ -0,0 +1,134 @@
+/**
+ * Seshat Swarm — Forced-Exit Conditions
+ *
+ * Parses the condition strings in patterns' postconditions.forced_exits
+ * ("battery < 0.10", "speed >= 3") and compiles a whole catalog's worth
+ * into a ForcedExitTable, so the coordinator evaluates thresholds read
+ * from typed arrays rather than re-parsing strings every tick.
+ *
+ * Grammar: `<field> <op> <number>`, with the fields and operators below.
+ * Anything else is an event condition the coordinator cannot observe and
+ * never fires.
+ */
+
+import type { BehavioralCatalog, ForcedExitTable } from './types.js';
+
+// ---------------------------------------------------------------------------
+// Fields and Operators
+// ---------------------------------------------------------------------------
+
+/**
+ * Telemetry a condition can test:
+ *   battery          — state of charge (0-1)
+ *   position_quality — positioning confidence (0-1)
+ *   flight_remaining — onboard flight-time forecast (s); 0 = unknown, never fires
+ *   altitude         — position z (m)
+ *   speed            — |velocity| (m/s)
+ */
+export const CONDITION_FIELDS = [
+  'battery',
+  'position_quality',
+  'flight_remaining',
+  'altitude',
+  'speed',
+] as const;
+
+export type ConditionField = (typeof CONDITION_FIELDS)[number];
+
+export const CONDITION_OPS = ['<', '<=', '>', '>=', '==', '!='] as const;
+
+export type ConditionOp = (typeof CONDITION_OPS)[number];
+
+/** A parsed numeric condition. */
+export interface ParsedCondition {
+  field: ConditionField;
+  op: ConditionOp;
+  threshold: number;
+}
+
+const CONDITION_RE = /^\s*(\w+)\s*(<=|>=|==|!=|<|>)\s*(-?\d+(?:\.\d*)?|-?\.\d+)\s*$/;
+
+/** Parse a condition string, or null if it is not a numeric comparison. */
+export function parseCondition(condition: string): ParsedCondition | null {
+  const match = CONDITION_RE.exec(condition);
+  if (!match) return null;
+  const field = match[1] as ConditionField;
+  if (!CONDITION_FIELDS.includes(field)) return null;
+  return { field, op: match[2] as ConditionOp, threshold: parseFloat(match[3]) };
+}
+
+/**
+ * Apply operator `op` (a CONDITION_OPS index). NaN values (unknown
+ * telemetry) satisfy no condition.
+ */
+export function compareCondition(op: number, value: number, threshold: number): boolean {
+  if (Number.isNaN(value)) return false;
+  switch (op) {
+    case 0: return value < threshold;
+    case 1: return value <= threshold;
+    case 2: return value > threshold;
+    case 3: return value >= threshold;
+    case 4: return value === threshold;
+    case 5: return value !== threshold;
+    default: return false;
+  }
+}
+
+// ---------------------------------------------------------------------------
+// Compilation
+// ---------------------------------------------------------------------------
+
+/**
+ * Parse every pattern's forced exits into a ForcedExitTable whose rows
+ * follow `index` (unified numeric pattern IDs). Exits to a pattern not in
+ * the catalog are left out: the coordinator could not switch to it.
+ */
+export function compileForcedExits(
+  catalog: BehavioralCatalog,
+  index: Map<string, number>,
+): ForcedExitTable {
+  const ids = Array.from(index.keys());
+  if (ids.length > 0x10000) {
+    throw new Error(`Too many patterns to compile forced exits: ${ids.length}`);
+  }
+  const rows: ParsedCondition[][] = [];
+  const rowTargets: number[][] = [];
+  for (const id of ids) {
+    const parsed: ParsedCondition[] = [];
+    const targets: number[] = [];
+    for (const exit of catalog.patterns.get(id)!.postconditions.forced_exits) {
+      const condition = parseCondition(exit.condition);
+      const target = index.get(exit.target_pattern);
+      if (!condition || target === undefined) continue;
+      parsed.push(condition);
+      targets.push(target);
+    }
+    rows.push(parsed);
+    rowTargets.push(targets);
+  }
+
+  const count = rows.reduce((sum, row) => sum + row.length, 0);
+  const table: ForcedExitTable = {
+    index,
+    ids,
+    start: new Uint32Array(rows.length + 1),
+    field: new Uint8Array(count),
+    op: new Uint8Array(count),
+    threshold: new Float64Array(count),
+    target: new Uint16Array(count),
+  };
+
+  let i = 0;
+  rows.forEach((row, r) => {
+    table.start[r] = i;
+    row.forEach((condition, k) => {
+      table.field[i] = CONDITION_FIELDS.indexOf(condition.field);
+      table.op[i] = CONDITION_OPS.indexOf(condition.op);
+      table.threshold[i] = condition.threshold;
+      table.target[i] = rowTargets[r][k];
+      i++;
+    });
+  });
+  table.start[rows.length] = i;
+  return table;
+}
@@ -10,6 +10,12 @@ import {
   isCompatible,
   isPatternTransitionValid,
   matchesPattern,
+  buildPatternIdMap,
+  compileCompatibility,
+  compileTransitions,
+  compileCoreIndex,
+  nextTransitionHop,
+  planTransition,
 } from './lookup.js';
 
 // ---------------------------------------------------------------------------
@@ -298,6 +304,32 @@ describe('lookupPattern', () => {
   });
 });
 
+describe('buildPatternIdMap', () => {
+  let catalog: BehavioralCatalog;
+
+  beforeEach(() => {
+    catalog = makeMockCatalog();
+  });
+
+  it('numbers all patterns densely in sorted string-ID order', () => {
+    const idMap = buildPatternIdMap(catalog);
+    const sorted = Array.from(catalog.patterns.keys()).sort((a, b) => a.localeCompare(b));
+    expect(idMap.size).toBe(catalog.patterns.size);
+    sorted.forEach((id, i) => expect(idMap.get(id)).toBe(i));
+  });
+
+  it('restricts the ID space to one hardware target', () => {
+    const idMap = buildPatternIdMap(catalog, 'sim-gazebo');
+    const simIds = filterByCore(catalog, { rho: 'sim-gazebo' })
+      .map((p) => p.id)
+      .sort((a, b) => a.localeCompare(b));
+    expect(simIds.length).toBeGreaterThan(0);
+    expect(idMap.size).toBe(simIds.length);
+    simIds.forEach((id, i) => expect(idMap.get(id)).toBe(i));
+    expect(idMap.has('hover-auto-performer')).toBe(false);
+  });
+});
+
 describe('filterByCore', () => {
   let catalog: BehavioralCatalog;
 
@@ -363,6 +395,42 @@ describe('filterByCore', () => {
     expect(exclusivePatterns.length).toBe(1);
     expect(exclusivePatterns[0].id).toBe('hover-auto-leader');
   });
+
+  it('answers from the core index exactly as the scan does, in catalog order', () => {
+    const indexed = makeMockCatalog();
+    indexed.coreIndex = compileCoreIndex(indexed);
+    const queries = [
+      {},
+      { sigma: 'hover' as const },
+      { rho: 'sim-gazebo' as const },
+      { sigma: 'hover' as const, chi: 'performer' as const },
+      { kappa: 'emergency' as const, rho: 'sim-gazebo' as const },
+      { sigma: 'orbit' as const, kappa: 'emergency' as const },
+    ];
+    for (const query of queries) {
+      expect(filterByCore(indexed, query).map((p) => p.id), JSON.stringify(query))
+        .toEqual(filterByCore(catalog, query).map((p) => p.id));
+    }
+  });
+
+  it('returns nothing from the core index for a value no pattern has', () => {
+    const indexed = makeMockCatalog();
+    indexed.coreIndex = compileCoreIndex(indexed);
+    expect(filterByCore(indexed, { sigma: 'dock' })).toEqual([]);
+    expect(indexed.coreIndex.counts.sigma.get('hover')).toBe(3);
+  });
+
+  it('crosses word boundaries in the core index', () => {
+    const big: BehavioralCatalog = { patterns: new Map(), compatibility: [] };
+    for (let i = 0; i < 70; i++) {
+      const p = makePattern({ id: `p${i}`, sigma: i % 3 === 0 ? 'orbit' : 'hover' });
+      big.patterns.set(p.id, p);
+    }
+    const expected = filterByCore(big, { sigma: 'orbit' }).map((p) => p.id);
+    big.coreIndex = compileCoreIndex(big);
+    expect(filterByCore(big, { sigma: 'orbit' }).map((p) => p.id)).toEqual(expected);
+    expect(expected).toHaveLength(24);
+  });
 });
 
 describe('isCompatible', () => {
@@ -510,6 +578,44 @@ describe('isCompatible', () => {
   });
 });
 
+describe('compileCompatibility', () => {
+  it('agrees with the rule scan for every pattern pair', () => {
+    const scanned = makeMockCatalog();
+    const compiled = makeMockCatalog();
+    compiled.compatibilityTable = compileCompatibility(compiled);
+    const ids = Array.from(scanned.patterns.keys());
+
+    for (const a of ids) {
+      for (const b of ids) {
+        for (const separation of [0, 0.2, 0.3, 0.4, 0.5, 1.0, 100]) {
+          expect(isCompatible(compiled, a, b, separation), `${a} / ${b} @ ${separation}`)
+            .toBe(isCompatible(scanned, a, b, separation));
+        }
+      }
+    }
+  });
+
+  it('keeps the earlier rule when two are equally specific', () => {
+    const catalog = makeMockCatalog();
+    catalog.compatibility = [
+      { pattern_a: 'hover-*', pattern_b: '*-performer', compatible: true, min_separation_m: 2.0 },
+      { pattern_a: '*-performer', pattern_b: 'hover-*', compatible: false, min_separation_m: 0 },
+    ];
+    const table = compileCompatibility(catalog);
+    const a = table.index.get('hover-auto-performer')!;
+    const b = table.index.get('orbit-auto-performer')!;
+    expect(table.cells[a * table.size + b]).toBe(1);
+    expect(table.minSeparation[table.cells[b * table.size + a]]).toBe(2.0);
+  });
+
+  it('falls back to the rules for patterns outside the catalog', () => {
+    const catalog = makeMockCatalog();
+    catalog.compatibilityTable = compileCompatibility(catalog);
+    expect(isCompatible(catalog, 'orbit-unknown', 'orbit-auto-performer', 0.8)).toBe(false);
+    expect(isCompatible(catalog, 'orbit-unknown', 'orbit-auto-performer', 1.0)).toBe(true);
+  });
+});
+
 describe('isPatternTransitionValid', () => {
   let catalog: BehavioralCatalog;
 
@@ -602,6 +708,60 @@ describe('isPatternTransitionValid', () => {
   });
 });
 
+describe('compileTransitions', () => {
+  it('agrees with the list and σ checks for every pattern pair', () => {
+    const scanned = makeMockCatalog();
+    const compiled = makeMockCatalog();
+    compiled.transitionGraph = compileTransitions(compiled);
+    const ids = [...scanned.patterns.keys(), 'grounded-auto-performer'];
+
+    for (const from of ids) {
+      for (const to of ids) {
+        expect(isPatternTransitionValid(compiled, from, to), `${from} -> ${to}`)
+          .toBe(isPatternTransitionValid(scanned, from, to));
+      }
+    }
+  });
+
+  it('answers the next hop on a shortest chain of valid transitions', () => {
+    const catalog = makeMockCatalog();
+    catalog.transitionGraph = compileTransitions(catalog);
+    expect(nextTransitionHop(catalog, 'takeoff-auto-performer', 'orbit-auto-performer'))
+      .toBe('hover-auto-performer');
+    expect(nextTransitionHop(catalog, 'hover-auto-performer', 'orbit-auto-performer'))
+      .toBe('orbit-auto-performer');
+    expect(planTransition(catalog, 'translate-auto-performer', 'land-auto-performer'))
+      .toEqual(['hover-auto-performer', 'land-auto-performer']);
+  });
+
+  it('builds the next-hop table only when a transition is planned', () => {
+    const catalog = makeMockCatalog();
+    catalog.transitionGraph = compileTransitions(catalog);
+    expect(catalog.transitionGraph.nextHop).toBeUndefined();
+    planTransition(catalog, 'takeoff-auto-performer', 'orbit-auto-performer');
+    expect(catalog.transitionGraph.nextHop).toHaveLength(catalog.transitionGraph.size ** 2);
+  });
+
+  it('compiles a catalog without a graph once', () => {
+    const catalog = makeMockCatalog();
+    expect(nextTransitionHop(catalog, 'hover-auto-performer', 'orbit-auto-performer'))
+      .toBe('orbit-auto-performer');
+
+    // The graph compiled on the first call is kept, so later edits are not seen
+    catalog.patterns.get('hover-auto-performer')!.postconditions.valid_to = [];
+    expect(planTransition(catalog, 'hover-auto-performer', 'orbit-auto-performer'))
+      .toEqual(['orbit-auto-performer']);
+    expect(catalog.transitionGraph).toBeUndefined();
+  });
+
+  it('reports unreachable and unknown targets as null', () => {
+    const catalog = makeMockCatalog();
+    expect(nextTransitionHop(catalog, 'land-auto-performer', 'takeoff-auto-performer')).toBeNull();
+    expect(planTransition(catalog, 'hover-auto-performer', 'hover-auto-leader')).toBeNull();
+    expect(nextTransitionHop(catalog, 'hover-auto-performer', 'no-such-pattern')).toBeNull();
+  });
+});
+
 describe('loadCatalog', () => {
   let tempDir: string;
 
@@ -689,6 +849,9 @@ describe('loadCatalog', () => {
     const catalog = loadCatalog(tempDir);
     expect(catalog.compatibility).toHaveLength(1);
     expect(catalog.compatibility[0].min_separation_m).toBe(0.5);
+    expect(catalog.compatibilityTable!.size).toBe(1);
+    expect(Array.from(catalog.compatibilityTable!.cells)).toEqual([1]);
+    expect(catalog.transitionGraph!.size).toBe(1);
   });
 
   it('returns empty compatibility when compatibility-matrix.json is missing', () => {
@@ -13,12 +13,16 @@
 
 import { readFileSync, readdirSync } from 'node:fs';
 import { join } from 'node:path';
-import type { CorePattern } from '../types/dimensions.js';
+import type { CorePattern, HardwareTarget } from '../types/dimensions.js';
 import { findTransitionRule } from '../types/transitions.js';
+import { compileForcedExits } from './forced-exits.js';
 import type {
   BehavioralPattern,
   CompatibilityRule,
   BehavioralCatalog,
+  CompatibilityTable,
+  TransitionGraph,
+  CoreIndex,
 } from './types.js';
 
 // ---------------------------------------------------------------------------
@@ -30,7 +34,14 @@ import type {
  *
  * Reads all `*.pattern.json` files from `{catalogDir}/patterns/` and the
  * `{catalogDir}/compatibility-matrix.json` file. Builds an indexed Map
- * for O(1) lookup by pattern ID.
+ * for O(1) lookup by pattern ID and compiles the compatibility table,
+ * transition graph, core-dimension index and forced-exit conditions.
+ *
+ * The compatibility table is the one structure that grows with the square
+ * of the catalog: two bytes per pattern pair, plus one more while it is
+ * compiled. At 15,000 patterns that is about 450 MB resident and 675 MB
+ * at peak. The transition graph costs one bit per pair; its shortest-path
+ * table (two bytes per pair) is only built if a transition is planned.
  *
  * @param catalogDir — path to the catalog root directory
  * @returns The fully loaded and indexed BehavioralCatalog
@@ -63,7 +74,13 @@ export function loadCatalog(catalogDir: string): BehavioralCatalog {
     compatibility = [];
   }
 
-  return { patterns, compatibility };
+  const catalog: BehavioralCatalog = { patterns, compatibility };
+  const index = buildPatternIdMap(catalog);
+  catalog.compatibilityTable = compileCompatibility(catalog, index);
+  catalog.transitionGraph = compileTransitions(catalog, index);
+  catalog.coreIndex = compileCoreIndex(catalog);
+  catalog.forcedExits = compileForcedExits(catalog, index);
+  return catalog;
 }
 
 // ---------------------------------------------------------------------------
@@ -84,10 +101,73 @@ export function lookupPattern(
   return catalog.patterns.get(id) ?? null;
 }
 
+// ---------------------------------------------------------------------------
+// Onboard Pattern IDs
+// ---------------------------------------------------------------------------
+
+/**
+ * Build the string → numeric pattern ID map for an onboard catalog.
+ *
+ * Mirrors scripts/compile-catalog.ts: patterns are sorted by string ID and
+ * numbered 0..N-1. With a `rho`, only that hardware target's patterns are
+ * numbered, matching a `compile-catalog --rho` flash image. Without one,
+ * the map covers the unified (all-target) build.
+ */
+export function buildPatternIdMap(
+  catalog: BehavioralCatalog,
+  rho?: HardwareTarget,
+): Map<string, number> {
+  const ids: string[] = [];
+  for (const pattern of catalog.patterns.values()) {
+    if (rho === undefined || pattern.core.rho === rho) {
+      ids.push(pattern.id);
+    }
+  }
+  ids.sort((a, b) => a.localeCompare(b));
+
+  const idMap = new Map<string, number>();
+  for (let i = 0; i < ids.length; i++) {
+    idMap.set(ids[i], i);
+  }
+  return idMap;
+}
+
 // ---------------------------------------------------------------------------
 // Filtering by Core Dimensions
 // ---------------------------------------------------------------------------
 
+const CORE_DIMENSIONS: readonly (keyof CorePattern)[] = ['sigma', 'kappa', 'chi', 'lambda', 'tau', 'rho'];
+
+/**
+ * Build the bitmap index over the core dimensions: one bitset of patterns
+ * per value seen in each dimension, with its population count.
+ */
+export function compileCoreIndex(catalog: BehavioralCatalog): CoreIndex {
+  const patterns = Array.from(catalog.patterns.values());
+  const words = (patterns.length + 31) >>> 5;
+  const bitsets = {} as CoreIndex['bitsets'];
+  const counts = {} as CoreIndex['counts'];
+  for (const dim of CORE_DIMENSIONS) {
+    bitsets[dim] = new Map();
+    counts[dim] = new Map();
+  }
+
+  patterns.forEach((pattern, i) => {
+    for (const dim of CORE_DIMENSIONS) {
+      const value = pattern.core[dim];
+      let bits = bitsets[dim].get(value);
+      if (!bits) {
+        bits = new Uint32Array(words);
+        bitsets[dim].set(value, bits);
+      }
+      bits[i >>> 5] |= 1 << (i & 31);
+      counts[dim].set(value, (counts[dim].get(value) ?? 0) + 1);
+    }
+  });
+
+  return { patterns, words, bitsets, counts };
+}
+
 /**
  * Filter catalog patterns by a partial core specification.
  *
@@ -95,6 +175,8 @@ export function lookupPattern(
  * (partial = { sigma: 'hover', rho: 'crazyflie-2.1' }).
  *
  * Every field in the partial spec must match; fields not specified are ignored.
+ * With a core index the specified dimensions' bitsets are ANDed, rarest
+ * first; otherwise every pattern is compared.
  *
  * @param catalog — the loaded catalog
  * @param partial — partial CorePattern spec; only specified fields are checked
@@ -104,6 +186,8 @@ export function filterByCore(
   catalog: BehavioralCatalog,
   partial: Partial<CorePattern>,
 ): BehavioralPattern[] {
+  if (catalog.coreIndex) return queryCoreIndex(catalog.coreIndex, partial);
+
   const results: BehavioralPattern[] = [];
 
   for (const pattern of catalog.patterns.values()) {
@@ -136,6 +220,33 @@ export function filterByCore(
   return results;
 }
 
+/** filterByCore over the bitmap index. Results are in catalog order. */
+function queryCoreIndex(index: CoreIndex, partial: Partial<CorePattern>): BehavioralPattern[] {
+  const terms: Array<{ bits: Uint32Array; count: number }> = [];
+  for (const dim of CORE_DIMENSIONS) {
+    const value = partial[dim];
+    if (value === undefined) continue;
+    const bits = index.bitsets[dim].get(value);
+    if (!bits) return [];
+    terms.push({ bits, count: index.counts[dim].get(value)! });
+  }
+  if (terms.length === 0) return index.patterns.slice();
+  terms.sort((a, b) => a.count - b.count);
+
+  const results: BehavioralPattern[] = [];
+  const first = terms[0].bits;
+  for (let w = 0; w < index.words; w++) {
+    let word = first[w];
+    for (let t = 1; t < terms.length && word !== 0; t++) word &= terms[t].bits[w];
+    while (word !== 0) {
+      const low = word & -word;
+      results.push(index.patterns[(w << 5) + 31 - Math.clz32(low)]);
+      word ^= low;
+    }
+  }
+  return results;
+}
+
 // ---------------------------------------------------------------------------
 // Compatibility Checking
 // ---------------------------------------------------------------------------
@@ -226,6 +337,57 @@ function ruleSpecificity(rule: CompatibilityRule): number {
   return score;
 }
 
+/**
+ * Resolve the compatibility rules for every pair of catalog patterns.
+ *
+ * Gives the same answer as scanning the rules per pair (most specific
+ * wins, earlier rule on a tie, no rule = compatible), but each rule's
+ * wildcards are matched once per pattern rather than once per query.
+ * Cost is O(rules × patterns) matches plus one pass over the pairs each
+ * rule covers; memory is two bytes per pair.
+ */
+export function compileCompatibility(
+  catalog: BehavioralCatalog,
+  index: Map<string, number> = buildPatternIdMap(catalog),
+): CompatibilityTable {
+  const ids = Array.from(index.keys());
+  const size = ids.length;
+  const rules = catalog.compatibility;
+  if (rules.length >= 0xffff) {
+    throw new Error(`Too many compatibility rules to compile: ${rules.length}`);
+  }
+
+  const cells = new Uint16Array(size * size);
+  const specificity = new Int8Array(size * size).fill(-1);
+  const minSeparation = new Float64Array(rules.length + 1);
+
+  rules.forEach((rule, r) => {
+    minSeparation[r + 1] = rule.compatible ? rule.min_separation_m : Infinity;
+    const spec = ruleSpecificity(rule);
+    const matchA: number[] = [];
+    const matchB: number[] = [];
+    for (let i = 0; i < size; i++) {
+      if (matchesPattern(ids[i], rule.pattern_a)) matchA.push(i);
+      if (matchesPattern(ids[i], rule.pattern_b)) matchB.push(i);
+    }
+    const claim = (cell: number): void => {
+      if (spec > specificity[cell]) {
+        specificity[cell] = spec;
+        cells[cell] = r + 1;
+      }
+    };
+    // Rules are bidirectional: (a, b) and (b, a) get the same cell
+    for (const a of matchA) {
+      for (const b of matchB) {
+        claim(a * size + b);
+        claim(b * size + a);
+      }
+    }
+  });
+
+  return { index, size, cells, minSeparation };
+}
+
 /**
  * Check whether two patterns are compatible at a given separation distance.
  *
@@ -240,6 +402,9 @@ function ruleSpecificity(rule: CompatibilityRule): number {
  * If no rule matches at all, the patterns are considered compatible
  * (open-world assumption — only explicitly incompatible pairs are blocked).
  *
+ * With a compiled table and both patterns in the catalog this is one
+ * table read; otherwise the rules are scanned.
+ *
  * @returns true if compatible at the given separation, false otherwise
  */
 export function isCompatible(
@@ -248,6 +413,15 @@ export function isCompatible(
   patternB: string,
   separation_m: number,
 ): boolean {
+  const table = catalog.compatibilityTable;
+  if (table) {
+    const a = table.index.get(patternA);
+    const b = table.index.get(patternB);
+    if (a !== undefined && b !== undefined) {
+      return separation_m >= table.minSeparation[table.cells[a * table.size + b]];
+    }
+  }
+
   // Find all matching rules (check both orderings since rules are bidirectional)
   let bestRule: CompatibilityRule | null = null;
   let bestSpecificity = -1;
@@ -286,6 +460,86 @@ export function isCompatible(
 // Transition Validation
 // ---------------------------------------------------------------------------
 
+/** nextHop value for a target that cannot be reached. */
+export const NO_TRANSITION_HOP = 0xffff;
+
+/**
+ * Build the transition graph: a successor bitset per pattern, whose edges
+ * are exactly the pairs isPatternTransitionValid accepts. Memory is one
+ * bit per pair. The shortest-path table (nextHop) is left for
+ * transitionHops to build on first use.
+ */
+export function compileTransitions(
+  catalog: BehavioralCatalog,
+  index: Map<string, number> = buildPatternIdMap(catalog),
+): TransitionGraph {
+  const ids = Array.from(index.keys());
+  const size = ids.length;
+  const words = (size + 31) >>> 5;
+  const successors = new Uint32Array(size * words);
+
+  for (let from = 0; from < size; from++) {
+    for (const toId of catalog.patterns.get(ids[from])!.postconditions.valid_to) {
+      const to = index.get(toId);
+      if (to === undefined || !transitionAllowed(catalog, ids[from], toId)) continue;
+      successors[from * words + (to >>> 5)] |= 1 << (to & 31);
+    }
+  }
+
+  return { index, ids, size, words, successors };
+}
+
+/**
+ * The graph's nextHop table, built on first call by a breadth-first search
+ * from every pattern over the successor bitsets. Cost is
+ * O(patterns × (patterns + edges)); memory is two bytes per pair, about
+ * 450 MB at 15,000 patterns, which is why loadCatalog does not build it.
+ */
+function transitionHops(graph: TransitionGraph): Uint16Array {
+  if (graph.nextHop) return graph.nextHop;
+  const { size, words, successors } = graph;
+  if (size >= NO_TRANSITION_HOP) {
+    throw new Error(`Too many patterns to plan transitions: ${size}`);
+  }
+
+  const edges: number[][] = [];
+  for (let from = 0; from < size; from++) {
+    const out: number[] = [];
+    for (let w = 0; w < words; w++) {
+      let bits = successors[from * words + w];
+      while (bits !== 0) {
+        const low = bits & -bits;
+        out.push((w << 5) + 31 - Math.clz32(low));
+        bits ^= low;
+      }
+    }
+    edges.push(out);
+  }
+
+  const nextHop = new Uint16Array(size * size).fill(NO_TRANSITION_HOP);
+  const queue = new Int32Array(size);
+  for (let source = 0; source < size; source++) {
+    const row = source * size;
+    let head = 0;
+    let tail = 0;
+    for (const to of edges[source]) {
+      nextHop[row + to] = to;
+      queue[tail++] = to;
+    }
+    while (head < tail) {
+      const at = queue[head++];
+      for (const to of edges[at]) {
+        if (nextHop[row + to] !== NO_TRANSITION_HOP) continue;
+        nextHop[row + to] = nextHop[row + at];
+        queue[tail++] = to;
+      }
+    }
+  }
+
+  graph.nextHop = nextHop;
+  return nextHop;
+}
+
 /**
  * Check whether transitioning from one pattern to another is valid.
  *
@@ -295,12 +549,29 @@ export function isCompatible(
  *  3. The sigma-level transition (fromPattern.core.sigma -> toPattern.core.sigma)
  *     is valid according to the transition matrix
  *
- * If either pattern is not in the catalog, returns false.
+ * If either pattern is not in the catalog, returns false. With a compiled
+ * transition graph this is one bit test.
  */
 export function isPatternTransitionValid(
   catalog: BehavioralCatalog,
   fromId: string,
   toId: string,
+): boolean {
+  const graph = catalog.transitionGraph;
+  if (graph) {
+    const from = graph.index.get(fromId);
+    const to = graph.index.get(toId);
+    if (from === undefined || to === undefined) return false;
+    return (graph.successors[from * graph.words + (to >>> 5)] & (1 << (to & 31))) !== 0;
+  }
+  return transitionAllowed(catalog, fromId, toId);
+}
+
+/** isPatternTransitionValid from the pattern lists and σ rules alone. */
+function transitionAllowed(
+  catalog: BehavioralCatalog,
+  fromId: string,
+  toId: string,
 ): boolean {
   const fromPattern = catalog.patterns.get(fromId);
   const toPattern = catalog.patterns.get(toId);
@@ -330,3 +601,64 @@ export function isPatternTransitionValid(
 
   return true;
 }
+
+/**
+ * Transition graphs compiled for catalogs loaded without one (hand-built),
+ * so their nextHop table is also built once. Like loadCatalog's tables,
+ * they are not updated if the catalog is edited afterwards.
+ */
+const compiledTransitionGraphs = new WeakMap<BehavioralCatalog, TransitionGraph>();
+
+function transitionGraphFor(catalog: BehavioralCatalog): TransitionGraph {
+  if (catalog.transitionGraph) return catalog.transitionGraph;
+  let graph = compiledTransitionGraphs.get(catalog);
+  if (!graph) {
+    graph = compileTransitions(catalog);
+    compiledTransitionGraphs.set(catalog, graph);
+  }
+  return graph;
+}
+
+/**
+ * First pattern to switch to on a shortest chain of valid transitions
+ * from `fromId` to `toId`, or null if there is no such chain (or either
+ * pattern is unknown). O(1) once the graph's nextHop table is built (on
+ * the first call); a catalog without a graph is compiled on first use.
+ */
+export function nextTransitionHop(
+  catalog: BehavioralCatalog,
+  fromId: string,
+  toId: string,
+): string | null {
+  const graph = transitionGraphFor(catalog);
+  const from = graph.index.get(fromId);
+  const to = graph.index.get(toId);
+  if (from === undefined || to === undefined) return null;
+  const hop = transitionHops(graph)[from * graph.size + to];
+  return hop === NO_TRANSITION_HOP ? null : graph.ids[hop];
+}
+
+/**
+ * A shortest chain of valid transitions from `fromId` to `toId`, listing
+ * each pattern after `fromId` and ending with `toId`; null if unreachable.
+ */
+export function planTransition(
+  catalog: BehavioralCatalog,
+  fromId: string,
+  toId: string,
+): string[] | null {
+  const graph = transitionGraphFor(catalog);
+  let at = graph.index.get(fromId);
+  const to = graph.index.get(toId);
+  if (at === undefined || to === undefined) return null;
+
+  // Each hop is itself on a shortest path, so this walks at most size steps
+  const nextHop = transitionHops(graph);
+  const path: string[] = [];
+  do {
+    at = nextHop[at * graph.size + to];
+    if (at === NO_TRANSITION_HOP) return null;
+    path.push(graph.ids[at]);
+  } while (at !== to);
+  return path;
+}
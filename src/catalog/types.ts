@@ -14,6 +14,7 @@ import type {
   PhysicalTraits,
   HardwareTarget,
   GeneratorType,
+  CorePattern,
 } from '../types/dimensions.js';
 
 // ---------------------------------------------------------------------------
@@ -84,6 +85,15 @@ export interface SimResults {
   min_clearance_m: number;
 }
 
+/** In-flight usage totals (optional, filled by scripts/merge-pattern-stats.ts). */
+export interface FlightResults {
+  /** Drone-flights that used the pattern */
+  flights: number;
+  entries: number;
+  time_s: number;
+  energy_j: number;
+}
+
 /** Offline verification results. */
 export interface PatternVerification {
   /** Verification status */
@@ -102,6 +112,8 @@ export interface PatternVerification {
   verified_transitions: string[];
   /** Simulation test results */
   sim_results?: SimResults;
+  /** Measured in flight */
+  flight_results?: FlightResults;
 }
 
 /**
@@ -156,4 +168,110 @@ export interface BehavioralCatalog {
   patterns: Map<string, BehavioralPattern>;
   /** Compatibility rules */
   compatibility: CompatibilityRule[];
+  /**
+   * The rules resolved for every pattern pair (see compileCompatibility).
+   * Built by loadCatalog; recompile after editing patterns or rules.
+   */
+  compatibilityTable?: CompatibilityTable;
+  /**
+   * Valid pattern transitions (see compileTransitions).
+   * Built by loadCatalog; recompile after editing patterns.
+   */
+  transitionGraph?: TransitionGraph;
+  /**
+   * Bitmap index of patterns by core dimension value (see compileCoreIndex).
+   * Built by loadCatalog; recompile after editing patterns.
+   */
+  coreIndex?: CoreIndex;
+  /**
+   * Every pattern's forced exits, parsed (see compileForcedExits).
+   * Built by loadCatalog; recompile after editing patterns.
+   */
+  forcedExits?: ForcedExitTable;
+}
+
+/**
+ * Dense pattern × pattern compatibility, with the most-specific-wins rule
+ * already resolved for each pair.
+ */
+export interface CompatibilityTable {
+  /** Row/column of each pattern, numbered as buildPatternIdMap (unified) */
+  index: Map<string, number>;
+  /** Number of patterns (rows) */
+  size: number;
+  /**
+   * Winning rule per pair, `size × size` row-major: 0 when no rule
+   * matches, otherwise the rule's position in `compatibility` plus one.
+   */
+  cells: Uint16Array;
+  /**
+   * Minimum separation in meters per cell value: 0 for no rule (open
+   * world), Infinity for an incompatible rule. A pair is compatible at
+   * separation s iff s >= minSeparation[cell].
+   */
+  minSeparation: Float64Array;
+}
+
+/**
+ * Pattern transition graph: one successor bitset per pattern and, once
+ * nextTransitionHop or planTransition has needed it, for every (from, to)
+ * pair the first step of a shortest valid path.
+ */
+export interface TransitionGraph {
+  /** Row/column of each pattern, numbered as buildPatternIdMap (unified) */
+  index: Map<string, number>;
+  /** Pattern ID per row */
+  ids: string[];
+  /** Number of patterns (rows) */
+  size: number;
+  /** Uint32 words per successor row */
+  words: number;
+  /** Bit `to` of row `from` is set iff isPatternTransitionValid(from, to) */
+  successors: Uint32Array;
+  /**
+   * `size × size` row-major: the pattern to switch to first on a shortest
+   * path from → to, or NO_TRANSITION_HOP if `to` is unreachable. Built on
+   * first use (two bytes per pair).
+   */
+  nextHop?: Uint16Array;
+}
+
+/**
+ * Inverted index over the six core dimensions: for each dimension value,
+ * a bitset of the patterns that have it. Patterns are numbered in
+ * catalog (Map) order, so query results keep the order of a full scan.
+ */
+export interface CoreIndex {
+  /** Pattern per bit position */
+  patterns: BehavioralPattern[];
+  /** Uint32 words per bitset */
+  words: number;
+  /** dimension → value → patterns with that value */
+  bitsets: { [K in keyof CorePattern]: Map<string, Uint32Array> };
+  /** Population count of each bitset, same shape as `bitsets` */
+  counts: { [K in keyof CorePattern]: Map<string, number> };
+}
+
+/**
+ * Forced-exit conditions parsed into parallel typed arrays. Pattern row r
+ * owns predicates start[r] .. start[r + 1] - 1, in the order listed in
+ * its postconditions; the first one that holds wins. Conditions that are
+ * not numeric comparisons (events such as "operator_link_lost") are left
+ * out, since the coordinator cannot evaluate them from telemetry, as are
+ * exits to patterns the catalog does not have.
+ */
+export interface ForcedExitTable {
+  /** Row of each pattern, numbered as buildPatternIdMap (unified) */
+  index: Map<string, number>;
+  /** Pattern ID per row */
+  ids: string[];
+  /** Predicate offsets per row; length = patterns + 1 */
+  start: Uint32Array;
+  /** CONDITION_FIELDS index per predicate */
+  field: Uint8Array;
+  /** CONDITION_OPS index per predicate */
+  op: Uint8Array;
+  threshold: Float64Array;
+  /** Target pattern's row */
+  target: Uint16Array;
 }
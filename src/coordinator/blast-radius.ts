@@ -18,7 +18,33 @@
  */
 
 import type { WorldModel, DroneState } from './world-model.js';
-import type { NeighborGraph } from '../types/dimensions.js';
+import { SlotSet } from './drone-registry.js';
+
+// ---------------------------------------------------------------------------
+// Affected Set
+// ---------------------------------------------------------------------------
+
+/**
+ * Affected drones, tracked by registry slot for membership and by ID (in
+ * insertion order) for the result handed back to callers.
+ */
+class AffectedSet {
+  readonly slots: SlotSet;
+  readonly order: number[] = [];
+  readonly ids: Set<string> = new Set();
+  private readonly world: WorldModel;
+
+  constructor(world: WorldModel) {
+    this.world = world;
+    this.slots = new SlotSet(world.registry.capacity);
+  }
+
+  add(slot: number): void {
+    if (!this.slots.add(slot)) return;
+    this.order.push(slot);
+    this.ids.add(this.world.droneAt(slot)!.id);
+  }
+}
 
 // ---------------------------------------------------------------------------
 // Single-Drone Blast Radius
@@ -47,59 +73,54 @@ export function computeBlastRadius(
   changedDroneId: string,
   world: WorldModel,
 ): Set<string> {
-  const affected = new Set<string>();
-
-  // 1. Always include the changed drone itself
-  affected.add(changedDroneId);
-
   const drone = world.getDrone(changedDroneId);
-  if (!drone) return affected;
-
-  const graph = drone.coordinate.epsilon;
-
-  // 2. Add all spatial neighbors
-  for (const neighborId of graph.neighbors) {
-    affected.add(neighborId);
-  }
+  if (!drone) return new Set([changedDroneId]);
 
-  // 3. Add role dependents
-  addRoleDependents(affected, drone, graph);
-
-  return affected;
+  const affected = new AffectedSet(world);
+  forEachInRadius(world, drone, (slot) => affected.add(slot));
+  return affected.ids;
 }
 
 /**
- * Add role-dependent drones to the affected set based on the drone's
- * formation role (chi) and neighbor graph relationships.
+ * Visit the drone, its spatial neighbors and its role dependents, by slot.
+ * A drone may be visited more than once.
  */
-function addRoleDependents(
-  affected: Set<string>,
+function forEachInRadius(
+  world: WorldModel,
   drone: DroneState,
-  graph: NeighborGraph,
+  visit: (slot: number) => void,
 ): void {
+  // 1. Always include the changed drone itself
+  visit(drone.slot);
+
+  // 2. Add all spatial neighbors
+  for (const neighbor of world.neighborSlots(drone.slot)) {
+    visit(neighbor);
+  }
+
+  // 3. Add role dependents
+  const dependent = (id: string | null): void => {
+    const slot = id === null ? undefined : world.registry.slotOf(id);
+    if (slot !== undefined) visit(slot);
+  };
+  const graph = drone.coordinate.epsilon;
   const role = drone.coordinate.chi;
 
   // Leader change affects all followers
   if (role === 'leader') {
     for (const followerId of graph.followers) {
-      affected.add(followerId);
+      dependent(followerId);
     }
   }
 
   // Follower change affects the leader
-  if (role === 'follower' && graph.leader !== null) {
-    affected.add(graph.leader);
-  }
+  if (role === 'follower') dependent(graph.leader);
 
   // Relay change affects relay target
-  if (role === 'relay' && graph.relay_target !== null) {
-    affected.add(graph.relay_target);
-  }
+  if (role === 'relay') dependent(graph.relay_target);
 
   // If someone relays for this drone, they are affected too
-  if (graph.relay_source !== null) {
-    affected.add(graph.relay_source);
-  }
+  dependent(graph.relay_source);
 }
 
 // ---------------------------------------------------------------------------
@@ -132,52 +153,56 @@ export function computeCascadingBlastRadius(
   world: WorldModel,
   wouldChangePattern?: (droneId: string) => boolean,
 ): Set<string> {
-  const affected = new Set<string>();
+  const affected = new AffectedSet(world);
+  const capacity = world.registry.capacity;
 
-  // Phase 1: Compute blast radius for each initially changed drone
+  // Phase 1: Compute blast radius for each initially changed drone.
+  // IDs unknown to the world model count as their own blast radius.
   for (const droneId of changedDroneIds) {
-    const radius = computeBlastRadius(droneId, world);
-    for (const id of radius) {
-      affected.add(id);
-    }
+    const drone = world.getDrone(droneId);
+    if (drone) forEachInRadius(world, drone, (slot) => affected.add(slot));
+    else affected.ids.add(droneId);
   }
 
   // Phase 2: Cascade -- if callback is provided, check newly affected drones
-  if (!wouldChangePattern) return affected;
+  if (!wouldChangePattern) return affected.ids;
 
   // Track which drones have already been evaluated for cascade
-  const evaluated = new Set<string>(changedDroneIds);
-  // Queue of drones to evaluate for cascade (newly affected, not yet evaluated)
-  let frontier = new Set<string>();
-  for (const id of affected) {
-    if (!evaluated.has(id)) {
-      frontier.add(id);
-    }
+  const evaluated = new SlotSet(capacity);
+  for (const droneId of changedDroneIds) {
+    const slot = world.registry.slotOf(droneId);
+    if (slot !== undefined) evaluated.add(slot);
   }
+  // Queue of drones to evaluate for cascade (newly affected, not yet evaluated)
+  let frontier = affected.order.filter((slot) => !evaluated.has(slot));
+  let inFrontier = new SlotSet(capacity);
+  for (const slot of frontier) inFrontier.add(slot);
 
   // Iterate until no new drones are added. Bounded by total drone count.
-  while (frontier.size > 0) {
-    const nextFrontier = new Set<string>();
+  while (frontier.length > 0) {
+    const nextFrontier: number[] = [];
+    const inNextFrontier = new SlotSet(capacity);
 
-    for (const droneId of frontier) {
-      evaluated.add(droneId);
+    for (const slot of frontier) {
+      evaluated.add(slot);
+      const drone = world.droneAt(slot)!;
 
-      if (wouldChangePattern(droneId)) {
+      if (wouldChangePattern(drone.id)) {
         // This drone would change pattern -- expand its blast radius
-        const cascadeRadius = computeBlastRadius(droneId, world);
-        for (const id of cascadeRadius) {
+        forEachInRadius(world, drone, (id) => {
           affected.add(id);
           // If this is a newly discovered drone (not already evaluated and
           // not in the current frontier being processed), add to next frontier
-          if (!evaluated.has(id) && !frontier.has(id)) {
-            nextFrontier.add(id);
+          if (!evaluated.has(id) && !inFrontier.has(id) && inNextFrontier.add(id)) {
+            nextFrontier.push(id);
           }
-        }
+        });
       }
     }
 
     frontier = nextFrontier;
+    inFrontier = inNextFrontier;
   }
 
-  return affected;
+  return affected.ids;
 }
@@ -1,5 +1,22 @@
 import { describe, it, expect, vi, afterEach } from 'vitest';
-import { SimComms, CmdFlags, TelemFlags, type SimDrone, type DroneTelemetry } from './comms.js';
+import {
+  SimComms,
+  CmdFlags,
+  TelemFlags,
+  decodeDiagnosticsPacket,
+  decodeHealthStatus,
+  decodeHealthPacket,
+  decodeEventPacket,
+  encodeEventAck,
+  DIAGNOSTICS_PACKET_SIZE,
+  EVENT_PACKET_SIZE,
+  UPLINK_EVENT_ACK,
+  HEALTH_PACKET_SIZE,
+  HealthBits,
+  type SimDrone,
+  type DroneTelemetry,
+  type DroneEvent,
+} from './comms.js';
 import type { SensorState } from '../types/dimensions.js';
 
 function makeSimDrone(id: string, x = 0, y = 0, z = 1, battery = 0.8): SimDrone {
@@ -169,3 +186,154 @@ describe('CflibBridge — stub', () => {
     await expect(bridge.connect(['d1'])).rejects.toThrow('not implemented');
   });
 });
+
+describe('decodeDiagnosticsPacket', () => {
+  function packet(probeId: number, ticksPerUs: number): Uint8Array {
+    const bytes = new Uint8Array(DIAGNOSTICS_PACKET_SIZE);
+    const view = new DataView(bytes.buffer);
+    view.setUint8(0, 0x01);
+    view.setUint8(1, probeId);
+    view.setUint16(2, ticksPerUs, true);
+    view.setUint32(4, 500, true);      // count
+    view.setUint32(8, 168, true);      // min
+    view.setUint32(12, 3360, true);    // max
+    view.setUint32(16, 336, true);     // mean
+    bytes.set([0, 204, 51, 0, 0, 0, 0, 0], 20);
+    return bytes;
+  }
+
+  it('decodes ticks to microseconds using the packet tick rate', () => {
+    const d = decodeDiagnosticsPacket(packet(4, 168))!;
+    expect(d.probe).toBe('gen:velocity-track');
+    expect(d.count).toBe(500);
+    expect(d.minUs).toBeCloseTo(1);
+    expect(d.meanUs).toBeCloseTo(2);
+    expect(d.maxUs).toBeCloseTo(20);
+    expect(d.histogram[1]).toBeCloseTo(0.8);
+    expect(d.histogramUpperUs[0]).toBeCloseTo(256 / 168);
+    expect(d.histogramUpperUs[7]).toBe(Infinity);
+  });
+
+  it('names unknown probes by id', () => {
+    expect(decodeDiagnosticsPacket(packet(200, 1000))!.probe).toBe('probe-200');
+  });
+
+  it('rejects short, mistagged or zero-rate packets', () => {
+    expect(decodeDiagnosticsPacket(packet(0, 168).subarray(0, 20))).toBeNull();
+    const wrongKind = packet(0, 168);
+    wrongKind[0] = 0x7f;
+    expect(decodeDiagnosticsPacket(wrongKind)).toBeNull();
+    expect(decodeDiagnosticsPacket(packet(0, 0))).toBeNull();
+  });
+});
+
+describe('health decoding', () => {
+  it('treats a clear valid bit as no report', () => {
+    expect(decodeHealthStatus(0)).toBeNull();
+    expect(decodeHealthStatus(HealthBits.OVERRUN)).toBeNull();
+  });
+
+  it('unpacks the health byte fields', () => {
+    const byte = HealthBits.VALID | HealthBits.CMD_GAP | (2 << HealthBits.JITTER_SHIFT) | (5 << HealthBits.CMD_AGE_SHIFT);
+    expect(decodeHealthStatus(byte)).toEqual({
+      overrun: false,
+      commandGap: true,
+      jitterLevel: 2,
+      commandAgeMs: 80,
+    });
+  });
+
+  it('decodes a HealthPacket', () => {
+    const bytes = new Uint8Array(HEALTH_PACKET_SIZE);
+    const view = new DataView(bytes.buffer);
+    view.setUint8(0, 0x02);
+    view.setUint8(1, HealthBits.VALID | HealthBits.OVERRUN);
+    view.setUint16(2, 2000, true);
+    view.setUint32(4, 123456, true);
+    view.setUint16(8, 3, true);
+    view.setUint16(10, 1, true);
+    view.setUint16(12, 700, true);
+    view.setUint16(16, 2500, true);
+    view.setUint16(22, 90, true);
+
+    const r = decodeHealthPacket(bytes)!;
+    expect(r.status.overrun).toBe(true);
+    expect(r.periodUs).toBe(2000);
+    expect(r.steps).toBe(123456);
+    expect(r.overruns).toBe(3);
+    expect(r.commandGaps).toBe(1);
+    expect(r.jitterMaxUs).toBe(700);
+    expect(r.execMaxUs).toBe(2500);
+    expect(r.commandGapMaxMs).toBe(90);
+
+    bytes[0] = 0x01;
+    expect(decodeHealthPacket(bytes)).toBeNull();
+  });
+});
+
+describe('priority events', () => {
+  it('decodes an event packet', () => {
+    const bytes = new Uint8Array(EVENT_PACKET_SIZE);
+    const view = new DataView(bytes.buffer);
+    bytes[0] = 0x05;
+    view.setUint8(1, 7);
+    view.setUint8(2, TelemFlags.AIRBORNE);
+    view.setUint8(3, TelemFlags.AIRBORNE | TelemFlags.LOW_BATTERY);
+    view.setUint8(4, 28);
+    view.setUint16(5, 12, true);
+    view.setInt16(7, 1500, true);
+    view.setInt16(9, -250, true);
+    view.setInt16(11, 1000, true);
+
+    const e = decodeEventPacket('d1', bytes)!;
+    expect(e.droneId).toBe('d1');
+    expect(e.seq).toBe(7);
+    expect(e.oldFlags).toBe(TelemFlags.AIRBORNE);
+    expect(e.newFlags).toBe(TelemFlags.AIRBORNE | TelemFlags.LOW_BATTERY);
+    expect(e.battery).toBeCloseTo(0.14, 5);
+    expect(e.patternId).toBe(12);
+    expect(e.position).toEqual({ x: 1.5, y: -0.25, z: 1 });
+
+    bytes[0] = 0x02;
+    expect(decodeEventPacket('d1', bytes)).toBeNull();
+    expect(decodeEventPacket('d1', bytes.subarray(0, 12))).toBeNull();
+  });
+
+  it('encodes the two-byte ack', () => {
+    expect(Array.from(encodeEventAck(300))).toEqual([UPLINK_EVENT_ACK, 44]);
+  });
+
+  it('SimComms raises events on EMERGENCY / LOW_BATTERY transitions only', () => {
+    const sim = new SimComms(1000);
+    sim.addSimDrone(makeSimDrone('d1', 0, 0, 1, 0.12));
+    const events: DroneEvent[] = [];
+    sim.onEvent((e) => events.push(e));
+
+    sim.setSimDroneFlags('d1', TelemFlags.AIRBORNE);
+    expect(events).toEqual([]);
+    sim.setSimDroneFlags('d1', TelemFlags.AIRBORNE | TelemFlags.LOW_BATTERY);
+    expect(events).toHaveLength(1);
+    expect(events[0]!.seq).toBe(0);
+    expect(events[0]!.battery).toBe(0.12);
+    expect(sim.pendingEvents('d1')).toHaveLength(1);
+  });
+
+  it('SimComms retransmits until acked', async () => {
+    const sim = new SimComms(1000);
+    sim.addSimDrone(makeSimDrone('d1'));
+    const seqs: number[] = [];
+    sim.onEvent((e) => seqs.push(e.seq));
+
+    sim.setSimDroneFlags('d1', TelemFlags.LOW_BATTERY);
+    sim.setSimDroneFlags('d1', TelemFlags.LOW_BATTERY | TelemFlags.EMERGENCY);
+    sim.broadcastTelemetry();
+    expect(seqs).toEqual([0, 1, 0, 1]);
+
+    await sim.ackEvent('d1', 0);
+    sim.broadcastTelemetry();
+    expect(seqs.slice(4)).toEqual([1]);
+    await sim.ackEvent('d1', 1);
+    sim.broadcastTelemetry();
+    expect(seqs).toHaveLength(5);
+  });
+});
@@ -6,9 +6,9 @@
  * hardware (CflibBridge). The coordinator doesn't care which.
  *
  * Packet sizes:
- *   Command (ground → drone): 20 bytes
- *   Telemetry (drone → ground): 18 bytes
- *   10 drones × 38 bytes × 100Hz = 38KB/s (well within radio capacity)
+ *   Command (ground → drone): 18 bytes
+ *   Telemetry (drone → ground): 23 bytes (one multiplexed ext slot per packet)
+ *   10 drones × 41 bytes × 100Hz = 41KB/s (well within radio capacity)
  */
 
 import type { SensorState, Vec3 } from '../types/dimensions.js';
@@ -27,6 +27,12 @@ export interface DroneCommand {
   targetVel: Vec3;
   /** Command flags */
   flags: number;
+  /**
+   * P2P ID of the drone to follow (GroundCommand.leader_id). With
+   * CmdFlags.LEADER_RELATIVE, targetPos is an offset from that drone's
+   * broadcast position rather than an absolute target.
+   */
+  leaderId?: number;
 }
 
 /** Drone → ground station telemetry. Matches TelemetryPacket in firmware/types.h. */
@@ -39,6 +45,26 @@ export interface DroneTelemetry {
   currentPatternId: number;
   /** Status flags */
   statusFlags: number;
+  /** Control-loop health byte (TelemetryPacket.health); 0 or absent if not reported */
+  health?: number;
+  /** Full SensorState.flags (SENSOR_FLAG_*), from the multiplexed ext slot */
+  sensorFlags?: number;
+  /** Longest gap between packets under the drone's adaptive rate (ms); absent = fixed rate */
+  maxIntervalMs?: number;
+  /**
+   * Onboard battery model behind state.battery.estimated_remaining (flight
+   * seconds left at the current pattern, 0 = unknown); absent until the
+   * forecast slot has arrived.
+   */
+  batteryForecast?: BatteryForecast;
+}
+
+/** Onboard battery model state (TELEM_EXT_FORECAST). */
+export interface BatteryForecast {
+  /** State of charge with voltage sag removed (0.0–1.0) */
+  restingSoc: number;
+  /** Estimated pack internal resistance (ohms); 0 until estimated */
+  resistanceOhm: number;
 }
 
 /** Command flag bits (matching CMD_FLAG_* in types.h). */
@@ -46,6 +72,9 @@ export const CmdFlags = {
   EMERGENCY: 1 << 0,
   STYLE_UPDATE: 1 << 1,
   FORCE_PATTERN: 1 << 2,
+  HISTORY_FREEZE: 1 << 3,
+  HISTORY_RELEASE: 1 << 4,
+  LEADER_RELATIVE: 1 << 5,
 } as const;
 
 /** Telemetry status flag bits (matching TELEM_FLAG_* in types.h). */
@@ -57,6 +86,639 @@ export const TelemFlags = {
   COMM_LOST: 1 << 4,
 } as const;
 
+// ---------------------------------------------------------------------------
+// Telemetry Decoding — Multiplexed Low-Rate Fields
+// ---------------------------------------------------------------------------
+
+/** Wire size of TelemetryPacket in firmware/types.h. */
+export const TELEMETRY_PACKET_SIZE = 23;
+
+/** Multiplexed ext slots (matching TELEM_EXT_* in types.h). */
+export const TelemExtSlot = {
+  ATTITUDE: 0,
+  YAW_POWER: 1,
+  DISCHARGE: 2,
+  FLAGS: 3,
+  FORECAST: 4,
+  COUNT: 5,
+  NONE: 0xff,
+} as const;
+
+/** Latest low-rate fields seen for one drone. */
+interface ExtFields {
+  orientation: Vec3;
+  voltage: number;
+  dischargeRate: number;
+  sensorFlags: number;
+  maxIntervalMs: number;
+  /** Flight seconds left at the current pattern; 0 until known */
+  remainingS: number;
+  /** Sag-compensated state of charge (0–1) and internal resistance (Ω) */
+  restingSoc: number;
+  resistanceOhm: number;
+  /** Bit i set once slot i has arrived */
+  seen: number;
+}
+
+const ALL_EXT_SLOTS = (1 << TelemExtSlot.COUNT) - 1;
+
+/** TELEM_EXT_FORECAST seconds before the drone has learned its power. */
+const FORECAST_UNKNOWN = 0xffff;
+
+/**
+ * Decodes TelemetryPackets and reassembles the multiplexed ext slots per
+ * drone. Every packet yields a full SensorState: the high-rate fields from
+ * the packet itself, the low-rate fields from the most recent slot of each
+ * kind (zero until first seen; see isComplete).
+ */
+export class TelemetryReassembler {
+  private ext: Map<string, ExtFields> = new Map();
+
+  /** Decode one packet. Returns null if it is too short. */
+  decode(droneId: string, bytes: Uint8Array): DroneTelemetry | null {
+    if (bytes.length < TELEMETRY_PACKET_SIZE) return null;
+    const view = new DataView(bytes.buffer, bytes.byteOffset, TELEMETRY_PACKET_SIZE);
+    const mm = (off: number): number => view.getInt16(off, true) / 1000;
+
+    let ext = this.ext.get(droneId);
+    if (!ext) {
+      ext = {
+        orientation: { x: 0, y: 0, z: 0 },
+        voltage: 0,
+        dischargeRate: 0,
+        sensorFlags: 0,
+        maxIntervalMs: 0,
+        remainingS: 0,
+        restingSoc: 0,
+        resistanceOhm: 0,
+        seen: 0,
+      };
+      this.ext.set(droneId, ext);
+    }
+    applyExtSlot(ext, view.getUint8(18), view);
+
+    return {
+      droneId,
+      state: {
+        position: { x: mm(0), y: mm(2), z: mm(4) },
+        velocity: { x: mm(6), y: mm(8), z: mm(10) },
+        orientation: { ...ext.orientation },
+        angular_velocity: { x: 0, y: 0, z: 0 },
+        battery: {
+          voltage: ext.voltage,
+          percentage: view.getUint8(12) / 200,
+          discharge_rate: ext.dischargeRate,
+          estimated_remaining: ext.remainingS,
+        },
+        position_quality: view.getUint8(16) / 255,
+        wind_estimate: { x: 0, y: 0, z: 0 },
+      },
+      currentPatternId: view.getUint16(13, true),
+      statusFlags: view.getUint8(15),
+      health: view.getUint8(17),
+      sensorFlags: ext.sensorFlags,
+      maxIntervalMs: ext.maxIntervalMs > 0 ? ext.maxIntervalMs : undefined,
+      batteryForecast: ext.seen & (1 << TelemExtSlot.FORECAST)
+        ? { restingSoc: ext.restingSoc, resistanceOhm: ext.resistanceOhm }
+        : undefined,
+    };
+  }
+
+  /** Whether every ext slot has arrived at least once for this drone. */
+  isComplete(droneId: string): boolean {
+    return ((this.ext.get(droneId)?.seen ?? 0) & ALL_EXT_SLOTS) === ALL_EXT_SLOTS;
+  }
+
+  /** Drop a drone's low-rate state (e.g. after a reboot). */
+  forget(droneId: string): void {
+    this.ext.delete(droneId);
+  }
+}
+
+function applyExtSlot(ext: ExtFields, slot: number, view: DataView): void {
+  const cdeg = (off: number): number => {
+    const raw = view.getInt16(off, true);
+    return raw === -32768 ? NaN : (raw * Math.PI) / 18000;
+  };
+  switch (slot) {
+    case TelemExtSlot.ATTITUDE:
+      ext.orientation.x = cdeg(19);
+      ext.orientation.y = cdeg(21);
+      break;
+    case TelemExtSlot.YAW_POWER:
+      ext.orientation.z = cdeg(19);
+      ext.voltage = view.getUint16(21, true) / 1000;
+      break;
+    case TelemExtSlot.DISCHARGE:
+      ext.dischargeRate = view.getUint16(19, true) / 100;
+      ext.maxIntervalMs = view.getUint16(21, true);
+      break;
+    case TelemExtSlot.FLAGS:
+      ext.sensorFlags = view.getUint32(19, true);
+      break;
+    case TelemExtSlot.FORECAST: {
+      const seconds = view.getUint16(19, true);
+      ext.remainingS = seconds === FORECAST_UNKNOWN ? 0 : seconds;
+      ext.restingSoc = view.getUint8(21) / 200;
+      ext.resistanceOhm = view.getUint8(22) * 0.004;
+      break;
+    }
+    default:
+      return;
+  }
+  ext.seen |= 1 << slot;
+}
+
+// ---------------------------------------------------------------------------
+// Extended Packets — Diagnostics
+// ---------------------------------------------------------------------------
+
+/** Extended packet kind tags (matching EXT_PACKET_* in types.h). */
+export const ExtPacketKind = {
+  DIAGNOSTICS: 0x01,
+  HEALTH: 0x02,
+  HISTORY_INFO: 0x03,
+  HISTORY_CHUNK: 0x04,
+  EVENT: 0x05,
+  PATTERN_STATS: 0x06,
+} as const;
+
+/** Wire size of DiagnosticsPacket in firmware/types.h. */
+export const DIAGNOSTICS_PACKET_SIZE = 28;
+
+/** Number of timing histogram buckets (DIAG_HIST_BUCKETS in types.h). */
+export const DIAG_HIST_BUCKETS = 8;
+
+/**
+ * Probe names indexed by PerfProbeId (firmware/perf_probes.h).
+ * Generator probes follow the GeneratorType order.
+ */
+export const PERF_PROBE_NAMES = [
+  'command-parse',
+  'catalog-lookup',
+  'telemetry-pack',
+  'gen:position-hold',
+  'gen:velocity-track',
+  'gen:waypoint-sequence',
+  'gen:relative-offset',
+  'gen:orbit-center',
+  'gen:trajectory-spline',
+  'gen:emergency-stop',
+  'gen:idle',
+] as const;
+
+/** Decoded per-probe timing statistics, in microseconds. */
+export interface ProbeDiagnostics {
+  probeId: number;
+  /** Name from PERF_PROBE_NAMES, or `probe-<id>` for unknown ids */
+  probe: string;
+  /** Samples since the drone last reset its statistics */
+  count: number;
+  minUs: number;
+  maxUs: number;
+  meanUs: number;
+  /**
+   * Share of samples per bucket (0..1). Bucket i holds durations below
+   * histogramUpperUs[i]; the last bucket is open-ended (Infinity).
+   */
+  histogram: number[];
+  histogramUpperUs: number[];
+}
+
+/**
+ * Decode a DiagnosticsPacket (little-endian, packed).
+ * Returns null if the buffer is not a diagnostics packet.
+ */
+export function decodeDiagnosticsPacket(bytes: Uint8Array): ProbeDiagnostics | null {
+  if (bytes.length < DIAGNOSTICS_PACKET_SIZE) return null;
+  if (bytes[0] !== ExtPacketKind.DIAGNOSTICS) return null;
+
+  const view = new DataView(bytes.buffer, bytes.byteOffset, DIAGNOSTICS_PACKET_SIZE);
+  const probeId = view.getUint8(1);
+  const ticksPerUs = view.getUint16(2, true);
+  if (ticksPerUs === 0) return null;
+
+  const histogram: number[] = [];
+  const histogramUpperUs: number[] = [];
+  for (let i = 0; i < DIAG_HIST_BUCKETS; i++) {
+    histogram.push(view.getUint8(20 + i) / 255);
+    histogramUpperUs.push(
+      i === DIAG_HIST_BUCKETS - 1 ? Infinity : (256 * 4 ** i) / ticksPerUs,
+    );
+  }
+
+  return {
+    probeId,
+    probe: PERF_PROBE_NAMES[probeId] ?? `probe-${probeId}`,
+    count: view.getUint32(4, true),
+    minUs: view.getUint32(8, true) / ticksPerUs,
+    maxUs: view.getUint32(12, true) / ticksPerUs,
+    meanUs: view.getUint32(16, true) / ticksPerUs,
+    histogram,
+    histogramUpperUs,
+  };
+}
+
+// ---------------------------------------------------------------------------
+// Extended Packets — Control-Loop Health
+// ---------------------------------------------------------------------------
+
+/** Health byte bits (matching HEALTH_STATUS_* in types.h). */
+export const HealthBits = {
+  OVERRUN: 1 << 0,
+  CMD_GAP: 1 << 1,
+  JITTER_SHIFT: 2,
+  CMD_AGE_SHIFT: 4,
+  CMD_AGE_UNIT_MS: 16,
+  VALID: 1 << 7,
+} as const;
+
+/** Wire size of HealthPacket in firmware/types.h. */
+export const HEALTH_PACKET_SIZE = 24;
+
+/** Decoded health byte: loop health since the drone's previous telemetry packet. */
+export interface HealthStatus {
+  /** A step overran its deadline */
+  overrun: boolean;
+  /** A gap between received commands exceeded the drone's limit */
+  commandGap: boolean;
+  /** Worst inter-step jitter: 0 <1/16, 1 <1/8, 2 <1/4, 3 >=1/4 of the period */
+  jitterLevel: number;
+  /** Worst command age at use, rounded down to 16 ms; 112 means >= 112 ms */
+  commandAgeMs: number;
+}
+
+/** Decoded HealthPacket. Counters are cumulative; max/mean cover one report window. */
+export interface HealthReport {
+  status: HealthStatus;
+  periodUs: number;
+  steps: number;
+  overruns: number;
+  commandGaps: number;
+  jitterMaxUs: number;
+  jitterMeanUs: number;
+  execMaxUs: number;
+  commandAgeMaxMs: number;
+  commandAgeMeanMs: number;
+  commandGapMaxMs: number;
+}
+
+/** Decode a health byte. Returns null when the drone reported none (valid bit clear). */
+export function decodeHealthStatus(byte: number): HealthStatus | null {
+  if ((byte & HealthBits.VALID) === 0) return null;
+  return {
+    overrun: (byte & HealthBits.OVERRUN) !== 0,
+    commandGap: (byte & HealthBits.CMD_GAP) !== 0,
+    jitterLevel: (byte >> HealthBits.JITTER_SHIFT) & 0x3,
+    commandAgeMs: ((byte >> HealthBits.CMD_AGE_SHIFT) & 0x7) * HealthBits.CMD_AGE_UNIT_MS,
+  };
+}
+
+/**
+ * Decode a HealthPacket (little-endian, packed).
+ * Returns null if the buffer is not a health packet.
+ */
+export function decodeHealthPacket(bytes: Uint8Array): HealthReport | null {
+  if (bytes.length < HEALTH_PACKET_SIZE) return null;
+  if (bytes[0] !== ExtPacketKind.HEALTH) return null;
+
+  const view = new DataView(bytes.buffer, bytes.byteOffset, HEALTH_PACKET_SIZE);
+  const status = decodeHealthStatus(view.getUint8(1));
+  if (!status) return null;
+
+  return {
+    status,
+    periodUs: view.getUint16(2, true),
+    steps: view.getUint32(4, true),
+    overruns: view.getUint16(8, true),
+    commandGaps: view.getUint16(10, true),
+    jitterMaxUs: view.getUint16(12, true),
+    jitterMeanUs: view.getUint16(14, true),
+    execMaxUs: view.getUint16(16, true),
+    commandAgeMaxMs: view.getUint16(18, true),
+    commandAgeMeanMs: view.getUint16(20, true),
+    commandGapMaxMs: view.getUint16(22, true),
+  };
+}
+
+// ---------------------------------------------------------------------------
+// Extended Packets — History Download
+// ---------------------------------------------------------------------------
+
+/** Freeze reasons (matching HISTORY_TRIGGER_* in types.h). */
+export const HISTORY_TRIGGER_NAMES = ['none', 'emergency', 'forced-exit', 'ground'] as const;
+
+/** Wire sizes from firmware/types.h. */
+export const HISTORY_SAMPLE_SIZE = 28;
+export const HISTORY_CHUNK_BYTES = 24;
+
+/** int16 sentinel the drone uses for NaN in history samples. */
+const HISTORY_NAN_I16 = -32768;
+
+/** One decoded onboard history sample. */
+export interface HistorySample {
+  /** Time relative to the trigger sample (ms; negative = before) */
+  tMs: number;
+  /** Meters */
+  position: Vec3;
+  /** m/s */
+  velocity: Vec3;
+  /** roll, pitch, yaw in radians */
+  orientation: Vec3;
+  /** Motor setpoints as commanded by the pattern executor */
+  setpoint: { roll: number; pitch: number; yawRate: number; thrust: number };
+  /** 0.0-1.0 */
+  battery: number;
+  /** SENSOR_FLAG_* low byte */
+  sensorFlags: number;
+}
+
+/** Metadata from a HistoryInfoPacket. */
+export interface HistoryCaptureInfo {
+  captureId: number;
+  trigger: string;
+  periodUs: number;
+  sampleCount: number;
+  triggerIndex: number;
+  chunkCount: number;
+}
+
+/**
+ * Reassembles one drone's frozen history capture from its download
+ * carousel. Chunks may arrive in any order, repeat, or precede the info
+ * packet; a packet with a new capture ID starts over. Once `complete`,
+ * send CMD_FLAG_HISTORY_RELEASE so the drone resumes recording.
+ */
+export class HistoryDownload {
+  private _info: HistoryCaptureInfo | null = null;
+  private captureId: number | null = null;
+  private chunks: Map<number, Uint8Array> = new Map();
+
+  /** Capture metadata, once the info packet has arrived. */
+  get info(): HistoryCaptureInfo | null {
+    return this._info;
+  }
+
+  /** Whether every chunk of the capture has arrived. */
+  get complete(): boolean {
+    return this._info !== null && this.chunks.size === this._info.chunkCount;
+  }
+
+  /**
+   * Feed one extended packet. Returns false if it is not a history
+   * packet, so callers can dispatch other kinds.
+   */
+  accept(bytes: Uint8Array): boolean {
+    const view = new DataView(bytes.buffer, bytes.byteOffset, bytes.length);
+    if (bytes[0] === ExtPacketKind.HISTORY_INFO && bytes.length >= 12) {
+      this.startCapture(view.getUint8(2));
+      this._info = {
+        captureId: view.getUint8(2),
+        trigger: HISTORY_TRIGGER_NAMES[view.getUint8(1)] ?? `trigger-${view.getUint8(1)}`,
+        periodUs: view.getUint16(4, true),
+        sampleCount: view.getUint16(6, true),
+        triggerIndex: view.getUint16(8, true),
+        chunkCount: view.getUint16(10, true),
+      };
+      if (view.getUint8(3) !== HISTORY_SAMPLE_SIZE) {
+        throw new Error(`History sample size ${view.getUint8(3)} != ${HISTORY_SAMPLE_SIZE}`);
+      }
+      return true;
+    }
+    if (bytes[0] === ExtPacketKind.HISTORY_CHUNK && bytes.length >= 4 + HISTORY_CHUNK_BYTES) {
+      this.startCapture(view.getUint8(1));
+      const index = view.getUint16(2, true);
+      if (!this._info || index < this._info.chunkCount) {
+        this.chunks.set(index, bytes.slice(4, 4 + HISTORY_CHUNK_BYTES));
+      }
+      return true;
+    }
+    return false;
+  }
+
+  /** Chunk indices still outstanding (empty until the info packet arrives). */
+  missingChunks(): number[] {
+    if (!this._info) return [];
+    const missing: number[] = [];
+    for (let i = 0; i < this._info.chunkCount; i++) {
+      if (!this.chunks.has(i)) missing.push(i);
+    }
+    return missing;
+  }
+
+  /** Decode the capture, oldest sample first. Throws if incomplete. */
+  samples(): HistorySample[] {
+    const info = this._info;
+    if (!info || !this.complete) throw new Error('History capture incomplete');
+
+    const stream = new Uint8Array(info.chunkCount * HISTORY_CHUNK_BYTES);
+    for (const [index, data] of this.chunks) stream.set(data, index * HISTORY_CHUNK_BYTES);
+    const view = new DataView(stream.buffer);
+
+    const i16 = (off: number, scale: number): number => {
+      const raw = view.getInt16(off, true);
+      return raw === HISTORY_NAN_I16 ? NaN : raw / scale;
+    };
+    const cdegToRad = Math.PI / 18000;
+
+    const out: HistorySample[] = [];
+    for (let s = 0; s < info.sampleCount; s++) {
+      const o = s * HISTORY_SAMPLE_SIZE;
+      out.push({
+        tMs: ((s - info.triggerIndex) * info.periodUs) / 1000,
+        position: { x: i16(o, 1000), y: i16(o + 2, 1000), z: i16(o + 4, 1000) },
+        velocity: { x: i16(o + 6, 1000), y: i16(o + 8, 1000), z: i16(o + 10, 1000) },
+        orientation: {
+          x: i16(o + 12, 1) * cdegToRad,
+          y: i16(o + 14, 1) * cdegToRad,
+          z: i16(o + 16, 1) * cdegToRad,
+        },
+        setpoint: {
+          roll: i16(o + 18, 100),
+          pitch: i16(o + 20, 100),
+          yawRate: i16(o + 22, 10),
+          thrust: view.getUint16(o + 24, true),
+        },
+        battery: view.getUint8(o + 26) / 200,
+        sensorFlags: view.getUint8(o + 27),
+      });
+    }
+    return out;
+  }
+
+  private startCapture(captureId: number): void {
+    if (this.captureId === captureId) return;
+    this.captureId = captureId;
+    this._info = null;
+    this.chunks.clear();
+  }
+}
+
+// ---------------------------------------------------------------------------
+// Extended Packets — Priority Events
+// ---------------------------------------------------------------------------
+
+/** Wire size of EventPacket (types.h). */
+export const EVENT_PACKET_SIZE = 13;
+
+/** Ground → drone event acknowledgement tag (UPLINK_EVENT_ACK in types.h). */
+export const UPLINK_EVENT_ACK = 0xe1;
+
+/** Status flags whose transitions raise events (EVENT_FLAG_MASK in types.h). */
+export const EVENT_FLAG_MASK = TelemFlags.EMERGENCY | TelemFlags.LOW_BATTERY;
+
+/**
+ * A priority flag-transition event. Matches EventPacket in firmware/types.h.
+ * The drone retransmits it until acknowledged, so the same seq may arrive
+ * more than once.
+ */
+export interface DroneEvent {
+  droneId: string;
+  /** Per-drone sequence number, modulo 256. */
+  seq: number;
+  /** TELEM_FLAG_* before the transition. */
+  oldFlags: number;
+  /** TELEM_FLAG_* after the transition. */
+  newFlags: number;
+  /** Battery fraction (0.0–1.0) when the transition happened. */
+  battery: number;
+  /** Pattern the drone was executing. */
+  patternId: number;
+  /** Position (meters) when the transition happened. */
+  position: Vec3;
+}
+
+/**
+ * Decode an EventPacket (little-endian, packed).
+ * Returns null if the buffer is not an event packet.
+ */
+export function decodeEventPacket(droneId: string, bytes: Uint8Array): DroneEvent | null {
+  if (bytes.length < EVENT_PACKET_SIZE) return null;
+  if (bytes[0] !== ExtPacketKind.EVENT) return null;
+
+  const view = new DataView(bytes.buffer, bytes.byteOffset, EVENT_PACKET_SIZE);
+  const mm = (off: number): number => view.getInt16(off, true) / 1000;
+  return {
+    droneId,
+    seq: view.getUint8(1),
+    oldFlags: view.getUint8(2),
+    newFlags: view.getUint8(3),
+    battery: view.getUint8(4) / 200,
+    patternId: view.getUint16(5, true),
+    position: { x: mm(7), y: mm(9), z: mm(11) },
+  };
+}
+
+/** Encode the EventAckPacket for one event. */
+export function encodeEventAck(seq: number): Uint8Array {
+  return Uint8Array.of(UPLINK_EVENT_ACK, seq & 0xff);
+}
+
+// ---------------------------------------------------------------------------
+// Extended Packets — Pattern Usage
+// ---------------------------------------------------------------------------
+
+/** Wire size of PatternStatsPacket (types.h). */
+export const PATTERN_STATS_PACKET_SIZE = 18;
+
+/** One pattern's usage on one drone since boot. Matches PatternStatsPacket. */
+export interface PatternUsage {
+  /** Numeric pattern ID (per-target catalog numbering) */
+  patternId: number;
+  /** Times the pattern was entered (saturates at 65535) */
+  entries: number;
+  timeS: number;
+  energyJ: number;
+  /** Peak |velocity| (m/s) */
+  peakSpeed: number;
+  /** Peak roll/pitch command (degrees) */
+  peakAttitudeDeg: number;
+}
+
+/**
+ * Decode a PatternStatsPacket (little-endian, packed).
+ * Returns null if the buffer is not a pattern stats packet.
+ */
+export function decodePatternStatsPacket(bytes: Uint8Array): PatternUsage | null {
+  if (bytes.length < PATTERN_STATS_PACKET_SIZE) return null;
+  if (bytes[0] !== ExtPacketKind.PATTERN_STATS) return null;
+
+  const view = new DataView(bytes.buffer, bytes.byteOffset, PATTERN_STATS_PACKET_SIZE);
+  return {
+    patternId: view.getUint16(2, true),
+    entries: view.getUint16(4, true),
+    timeS: view.getUint32(6, true) / 1000,
+    energyJ: view.getUint32(10, true) / 1000,
+    peakSpeed: view.getUint16(14, true) / 1000,
+    peakAttitudeDeg: view.getUint16(16, true) / 100,
+  };
+}
+
+/** Usage of one pattern in a dump file, keyed by string pattern ID. */
+export interface PatternUsageRecord {
+  entries: number;
+  time_s: number;
+  energy_j: number;
+  peak_speed_ms: number;
+  peak_attitude_deg: number;
+}
+
+/** One drone's usage for one flight, as merged by scripts/merge-pattern-stats.ts. */
+export interface PatternUsageDump {
+  droneId: string;
+  patterns: Record<string, PatternUsageRecord>;
+}
+
+/**
+ * Collects PatternStatsPackets per drone. Packets are cumulative since
+ * boot, so the latest one per pattern replaces any earlier one.
+ */
+export class PatternUsageCollector {
+  private usage: Map<string, Map<number, PatternUsage>> = new Map();
+
+  /** Feed one packet. Returns false if it is not a pattern stats packet. */
+  accept(droneId: string, bytes: Uint8Array): boolean {
+    const u = decodePatternStatsPacket(bytes);
+    if (!u) return false;
+    let perDrone = this.usage.get(droneId);
+    if (!perDrone) {
+      perDrone = new Map();
+      this.usage.set(droneId, perDrone);
+    }
+    perDrone.set(u.patternId, u);
+    return true;
+  }
+
+  /** Latest usage per pattern for one drone. */
+  usageFor(droneId: string): PatternUsage[] {
+    return Array.from(this.usage.get(droneId)?.values() ?? []);
+  }
+
+  /**
+   * Build the dump file for one drone. `idMap` is the string → numeric
+   * pattern ID map of the catalog the drone was flashed with; patterns
+   * not in it are left out.
+   */
+  dump(droneId: string, idMap: ReadonlyMap<string, number>): PatternUsageDump {
+    const byNumeric = new Map<number, string>();
+    for (const [id, n] of idMap) byNumeric.set(n, id);
+
+    const patterns: Record<string, PatternUsageRecord> = {};
+    for (const u of this.usageFor(droneId)) {
+      const id = byNumeric.get(u.patternId);
+      if (id === undefined) continue;
+      patterns[id] = {
+        entries: u.entries,
+        time_s: u.timeS,
+        energy_j: u.energyJ,
+        peak_speed_ms: u.peakSpeed,
+        peak_attitude_deg: u.peakAttitudeDeg,
+      };
+    }
+    return { droneId, patterns };
+  }
+}
+
 // ---------------------------------------------------------------------------
 // DroneComms Interface
 // ---------------------------------------------------------------------------
@@ -64,6 +726,9 @@ export const TelemFlags = {
 /** Callback for receiving telemetry from a drone. */
 export type TelemetryCallback = (telemetry: DroneTelemetry) => void;
 
+/** Callback for receiving priority events from a drone. */
+export type EventCallback = (event: DroneEvent) => void;
+
 /**
  * Abstract communication interface.
  * Implemented by SimComms (simulation) and CflibBridge (real hardware).
@@ -75,6 +740,15 @@ export interface DroneComms {
   /** Register a callback for incoming telemetry. */
   onTelemetry(callback: TelemetryCallback): void;
 
+  /**
+   * Register a callback for priority events. Events are delivered as soon
+   * as they arrive, ahead of routine telemetry, and repeat until acked.
+   */
+  onEvent(callback: EventCallback): void;
+
+  /** Acknowledge an event so the drone stops retransmitting it. */
+  ackEvent(droneId: string, seq: number): Promise<void>;
+
   /** Connect to a set of drones. */
   connect(droneIds: string[]): Promise<void>;
 
@@ -97,6 +771,10 @@ export interface SimDrone {
   statusFlags: number;
   /** Battery drain rate (percentage per second). */
   batteryDrainRate: number;
+  /** Health byte to report (HealthBits); omitted means no health monitor. */
+  health?: number;
+  /** Keepalive interval to advertise (ms); omitted means a fixed rate. */
+  maxIntervalMs?: number;
 }
 
 /**
@@ -108,6 +786,10 @@ export class SimComms implements DroneComms {
   private _connected = false;
   private _drones: Map<string, SimDrone> = new Map();
   private _callbacks: TelemetryCallback[] = [];
+  private _eventCallbacks: EventCallback[] = [];
+  /** Unacknowledged events per drone, oldest first. */
+  private _pendingEvents: Map<string, DroneEvent[]> = new Map();
+  private _nextEventSeq: Map<string, number> = new Map();
   private _telemetryInterval: ReturnType<typeof setInterval> | null = null;
 
   /** Telemetry broadcast rate in ms. */
@@ -143,6 +825,41 @@ export class SimComms implements DroneComms {
     }
   }
 
+  /**
+   * Set a simulated drone's status flags, as telemetry_build_flags would.
+   * An EMERGENCY or LOW_BATTERY transition raises an event, delivered at
+   * once and again on every telemetry broadcast until acknowledged.
+   */
+  setSimDroneFlags(droneId: string, flags: number): void {
+    const drone = this._drones.get(droneId);
+    if (!drone) return;
+
+    const oldFlags = drone.statusFlags;
+    drone.statusFlags = flags;
+    if (((oldFlags ^ flags) & EVENT_FLAG_MASK) === 0) return;
+
+    const seq = this._nextEventSeq.get(droneId) ?? 0;
+    this._nextEventSeq.set(droneId, (seq + 1) & 0xff);
+    const event: DroneEvent = {
+      droneId,
+      seq,
+      oldFlags,
+      newFlags: flags,
+      battery: drone.state.battery.percentage,
+      patternId: drone.currentPatternId,
+      position: { ...drone.state.position },
+    };
+    const pending = this._pendingEvents.get(droneId) ?? [];
+    pending.push(event);
+    this._pendingEvents.set(droneId, pending);
+    this.deliverEvent(event);
+  }
+
+  /** Events a simulated drone is still retransmitting. */
+  pendingEvents(droneId: string): readonly DroneEvent[] {
+    return this._pendingEvents.get(droneId) ?? [];
+  }
+
   async connect(droneIds: string[]): Promise<void> {
     // In sim mode, drones should already be added via addSimDrone.
     // Just verify they exist.
@@ -186,11 +903,27 @@ export class SimComms implements DroneComms {
     this._callbacks.push(callback);
   }
 
+  onEvent(callback: EventCallback): void {
+    this._eventCallbacks.push(callback);
+  }
+
+  async ackEvent(droneId: string, seq: number): Promise<void> {
+    const pending = this._pendingEvents.get(droneId);
+    if (!pending) return;
+    const i = pending.findIndex((e) => e.seq === seq);
+    if (i >= 0) pending.splice(i, 1);
+  }
+
   /**
    * Broadcast telemetry from all simulated drones.
    * Called automatically at telemetryRateMs intervals, or manually for tests.
+   * Unacknowledged events are retransmitted first, as on the drone.
    */
   broadcastTelemetry(): void {
+    for (const pending of this._pendingEvents.values()) {
+      for (const event of [...pending]) this.deliverEvent(event);
+    }
+
     for (const drone of this._drones.values()) {
       // Simulate battery drain
       drone.state.battery.percentage = Math.max(
@@ -203,6 +936,8 @@ export class SimComms implements DroneComms {
         state: { ...drone.state },
         currentPatternId: drone.currentPatternId,
         statusFlags: drone.statusFlags,
+        health: drone.health,
+        maxIntervalMs: drone.maxIntervalMs,
       };
 
       for (const cb of this._callbacks) {
@@ -210,6 +945,12 @@ export class SimComms implements DroneComms {
       }
     }
   }
+
+  private deliverEvent(event: DroneEvent): void {
+    for (const cb of this._eventCallbacks) {
+      cb({ ...event, position: { ...event.position } });
+    }
+  }
 }
 
 // ---------------------------------------------------------------------------
@@ -244,4 +985,12 @@ export class CflibBridge implements DroneComms {
   onTelemetry(_callback: TelemetryCallback): void {
     throw new Error('CflibBridge not implemented.');
   }
+
+  onEvent(_callback: EventCallback): void {
+    throw new Error('CflibBridge not implemented.');
+  }
+
+  async ackEvent(_droneId: string, _seq: number): Promise<void> {
+    throw new Error('CflibBridge not implemented.');
+  }
 }
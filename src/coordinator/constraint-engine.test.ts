@@ -1,5 +1,12 @@
 import { describe, it, expect } from 'vitest';
-import { solveAssignment, checkForcedExits } from './constraint-engine.js';
+import {
+  solveAssignment,
+  findForcedExit,
+  clearCandidateCache,
+  partitionAffected,
+} from './constraint-engine.js';
+import { compileForcedExits } from '../catalog/forced-exits.js';
+import { buildPatternIdMap } from '../catalog/lookup.js';
 import type { Assignment, SwarmObjective } from './constraint-engine.js';
 import { WorldModel } from './world-model.js';
 import type { DroneState } from './world-model.js';
@@ -347,16 +354,15 @@ function makeWorld(
 // Tests
 // ---------------------------------------------------------------------------
 
-describe('checkForcedExits', () => {
+describe('findForcedExit', () => {
   it('returns null when no conditions are met', () => {
     const catalog = makeTestCatalog();
     const world = makeWorld([
       { id: 'd1', pos: { x: 0, y: 0, z: 1 }, pattern: 'hover-auto-performer' },
     ]);
     const drone = world.getDrone('d1')!;
-    const pattern = catalog.patterns.get('hover-auto-performer')!;
 
-    expect(checkForcedExits(drone, pattern)).toBeNull();
+    expect(findForcedExit(catalog, world, drone)).toBeNull();
   });
 
   it('triggers battery forced exit when battery < 0.10', () => {
@@ -370,9 +376,8 @@ describe('checkForcedExits', () => {
       },
     ]);
     const drone = world.getDrone('d1')!;
-    const pattern = catalog.patterns.get('hover-auto-performer')!;
 
-    expect(checkForcedExits(drone, pattern)).toBe('emergency-land');
+    expect(findForcedExit(catalog, world, drone)).toBe('emergency-land');
   });
 
   it('triggers position quality forced exit', () => {
@@ -386,9 +391,8 @@ describe('checkForcedExits', () => {
       },
     ]);
     const drone = world.getDrone('d1')!;
-    const pattern = catalog.patterns.get('hover-auto-performer')!;
 
-    expect(checkForcedExits(drone, pattern)).toBe('emergency-land');
+    expect(findForcedExit(catalog, world, drone)).toBe('emergency-land');
   });
 
   it('returns the first matching forced exit', () => {
@@ -403,10 +407,9 @@ describe('checkForcedExits', () => {
       },
     ]);
     const drone = world.getDrone('d1')!;
-    const pattern = catalog.patterns.get('hover-auto-performer')!;
 
     // Both conditions met; returns the first one (battery < 0.10)
-    expect(checkForcedExits(drone, pattern)).toBe('emergency-land');
+    expect(findForcedExit(catalog, world, drone)).toBe('emergency-land');
   });
 
   it('returns null for pattern with no forced exits', () => {
@@ -420,9 +423,68 @@ describe('checkForcedExits', () => {
       },
     ]);
     const drone = world.getDrone('d1')!;
-    const pattern = catalog.patterns.get('translate-auto-performer')!;
 
-    expect(checkForcedExits(drone, pattern)).toBeNull();
+    expect(findForcedExit(catalog, world, drone)).toBeNull();
+  });
+
+  it('supports other comparators and fields, and ignores event conditions', () => {
+    const world = makeWorld([
+      { id: 'd1', pos: { x: 0, y: 0, z: 4 }, pattern: 'p', battery: 0.95 },
+    ]);
+    const drone = world.getDrone('d1')!;
+    const exits = (...conditions: string[]): BehavioralCatalog => {
+      const patterns = new Map<string, BehavioralPattern>();
+      patterns.set('p', makePattern({
+        id: 'p',
+        forced_exits: conditions.map((condition, i) => ({ condition, target_pattern: `t${i}` })),
+      }));
+      for (let i = 0; i < conditions.length; i++) patterns.set(`t${i}`, makePattern({ id: `t${i}` }));
+      return { patterns, compatibility: [] };
+    };
+
+    expect(findForcedExit(exits('operator_link_lost', 'battery >= 0.90'), world, drone)).toBe('t1');
+    expect(findForcedExit(exits('altitude <= 3.5', 'altitude > 3.5'), world, drone)).toBe('t1');
+    expect(findForcedExit(exits('speed > 0', 'position_quality != 0.95', 'warp < 1'), world, drone)).toBeNull();
+  });
+
+  it('skips exits whose target is not in the catalog', () => {
+    const catalog = makeTestCatalog();
+    catalog.patterns.get('hover-auto-performer')!.postconditions.forced_exits
+      .unshift({ condition: 'battery < 0.5', target_pattern: 'missing' });
+    const world = makeWorld([
+      { id: 'd1', pos: { x: 0, y: 0, z: 1 }, pattern: 'hover-auto-performer', battery: 0.05 },
+    ]);
+
+    expect(findForcedExit(catalog, world, world.getDrone('d1')!)).toBe('emergency-land');
+  });
+});
+
+describe('findForcedExit — compiled table', () => {
+  it('compiles a catalog without a table once, until the cache is cleared', () => {
+    const catalog = makeTestCatalog();
+    const world = makeWorld([
+      { id: 'low', pos: { x: 0, y: 0, z: 1 }, pattern: 'hover-auto-performer', battery: 0.05 },
+    ]);
+    const low = world.getDrone('low')!;
+    expect(findForcedExit(catalog, world, low)).toBe('emergency-land');
+
+    // Edits in place are not seen: the table compiled on the first call is kept
+    catalog.patterns.get('hover-auto-performer')!.postconditions.forced_exits = [];
+    expect(findForcedExit(catalog, world, low)).toBe('emergency-land');
+    expect(catalog.forcedExits).toBeUndefined();
+
+    clearCandidateCache(catalog);
+    expect(findForcedExit(catalog, world, low)).toBeNull();
+  });
+
+  it('reads the latest telemetry through the world store', () => {
+    const catalog = makeTestCatalog();
+    catalog.forcedExits = compileForcedExits(catalog, buildPatternIdMap(catalog));
+    const world = makeWorld([{ id: 'd1', pos: { x: 0, y: 0, z: 1 }, pattern: 'hover-auto-performer' }]);
+    expect(findForcedExit(catalog, world, world.getDrone('d1')!)).toBeNull();
+
+    world.updateTelemetry('d1', makeTelemetry({ x: 0, y: 0, z: 1 }, 0.08));
+    expect(findForcedExit(catalog, world, world.getDrone('d1')!)).toBe('emergency-land');
   });
 });
 
@@ -529,6 +591,61 @@ describe('solveAssignment — battery constraints', () => {
   });
 });
 
+describe('solveAssignment — candidate cache', () => {
+  // Drones start with no pattern so stability does not outweigh the objective
+  it('does not share candidates across battery bands', () => {
+    const catalog = makeTestCatalog();
+    const pos = { x: 0, y: 0, z: 1 };
+    const solve = (battery: number) => solveAssignment(
+      makeWorld([{ id: 'd1', pos, pattern: '', battery }]),
+      catalog,
+      new Set(['d1']),
+      [{ type: 'orbit' }],
+    )[0].patternId;
+
+    expect(catalog.patterns.get(solve(0.8))!.core.sigma).toBe('orbit');
+    // Orbit's battery_floor is 0.40: same key otherwise, different band
+    expect(catalog.patterns.get(solve(0.3))!.core.sigma).not.toBe('orbit');
+    expect(catalog.patterns.get(solve(0.8))!.core.sigma).toBe('orbit');
+  });
+
+  it('sees in-place catalog edits after clearCandidateCache', () => {
+    const catalog = makeTestCatalog();
+    const world = makeWorld([{ id: 'd1', pos: { x: 0, y: 0, z: 1 }, pattern: '' }]);
+    const solve = () =>
+      solveAssignment(world, catalog, new Set(['d1']), [{ type: 'orbit' }])[0].patternId;
+
+    const orbit = solve();
+    expect(catalog.patterns.get(orbit)!.core.sigma).toBe('orbit');
+
+    catalog.patterns.get(orbit)!.preconditions.battery_floor = 0.9;
+    clearCandidateCache(catalog);
+    expect(solve()).not.toBe(orbit);
+  });
+});
+
+describe('partitionAffected', () => {
+  it('groups affected drones linked through affected drones, in affected order', () => {
+    // a-b-c in a chain (commRange 5); x links c and d, but only joins
+    // their components when it is affected itself
+    const world = makeWorld([
+      { id: 'a', pos: { x: 0, y: 0, z: 1 }, pattern: 'hover-auto-performer' },
+      { id: 'b', pos: { x: 4, y: 0, z: 1 }, pattern: 'hover-auto-performer' },
+      { id: 'c', pos: { x: 8, y: 0, z: 1 }, pattern: 'hover-auto-performer' },
+      { id: 'x', pos: { x: 8, y: 4, z: 1 }, pattern: 'hover-auto-performer' },
+      { id: 'd', pos: { x: 8, y: 8, z: 1 }, pattern: 'hover-auto-performer' },
+    ]);
+
+    expect(partitionAffected(world, ['d', 'c', 'ghost', 'a', 'b'])).toEqual([
+      ['d'],
+      ['c', 'a', 'b'],
+    ]);
+    expect(partitionAffected(world, ['d', 'c', 'a', 'b', 'x'])).toEqual([
+      ['d', 'c', 'a', 'b', 'x'],
+    ]);
+  });
+});
+
 describe('solveAssignment — transition filtering', () => {
   it('invalid transition is filtered out (grounded cannot go to orbit)', () => {
     const catalog = makeTestCatalog();
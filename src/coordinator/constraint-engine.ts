@@ -15,21 +15,26 @@
  *
  * Complexity: O(|affected| x |catalog| x |neighbors|) per solve call.
  * With a 1,500-pattern catalog and 3 neighbors, this is microseconds.
+ * The catalog filters are memoized per drone configuration (see
+ * Candidate Cache), so in practice only compatibility and scoring run
+ * per drone.
  */
 
-import type { Vec3 } from '../types/dimensions.js';
+import type { Vec3, DroneCoordinate, NeighborGraph } from '../types/dimensions.js';
 import type {
   BehavioralPattern,
   BehavioralCatalog,
+  ForcedExitTable,
 } from '../catalog/types.js';
 import {
   filterByCore,
   isPatternTransitionValid,
   isCompatible,
-  lookupPattern,
+  buildPatternIdMap,
 } from '../catalog/lookup.js';
-import type { WorldModel, DroneState } from './world-model.js';
-import { vec3Distance } from './world-model.js';
+import { SlotSet } from './drone-registry.js';
+import type { WorldStore } from './world-store.js';
+import { compareCondition, compileForcedExits, CONDITION_FIELDS } from '../catalog/forced-exits.js';
 
 // ---------------------------------------------------------------------------
 // Public Types
@@ -52,53 +57,93 @@ export interface SwarmObjective {
   params?: Record<string, number>;
 }
 
+/**
+ * The drone fields the solver reads; everything else comes from the world
+ * store. Every DroneState is a SolverDrone.
+ */
+export interface SolverDrone {
+  id: string;
+  slot: number;
+  currentPattern: string;
+  coordinate: Pick<DroneCoordinate, 'chi' | 'tau' | 'rho'> & {
+    epsilon: Pick<NeighborGraph, 'neighbors' | 'base_stations'>;
+  };
+}
+
+/**
+ * The parts of the world the solver reads. WorldModel provides them; a
+ * solver worker provides them from a snapshot (see solver-pool).
+ */
+export interface SolverWorld {
+  readonly store: WorldStore;
+  getDrone(id: string): SolverDrone | undefined;
+  droneAt(slot: number): SolverDrone | undefined;
+  neighborSlots(slot: number): readonly number[];
+}
+
 // ---------------------------------------------------------------------------
 // Forced Exit Detection
 // ---------------------------------------------------------------------------
 
 /**
- * Check if a forced exit condition is met for a drone.
- * Returns the target pattern if a forced exit triggers, null otherwise.
+ * Forced-exit target for a drone's current pattern, or null: the target
+ * of the first of the pattern's forced exits whose condition holds, e.g.
+ *   - "battery < 0.10"         -> store battery below 10%
+ *   - "position_quality < 0.3" -> positioning confidence below 0.3
+ *   - "battery >= 0.90"        -> charged enough to leave the pad
  *
- * Parses simple condition strings:
- *   - "battery < 0.10"        -> checks drone.lastTelemetry.battery.percentage
- *   - "battery < 0.15"        -> same
- *   - "position_quality < 0.3" -> checks drone.lastTelemetry.position_quality
+ * Reads the catalog's ForcedExitTable against the world store's columns;
+ * a catalog without one is compiled on first use and the table kept.
  */
-export function checkForcedExits(
-  drone: DroneState,
-  pattern: BehavioralPattern,
+export function findForcedExit(
+  catalog: BehavioralCatalog,
+  world: SolverWorld,
+  drone: SolverDrone,
 ): string | null {
-  for (const exit of pattern.postconditions.forced_exits) {
-    if (evaluateCondition(exit.condition, drone)) {
-      return exit.target_pattern;
+  const table = catalog.forcedExits ?? forcedExitTableFor(catalog);
+  const row = table.index.get(drone.currentPattern);
+  if (row === undefined) return null;
+  const store = world.store;
+  for (let i = table.start[row]; i < table.start[row + 1]; i++) {
+    const value = storeConditionValue(table.field[i], store, drone.slot);
+    if (compareCondition(table.op[i], value, table.threshold[i])) {
+      return table.ids[table.target[i]];
     }
   }
   return null;
 }
 
-/**
- * Evaluate a simple condition string against drone state.
- *
- * Supported conditions:
- *   "battery < {threshold}"          -> battery.percentage < threshold
- *   "position_quality < {threshold}" -> position_quality < threshold
- */
-function evaluateCondition(condition: string, drone: DroneState): boolean {
-  const match = condition.match(/^(\w+)\s*<\s*([\d.]+)$/);
-  if (!match) return false;
+/** Tables compiled for catalogs loaded without one (hand-built). */
+const compiledForcedExits = new WeakMap<BehavioralCatalog, ForcedExitTable>();
 
-  const [, field, thresholdStr] = match;
-  const threshold = parseFloat(thresholdStr);
-  if (isNaN(threshold)) return false;
+function forcedExitTableFor(catalog: BehavioralCatalog): ForcedExitTable {
+  let table = compiledForcedExits.get(catalog);
+  if (!table) {
+    table = compileForcedExits(catalog, buildPatternIdMap(catalog));
+    compiledForcedExits.set(catalog, table);
+  }
+  return table;
+}
+
+const FIELD_BATTERY = CONDITION_FIELDS.indexOf('battery');
+const FIELD_POSITION_QUALITY = CONDITION_FIELDS.indexOf('position_quality');
+const FIELD_FLIGHT_REMAINING = CONDITION_FIELDS.indexOf('flight_remaining');
+const FIELD_ALTITUDE = CONDITION_FIELDS.indexOf('altitude');
+const FIELD_SPEED = CONDITION_FIELDS.indexOf('speed');
 
+/** A condition field's value (CONDITION_FIELDS index) from the world store. */
+function storeConditionValue(field: number, store: WorldStore, slot: number): number {
   switch (field) {
-    case 'battery':
-      return drone.lastTelemetry.battery.percentage < threshold;
-    case 'position_quality':
-      return drone.lastTelemetry.position_quality < threshold;
-    default:
-      return false;
+    case FIELD_BATTERY: return store.battery[slot]!;
+    case FIELD_POSITION_QUALITY: return store.positionQuality[slot]!;
+    case FIELD_FLIGHT_REMAINING: return store.flightRemaining[slot]! > 0 ? store.flightRemaining[slot]! : NaN;
+    case FIELD_ALTITUDE: return store.position[slot * 3 + 2]!;
+    case FIELD_SPEED: {
+      const i = slot * 3;
+      const v = store.velocity;
+      return Math.sqrt(v[i]! ** 2 + v[i + 1]! ** 2 + v[i + 2]! ** 2);
+    }
+    default: return NaN;
   }
 }
 
@@ -126,7 +171,8 @@ const OBJECTIVE_SIGMA_MAP: Record<SwarmObjective['type'], string> = {
  */
 function scoreCandidate(
   candidate: BehavioralPattern,
-  drone: DroneState,
+  drone: SolverDrone,
+  store: WorldStore,
   objectives: SwarmObjective[],
 ): number {
   let score = 0;
@@ -152,7 +198,7 @@ function scoreCandidate(
   // Battery penalty: penalize high-demand patterns when battery is low
   if (
     candidate.preconditions.battery_floor > 0.3 &&
-    drone.lastTelemetry.battery.percentage < 0.5
+    store.battery[drone.slot]! < 0.5
   ) {
     score -= 5;
   }
@@ -184,14 +230,14 @@ function scoreCandidate(
  * @returns Array of assignments for all affected drones
  */
 export function solveAssignment(
-  world: WorldModel,
+  world: SolverWorld,
   catalog: BehavioralCatalog,
   affectedDrones: Set<string>,
   objectives: SwarmObjective[],
 ): Assignment[] {
   const assignments: Assignment[] = [];
-  // Track what's been assigned so far for compatibility checking
-  const assignedPatterns: Map<string, string> = new Map();
+  // Track what's been assigned so far for compatibility checking, by slot
+  const assignedPatterns: Array<string | undefined> = [];
 
   for (const droneId of affectedDrones) {
     const drone = world.getDrone(droneId);
@@ -206,55 +252,68 @@ export function solveAssignment(
     );
 
     assignments.push(assignment);
-    assignedPatterns.set(droneId, assignment.patternId);
+    assignedPatterns[drone.slot] = assignment.patternId;
   }
 
   return assignments;
 }
 
+/**
+ * Split affected drones into the connected components of the ε graph
+ * restricted to the affected set. A drone's solve reads only its own state
+ * and its neighbors' patterns, and an unaffected neighbor's pattern never
+ * changes, so components can be solved independently: solving each one in
+ * affected order gives the same assignments as solveAssignment over all
+ * of them. Components are ordered by their first member; unknown IDs are
+ * dropped, as solveAssignment skips them.
+ */
+export function partitionAffected(world: SolverWorld, affectedDrones: Iterable<string>): string[][] {
+  const drones: SolverDrone[] = [];
+  const affected = new SlotSet(world.store.capacity);
+  for (const droneId of affectedDrones) {
+    const drone = world.getDrone(droneId);
+    if (!drone || !affected.add(drone.slot)) continue;
+    drones.push(drone);
+  }
+
+  const order = new Map<number, number>();
+  drones.forEach((drone, i) => order.set(drone.slot, i));
+
+  const components: string[][] = [];
+  const seen = new SlotSet(world.store.capacity);
+  for (const drone of drones) {
+    if (!seen.add(drone.slot)) continue;
+    const members = [drone.slot];
+    for (let i = 0; i < members.length; i++) {
+      for (const neighbor of world.neighborSlots(members[i]!)) {
+        if (affected.has(neighbor) && seen.add(neighbor)) members.push(neighbor);
+      }
+    }
+    members.sort((a, b) => order.get(a)! - order.get(b)!);
+    components.push(members.map((slot) => drones[order.get(slot)!]!.id));
+  }
+  return components;
+}
+
 /**
  * Solve for a single drone's pattern assignment.
  * Internal workhorse called by solveAssignment.
  */
 function solveForDrone(
-  drone: DroneState,
-  world: WorldModel,
+  drone: SolverDrone,
+  world: SolverWorld,
   catalog: BehavioralCatalog,
   objectives: SwarmObjective[],
-  assignedPatterns: Map<string, string>,
+  assignedPatterns: Array<string | undefined>,
 ): Assignment {
   // Step 1: Check forced exits from current pattern
-  const currentPattern = lookupPattern(catalog, drone.currentPattern);
-  if (currentPattern) {
-    const forcedTarget = checkForcedExits(drone, currentPattern);
-    if (forcedTarget !== null) {
-      const targetPattern = lookupPattern(catalog, forcedTarget);
-      if (targetPattern) {
-        return { droneId: drone.id, patternId: forcedTarget };
-      }
-    }
+  const forcedTarget = findForcedExit(catalog, world, drone);
+  if (forcedTarget !== null) {
+    return { droneId: drone.id, patternId: forcedTarget };
   }
 
-  // Step 2: Filter catalog by hardware (rho, tau)
-  const hardwareMatches = filterByCore(catalog, {
-    rho: drone.coordinate.rho,
-    tau: drone.coordinate.tau,
-  });
-
-  // Step 3: Filter by preconditions
-  const preconditionMatches = hardwareMatches.filter((p) =>
-    meetsPreconditions(p, drone),
-  );
-
-  // Step 4: Filter by valid transitions from current pattern
-  const transitionMatches = preconditionMatches.filter((p) => {
-    // If drone has no current pattern (initial state), allow all
-    if (!drone.currentPattern) return true;
-    // Same pattern is always a valid "transition" (staying put)
-    if (p.id === drone.currentPattern) return true;
-    // Check transition validity
-    return isPatternTransitionValid(catalog, drone.currentPattern, p.id);
-  });
+  // Steps 2-4: hardware, preconditions and transitions (memoized)
+  const transitionMatches = cachedCandidates(catalog, drone, world.store);
 
   // Step 5: Filter by pairwise compatibility with neighbor assignments
   const compatibleCandidates = transitionMatches.filter((p) =>
@@ -264,7 +323,7 @@ function solveForDrone(
   // Step 6: Score and select
   if (compatibleCandidates.length > 0) {
     const scored = compatibleCandidates
-      .map((p) => ({ pattern: p, score: scoreCandidate(p, drone, objectives) }))
+      .map((p) => ({ pattern: p, score: scoreCandidate(p, drone, world.store, objectives) }))
       .sort((a, b) => b.score - a.score);
 
     return {
@@ -290,6 +349,123 @@ function solveForDrone(
   return { droneId: drone.id, patternId: drone.currentPattern };
 }
 
+// ---------------------------------------------------------------------------
+// Candidate Cache
+// ---------------------------------------------------------------------------
+
+/**
+ * Steps 2-4 of solveForDrone depend only on (rho, tau, currentPattern)
+ * and on which precondition floors the drone's battery, position quality
+ * and reference count clear. Each of those is reduced to a band: how many
+ * of the catalog's distinct floors the value clears. Drones with the same
+ * key get the same candidate list, so a solve over many drones in a few
+ * configurations filters the catalog a few times, not once per drone.
+ *
+ * Caches hang off the catalog object: loading a catalog starts a fresh
+ * one. Call clearCandidateCache after editing a catalog in place.
+ */
+interface CandidateCache {
+  /** Distinct precondition floors, ascending */
+  batteryFloors: number[];
+  qualityFloors: number[];
+  minReferences: number[];
+  /** Steps 2-4 result per key; never mutated once stored */
+  candidates: Map<string, readonly BehavioralPattern[]>;
+  /** Fallbacks per (rho, tau) */
+  hover: Map<string, BehavioralPattern | null>;
+  emergency: Map<string, BehavioralPattern | null>;
+}
+
+const candidateCaches = new WeakMap<BehavioralCatalog, CandidateCache>();
+
+/**
+ * Drop the memoized candidate sets for a catalog edited in place, and the
+ * forced-exit table compiled for it if it was loaded without one.
+ */
+export function clearCandidateCache(catalog: BehavioralCatalog): void {
+  candidateCaches.delete(catalog);
+  compiledForcedExits.delete(catalog);
+}
+
+function candidateCacheFor(catalog: BehavioralCatalog): CandidateCache {
+  let cache = candidateCaches.get(catalog);
+  if (!cache) {
+    const distinct = (values: number[]): number[] =>
+      Array.from(new Set(values)).sort((a, b) => a - b);
+    const patterns = Array.from(catalog.patterns.values());
+    cache = {
+      batteryFloors: distinct(patterns.map((p) => p.preconditions.battery_floor)),
+      qualityFloors: distinct(patterns.map((p) => p.preconditions.position_quality_floor)),
+      minReferences: distinct(patterns.map((p) => p.preconditions.min_references)),
+      candidates: new Map(),
+      hover: new Map(),
+      emergency: new Map(),
+    };
+    candidateCaches.set(catalog, cache);
+  }
+  return cache;
+}
+
+/**
+ * Number of ascending `floors` that `value` clears (is not below). Two
+ * values with the same band pass exactly the same `value < floor` checks.
+ */
+function band(floors: number[], value: number): number {
+  let lo = 0;
+  let hi = floors.length;
+  while (lo < hi) {
+    const mid = (lo + hi) >>> 1;
+    if (value < floors[mid]!) hi = mid;
+    else lo = mid + 1;
+  }
+  return lo;
+}
+
+/** Candidates after the hardware, precondition and transition filters. */
+function cachedCandidates(
+  catalog: BehavioralCatalog,
+  drone: SolverDrone,
+  store: WorldStore,
+): readonly BehavioralPattern[] {
+  const cache = candidateCacheFor(catalog);
+  const graph = drone.coordinate.epsilon;
+  const key = [
+    drone.coordinate.rho,
+    drone.coordinate.tau,
+    drone.currentPattern,
+    band(cache.batteryFloors, store.battery[drone.slot]!),
+    band(cache.qualityFloors, store.positionQuality[drone.slot]!),
+    band(cache.minReferences, graph.neighbors.length + graph.base_stations.length),
+  ].join('|');
+
+  let candidates = cache.candidates.get(key);
+  if (candidates) return candidates;
+
+  // Step 2: Filter catalog by hardware (rho, tau)
+  const hardwareMatches = filterByCore(catalog, {
+    rho: drone.coordinate.rho,
+    tau: drone.coordinate.tau,
+  });
+
+  // Step 3: Filter by preconditions
+  const preconditionMatches = hardwareMatches.filter((p) =>
+    meetsPreconditions(p, drone, store),
+  );
+
+  // Step 4: Filter by valid transitions from current pattern
+  candidates = preconditionMatches.filter((p) => {
+    // If drone has no current pattern (initial state), allow all
+    if (!drone.currentPattern) return true;
+    // Same pattern is always a valid "transition" (staying put)
+    if (p.id === drone.currentPattern) return true;
+    // Check transition validity
+    return isPatternTransitionValid(catalog, drone.currentPattern, p.id);
+  });
+
+  cache.candidates.set(key, candidates);
+  return candidates;
+}
+
 // ---------------------------------------------------------------------------
 // Constraint Checks
 // ---------------------------------------------------------------------------
@@ -299,16 +475,17 @@ function solveForDrone(
  */
 function meetsPreconditions(
   pattern: BehavioralPattern,
-  drone: DroneState,
+  drone: SolverDrone,
+  store: WorldStore,
 ): boolean {
   const { battery_floor, position_quality_floor, min_references } =
     pattern.preconditions;
 
-  if (drone.lastTelemetry.battery.percentage < battery_floor) {
+  if (store.battery[drone.slot]! < battery_floor) {
     return false;
   }
 
-  if (drone.lastTelemetry.position_quality < position_quality_floor) {
+  if (store.positionQuality[drone.slot]! < position_quality_floor) {
     return false;
   }
 
@@ -328,29 +505,22 @@ function meetsPreconditions(
  */
 function isCompatibleWithNeighbors(
   candidate: BehavioralPattern,
-  drone: DroneState,
-  world: WorldModel,
+  drone: SolverDrone,
+  world: SolverWorld,
   catalog: BehavioralCatalog,
-  assignedPatterns: Map<string, string>,
+  assignedPatterns: Array<string | undefined>,
 ): boolean {
-  const neighbors = drone.coordinate.epsilon.neighbors;
+  for (const neighborSlot of world.neighborSlots(drone.slot)) {
+    const neighborDrone = world.droneAt(neighborSlot)!;
 
-  for (const neighborId of neighbors) {
     // Determine the neighbor's pattern: either already assigned or current
     const neighborPattern =
-      assignedPatterns.get(neighborId) ??
-      world.getDrone(neighborId)?.currentPattern;
+      assignedPatterns[neighborSlot] ?? neighborDrone.currentPattern;
 
     if (!neighborPattern) continue;
 
     // Compute separation distance
-    const neighborDrone = world.getDrone(neighborId);
-    if (!neighborDrone) continue;
-
-    const separation = vec3Distance(
-      drone.lastTelemetry.position,
-      neighborDrone.lastTelemetry.position,
-    );
+    const separation = Math.sqrt(world.store.distanceSq(drone.slot, neighborSlot));
 
     if (!isCompatible(catalog, candidate.id, neighborPattern, separation)) {
       return false;
@@ -369,7 +539,21 @@ function isCompatibleWithNeighbors(
  * Used as a safe fallback when no other pattern is viable.
  */
 function findFallbackHover(
-  drone: DroneState,
+  drone: SolverDrone,
+  catalog: BehavioralCatalog,
+): BehavioralPattern | null {
+  const memo = candidateCacheFor(catalog).hover;
+  const key = `${drone.coordinate.rho}|${drone.coordinate.tau}`;
+  let found = memo.get(key);
+  if (found === undefined) {
+    found = pickFallbackHover(drone, catalog);
+    memo.set(key, found);
+  }
+  return found;
+}
+
+function pickFallbackHover(
+  drone: SolverDrone,
   catalog: BehavioralCatalog,
 ): BehavioralPattern | null {
   const hovers = filterByCore(catalog, {
@@ -391,7 +575,21 @@ function findFallbackHover(
  * The absolute last resort before giving up.
  */
 function findEmergencyFallback(
-  drone: DroneState,
+  drone: SolverDrone,
+  catalog: BehavioralCatalog,
+): BehavioralPattern | null {
+  const memo = candidateCacheFor(catalog).emergency;
+  const key = `${drone.coordinate.rho}|${drone.coordinate.tau}`;
+  let found = memo.get(key);
+  if (found === undefined) {
+    found = pickEmergencyFallback(drone, catalog);
+    memo.set(key, found);
+  }
+  return found;
+}
+
+function pickEmergencyFallback(
+  drone: SolverDrone,
   catalog: BehavioralCatalog,
 ): BehavioralPattern | null {
   const hwPatterns = filterByCore(catalog, {
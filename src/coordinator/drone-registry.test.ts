@@ -0,0 +1,95 @@
+import { describe, it, expect } from 'vitest';
+import { DroneRegistry, SlotSet, MAX_DRONE_SLOTS } from './drone-registry.js';
+import { WorldModel } from './world-model.js';
+import type { SensorState, Vec3 } from '../types/dimensions.js';
+
+function makeTelemetry(pos: Vec3): SensorState {
+  return {
+    position: pos,
+    velocity: { x: 0, y: 0, z: 0 },
+    orientation: { x: 0, y: 0, z: 0 },
+    angular_velocity: { x: 0, y: 0, z: 0 },
+    battery: { voltage: 3.7, percentage: 0.8, discharge_rate: 2.5, estimated_remaining: 300 },
+    position_quality: 0.95,
+    wind_estimate: { x: 0, y: 0, z: 0 },
+  };
+}
+
+describe('DroneRegistry', () => {
+  it('hands out dense slots and keeps them stable', () => {
+    const registry = new DroneRegistry();
+    expect(registry.acquire('a')).toBe(0);
+    expect(registry.acquire('b')).toBe(1);
+    expect(registry.acquire('a')).toBe(0);
+    expect(registry.slotOf('b')).toBe(1);
+    expect(registry.idOf(1)).toBe('b');
+    expect(registry.size).toBe(2);
+    expect(registry.capacity).toBe(2);
+  });
+
+  it('reuses released slots without growing capacity', () => {
+    const registry = new DroneRegistry();
+    registry.acquire('a');
+    registry.acquire('b');
+    expect(registry.release('a')).toBe(0);
+    expect(registry.release('a')).toBeUndefined();
+    expect(registry.slotOf('a')).toBeUndefined();
+    expect(registry.idOf(0)).toBeUndefined();
+
+    expect(registry.acquire('c')).toBe(0);
+    expect(registry.capacity).toBe(2);
+  });
+
+  it('throws once every uint16 slot is taken', () => {
+    const registry = new DroneRegistry();
+    for (let i = 0; i < MAX_DRONE_SLOTS; i++) registry.acquire(`d${i}`);
+    expect(() => registry.acquire('one-too-many')).toThrow(/full/);
+    registry.release('d7');
+    expect(registry.acquire('one-too-many')).toBe(7);
+  });
+});
+
+describe('SlotSet', () => {
+  it('adds, tests and deletes across word boundaries', () => {
+    const set = new SlotSet(70);
+    expect(set.capacity).toBe(96);
+    expect(set.add(0)).toBe(true);
+    expect(set.add(31)).toBe(true);
+    expect(set.add(69)).toBe(true);
+    expect(set.add(31)).toBe(false);
+    expect([0, 1, 31, 32, 69].map((s) => set.has(s))).toEqual([true, false, true, false, true]);
+
+    set.delete(31);
+    expect(set.has(31)).toBe(false);
+    set.clear();
+    expect(set.has(0) || set.has(69)).toBe(false);
+  });
+});
+
+describe('WorldModel — registry slots', () => {
+  it('resolves slots and slot neighbors back to drones', () => {
+    const wm = new WorldModel({ commRange: 2.0 });
+    wm.addDrone('d1', 'crazyflie-2.1', 'bare', 'hover', makeTelemetry({ x: 0, y: 0, z: 1 }));
+    wm.addDrone('d2', 'crazyflie-2.1', 'bare', 'hover', makeTelemetry({ x: 1, y: 0, z: 1 }));
+    const d1 = wm.getDrone('d1')!;
+    const d2 = wm.getDrone('d2')!;
+
+    expect(wm.droneAt(d2.slot)).toBe(d2);
+    expect(wm.neighborSlots(d1.slot)).toEqual([d2.slot]);
+    expect(wm.neighborSlots(d1.slot).map((s) => wm.droneAt(s)!.id)).toEqual(d1.coordinate.epsilon.neighbors);
+  });
+
+  it('frees a removed drone\'s slot for the next one', () => {
+    const wm = new WorldModel();
+    wm.addDrone('d1', 'crazyflie-2.1', 'bare', 'hover', makeTelemetry({ x: 0, y: 0, z: 1 }));
+    wm.addDrone('d2', 'crazyflie-2.1', 'bare', 'hover', makeTelemetry({ x: 1, y: 0, z: 1 }));
+    const slot = wm.getDrone('d1')!.slot;
+    wm.removeDrone('d1');
+    expect(wm.droneAt(slot)).toBeUndefined();
+    expect(wm.neighborSlots(wm.getDrone('d2')!.slot)).toEqual([]);
+
+    wm.addDrone('d3', 'crazyflie-2.1', 'bare', 'hover', makeTelemetry({ x: 50, y: 0, z: 1 }));
+    expect(wm.getDrone('d3')!.slot).toBe(slot);
+    expect(wm.neighborSlots(slot)).toEqual([]);
+  });
+});
@@ -0,0 +1,108 @@
+/**
+ * Seshat Swarm — Drone Registry
+ *
+ * Assigns every drone in the world model a dense integer slot (uint16)
+ * when it is added, so the coordinator's hot loops can index arrays and
+ * bitsets instead of hashing string IDs into Maps and Sets. String IDs
+ * remain the public currency (API calls, commands, events); slots are an
+ * internal detail of WorldModel and the engines that run over it.
+ *
+ * A slot is stable while its drone is registered. Freed slots are reused,
+ * so `capacity` (highest slot ever handed out, plus one) stays close to
+ * the largest the swarm has been and per-slot arrays stay dense.
+ */
+
+/** Slots are uint16: at most 65,536 drones in one world model. */
+export const MAX_DRONE_SLOTS = 0x10000;
+
+export class DroneRegistry {
+  private readonly slots: Map<string, number> = new Map();
+  private readonly ids: Array<string | undefined> = [];
+  private readonly free: number[] = [];
+
+  /** Number of registered drones. */
+  get size(): number {
+    return this.slots.size;
+  }
+
+  /** One past the highest slot handed out; bounds every per-slot array. */
+  get capacity(): number {
+    return this.ids.length;
+  }
+
+  /** Slot for `id`, assigning one if it has none. */
+  acquire(id: string): number {
+    const existing = this.slots.get(id);
+    if (existing !== undefined) return existing;
+
+    let slot = this.free.pop();
+    if (slot === undefined) {
+      if (this.ids.length >= MAX_DRONE_SLOTS) {
+        throw new Error(`DroneRegistry full: at most ${MAX_DRONE_SLOTS} drones`);
+      }
+      slot = this.ids.length;
+      this.ids.push(undefined);
+    }
+    this.ids[slot] = id;
+    this.slots.set(id, slot);
+    return slot;
+  }
+
+  /** Free `id`'s slot for reuse. Returns the slot, or undefined if unknown. */
+  release(id: string): number | undefined {
+    const slot = this.slots.get(id);
+    if (slot === undefined) return undefined;
+    this.slots.delete(id);
+    this.ids[slot] = undefined;
+    this.free.push(slot);
+    return slot;
+  }
+
+  slotOf(id: string): number | undefined {
+    return this.slots.get(id);
+  }
+
+  idOf(slot: number): string | undefined {
+    return this.ids[slot];
+  }
+}
+
+// ---------------------------------------------------------------------------
+// Slot Bitset
+// ---------------------------------------------------------------------------
+
+/** Fixed-capacity set of slots, one bit each. */
+export class SlotSet {
+  private readonly words: Uint32Array;
+
+  constructor(capacity: number) {
+    this.words = new Uint32Array((capacity + 31) >>> 5);
+  }
+
+  /** Slots this set can hold (a multiple of 32). */
+  get capacity(): number {
+    return this.words.length << 5;
+  }
+
+  has(slot: number): boolean {
+    return (this.words[slot >>> 5]! & (1 << (slot & 31))) !== 0;
+  }
+
+  /** Add `slot`. Returns false if it was already present. */
+  add(slot: number): boolean {
+    const word = slot >>> 5;
+    const bit = 1 << (slot & 31);
+    if ((this.words[word]! & bit) !== 0) return false;
+    this.words[word] = this.words[word]! | bit;
+    return true;
+  }
+
+  delete(slot: number): void {
+    const word = slot >>> 5;
+    this.words[word] = this.words[word]! & ~(1 << (slot & 31));
+  }
+
+  clear(): void {
+    this.words.fill(0);
+  }
+}
@@ -1,6 +1,7 @@
 import { describe, it, expect, vi, afterEach } from 'vitest';
-import { Coordinator } from './main.js';
-import { SimComms, type SimDrone } from './comms.js';
+import { Coordinator, assessHealth, DEFAULT_COORDINATOR_CONFIG } from './main.js';
+import { SolverPool } from './solver-pool.js';
+import { SimComms, CmdFlags, HealthBits, TelemFlags, type SimDrone, type HealthReport, type DroneEvent } from './comms.js';
 import type { BehavioralCatalog } from '../catalog/types.js';
 import type { BehavioralPattern, CompatibilityRule } from '../catalog/types.js';
 import type { SensorState, Vec3 } from '../types/dimensions.js';
@@ -190,6 +191,19 @@ describe('Coordinator — tick', () => {
     expect(coord.currentTick).toBe(10);
   });
 
+  it('re-solves both drones once when a new ε link forms', () => {
+    const sim = new SimComms(1000);
+    const coord = new Coordinator(sim, makeTestCatalog());
+    const hover = 'hover-autonomous-performer-bare.sim-gazebo';
+    coord.registerDrone('d1', 'sim-gazebo', 'bare', hover, makeSensorState({ x: 0, y: 0, z: 1 }));
+    coord.registerDrone('d2', 'sim-gazebo', 'bare', hover, makeSensorState({ x: 50, y: 0, z: 1 }));
+    expect(coord.tick()).toEqual([]);
+
+    coord.world.updateTelemetry('d2', makeSensorState({ x: 1, y: 0, z: 1 }));
+    expect(coord.tick().map((a) => a.droneId).sort()).toEqual(['d1', 'd2']);
+    expect(coord.tick()).toEqual([]);
+  });
+
   it('invokes onTick callback', () => {
     const sim = new SimComms(1000);
     const catalog = makeTestCatalog();
@@ -249,6 +263,27 @@ describe('Coordinator — start/stop lifecycle', () => {
   });
 });
 
+describe('Coordinator — per-target pattern IDs', () => {
+  it('sends numeric IDs from the drone hardware target\'s own ID space', async () => {
+    const sim = new SimComms(1000);
+    sim.addSimDrone(makeSimDrone('d1'));
+    const catalog = makeTestCatalog();
+    // A crazyflie-only pattern that sorts first would shift a unified ID space.
+    const cf = makePattern('aaa-autonomous-performer-bare.crazyflie-2.1', 'hover', 'autonomous', 'performer', 'crazyflie-2.1');
+    catalog.patterns.set(cf.id, cf);
+
+    const coord = new Coordinator(sim, catalog, { tickIntervalMs: 1000 });
+    coord.registerDrone('d1', 'sim-gazebo', 'bare', 'hover-autonomous-performer-bare.sim-gazebo', makeSensorState({ x: 0, y: 0, z: 1 }));
+
+    await coord.start(['d1']);
+    await coord.stop();
+
+    // landAll picks land-autonomous-performer-bare.sim-gazebo, which is
+    // index 2 among the sorted sim-gazebo patterns (grounded, hover, land, ...).
+    expect(sim.simDrones.get('d1')!.currentPatternId).toBe(2);
+  });
+});
+
 describe('Coordinator — telemetry handling', () => {
   it('updates world model from telemetry', async () => {
     const sim = new SimComms(50);
@@ -276,6 +311,298 @@ describe('Coordinator — telemetry handling', () => {
   });
 });
 
+describe('Coordinator — loop health', () => {
+  const HEALTHY = HealthBits.VALID;
+  const OVERRUN = HealthBits.VALID | HealthBits.OVERRUN;
+
+  function setup() {
+    const sim = new SimComms(1000);
+    const drone = makeSimDrone('d1');
+    sim.addSimDrone(drone);
+    const coord = new Coordinator(sim, makeTestCatalog(), {
+      health: { ...DEFAULT_COORDINATOR_CONFIG.health, degradeAfter: 2, recoverAfter: 3 },
+    });
+    coord.registerDrone('d1', 'sim-gazebo', 'bare', 'hover-autonomous-performer-bare.sim-gazebo', makeSensorState({ x: 0, y: 0, z: 1 }));
+    const changes: Array<[string, boolean, string[]]> = [];
+    coord.onHealthChange = (id, degraded, problems) => changes.push([id, degraded, problems]);
+    return { sim, drone, coord, changes };
+  }
+
+  it('names each problem against the limits', () => {
+    const limits = { ...DEFAULT_COORDINATOR_CONFIG.health, maxCommandAgeMs: 32 };
+    expect(assessHealth({ overrun: false, commandGap: false, jitterLevel: 1, commandAgeMs: 32 }, limits)).toEqual([]);
+    expect(assessHealth({ overrun: true, commandGap: true, jitterLevel: 2, commandAgeMs: 48 }, limits))
+      .toEqual(['overrun', 'command-gap', 'jitter', 'command-age']);
+  });
+
+  it('flags a drone degraded after consecutive unhealthy reports, with hysteresis', () => {
+    const { sim, drone, coord, changes } = setup();
+
+    drone.health = OVERRUN;
+    sim.broadcastTelemetry();
+    expect(coord.isDegraded('d1')).toBe(false);
+    sim.broadcastTelemetry();
+    expect(coord.isDegraded('d1')).toBe(true);
+    expect(coord.getDegradedDrones()).toEqual(['d1']);
+    expect(changes).toEqual([['d1', true, ['overrun']]]);
+
+    drone.health = HEALTHY;
+    sim.broadcastTelemetry();
+    sim.broadcastTelemetry();
+    expect(coord.isDegraded('d1')).toBe(true);
+    sim.broadcastTelemetry();
+    expect(coord.isDegraded('d1')).toBe(false);
+    expect(changes[1]).toEqual(['d1', false, ['overrun']]);
+  });
+
+  it('ignores drones that send no health byte', () => {
+    const { sim, coord, changes } = setup();
+    for (let i = 0; i < 5; i++) sim.broadcastTelemetry();
+    expect(coord.getDegradedDrones()).toEqual([]);
+    expect(changes).toEqual([]);
+  });
+
+  it('counts extended health packets as reports', () => {
+    const { coord } = setup();
+    const report = {
+      status: { overrun: false, commandGap: true, jitterLevel: 0, commandAgeMs: 0 },
+    } as HealthReport;
+    coord.handleHealthReport('d1', report);
+    coord.handleHealthReport('d1', report);
+    expect(coord.isDegraded('d1')).toBe(true);
+    coord.handleHealthReport('unknown', report);
+    expect(coord.isDegraded('unknown')).toBe(false);
+  });
+});
+
+describe('Coordinator — priority events', () => {
+  const LOW = TelemFlags.AIRBORNE | TelemFlags.PATTERN_ACTIVE | TelemFlags.LOW_BATTERY;
+  const EMERGENCY = LOW | TelemFlags.EMERGENCY;
+
+  function setup() {
+    const sim = new SimComms(1000);
+    const drone = makeSimDrone('d1');
+    drone.statusFlags = TelemFlags.AIRBORNE | TelemFlags.PATTERN_ACTIVE;
+    sim.addSimDrone(drone);
+    const catalog = makeTestCatalog();
+    catalog.patterns.get('hover-autonomous-performer-bare.sim-gazebo')!.postconditions.forced_exits = [
+      { condition: 'battery < 0.10', target_pattern: 'land-emergency-performer-bare.sim-gazebo' },
+    ];
+    const coord = new Coordinator(sim, catalog);
+    coord.registerDrone('d1', 'sim-gazebo', 'bare', 'hover-autonomous-performer-bare.sim-gazebo', makeSensorState({ x: 0, y: 0, z: 1 }));
+    const events: Array<[DroneEvent, number]> = [];
+    coord.onEvent = (event, assignments) => events.push([event, assignments.length]);
+    return { sim, drone, coord, events };
+  }
+
+  it('re-solves on arrival, before the next tick', () => {
+    const { sim, drone, coord, events } = setup();
+    const send = vi.spyOn(sim, 'sendCommand').mockImplementation(async () => {});
+
+    drone.state.battery.percentage = 0.08;
+    drone.state.position = { x: 0.5, y: 0, z: 1 };
+    sim.setSimDroneFlags('d1', EMERGENCY);
+
+    expect(coord.currentTick).toBe(0);
+    expect(events).toHaveLength(1);
+    expect(events[0]![0].newFlags).toBe(EMERGENCY);
+    expect(events[0]![1]).toBeGreaterThan(0);
+    expect(send).toHaveBeenCalled();
+    const world = coord.world.getDrone('d1')!;
+    expect(world.lastTelemetry.battery.percentage).toBe(0.08);
+    expect(world.lastTelemetry.position.x).toBe(0.5);
+    expect(world.currentPattern).toBe('land-emergency-performer-bare.sim-gazebo');
+  });
+
+  it('acks each event so the drone stops retransmitting', () => {
+    const { sim } = setup();
+    sim.setSimDroneFlags('d1', LOW);
+    sim.setSimDroneFlags('d1', EMERGENCY);
+    expect(sim.pendingEvents('d1')).toEqual([]);
+  });
+
+  it('re-acks retransmitted duplicates without re-solving', () => {
+    const { sim, events } = setup();
+    const ack = vi.spyOn(sim, 'ackEvent').mockImplementation(async () => {});
+
+    sim.setSimDroneFlags('d1', LOW);
+    sim.broadcastTelemetry();
+    sim.broadcastTelemetry();
+
+    expect(ack).toHaveBeenCalledTimes(3);
+    expect(events).toHaveLength(1);
+  });
+
+  it('does not let an overtaken event roll back a newer one', () => {
+    const sim = new SimComms(1000);
+    let deliver: (event: DroneEvent) => void = () => {};
+    vi.spyOn(sim, 'onEvent').mockImplementation((cb: (event: DroneEvent) => void) => { deliver = cb; });
+    const coord = new Coordinator(sim, makeTestCatalog());
+    coord.registerDrone('d1', 'sim-gazebo', 'bare', 'hover-autonomous-performer-bare.sim-gazebo', makeSensorState({ x: 0, y: 0, z: 1 }));
+    const solved: Array<[number, number]> = [];
+    coord.onEvent = (event, assignments) => solved.push([event.seq, assignments.length]);
+
+    const event = (seq: number, battery: number): DroneEvent => ({
+      droneId: 'd1', seq, oldFlags: 0, newFlags: LOW, battery, patternId: 0, position: { x: 0, y: 0, z: 1 },
+    });
+    deliver(event(255, 0.14));
+    deliver(event(0, 0.12));
+    deliver(event(254, 0.145));
+
+    expect(solved).toEqual([[255, 1], [0, 1], [254, 0]]);
+    expect(coord.world.getDrone('d1')!.lastTelemetry.battery.percentage).toBe(0.12);
+  });
+
+  it('ignores flag changes that raise no event', () => {
+    const { sim, events } = setup();
+    sim.setSimDroneFlags('d1', TelemFlags.PATTERN_ACTIVE);
+    expect(events).toEqual([]);
+  });
+});
+
+describe('Coordinator — solver pool', () => {
+  const HOVER = 'hover-autonomous-performer-bare.sim-gazebo';
+  const EMERGENCY_LAND = 'land-emergency-performer-bare.sim-gazebo';
+
+  function makeCatalog(): BehavioralCatalog {
+    const catalog = makeTestCatalog();
+    catalog.patterns.get(HOVER)!.postconditions.forced_exits = [
+      { condition: 'battery < 0.10', target_pattern: EMERGENCY_LAND },
+    ];
+    return catalog;
+  }
+
+  /** Two clusters of three drones, 50 m apart; c0-d0 and c1-d0 are low. */
+  function setup(catalog: BehavioralCatalog, pool?: SolverPool) {
+    const sim = new SimComms(1000);
+    vi.spyOn(sim, 'sendCommand').mockImplementation(async () => {});
+    const coord = new Coordinator(sim, catalog);
+    for (let c = 0; c < 2; c++) {
+      for (let i = 0; i < 3; i++) {
+        coord.registerDrone(`c${c}-d${i}`, 'sim-gazebo', 'bare', HOVER, makeSensorState({ x: c * 50 + i, y: 0, z: 1 }));
+      }
+    }
+    coord.tick(); // Settle the new ε links
+    coord.solverPool = pool;
+    for (let c = 0; c < 2; c++) {
+      coord.world.updateTelemetry(`c${c}-d0`, makeSensorState({ x: c * 50, y: 0, z: 1 }, 0.05));
+    }
+    return coord;
+  }
+
+  const patterns = (coord: Coordinator) =>
+    Array.from(coord.world.drones.values(), (d) => [d.id, d.currentPattern]);
+
+  it('applies large re-solves when the pool finishes, as inline would', async () => {
+    const inline = setup(makeCatalog());
+    inline.tick();
+
+    const catalog = makeCatalog();
+    const pool = new SolverPool(catalog, { threads: 2, minParallelDrones: 2 });
+    try {
+      const coord = setup(catalog, pool);
+      const solve = vi.spyOn(pool, 'solve');
+      expect(coord.tick()).toEqual([]);
+      expect(coord.world.getDrone('c0-d0')!.currentPattern).toBe(HOVER);
+      expect(coord.tick()).toEqual([]); // Not re-dispatched while in flight
+      expect(solve).toHaveBeenCalledTimes(1);
+
+      for (let i = 0; i < 200 && coord.world.getDrone('c0-d0')!.currentPattern === HOVER; i++) {
+        await new Promise((resolve) => setTimeout(resolve, 5));
+      }
+      expect(patterns(coord)).toEqual(patterns(inline));
+      expect(coord.world.getDrone('c1-d0')!.currentPattern).toBe(EMERGENCY_LAND);
+    } finally {
+      await pool.close();
+    }
+  });
+
+  it('re-checks the drones next tick when the pool and the inline fallback both fail', async () => {
+    const catalog = makeCatalog();
+    const pool = new SolverPool(catalog, { threads: 2, minParallelDrones: 2 });
+    try {
+      const coord = setup(catalog, pool);
+      const solve = vi.spyOn(pool, 'solve').mockImplementation(() => Promise.reject(new Error('worker lost')));
+      let reads = 0;
+      Object.defineProperty(coord, 'objectives', {
+        get: () => {
+          if (reads++ > 0) throw new Error('inline solve failed');
+          return [];
+        },
+      });
+
+      expect(coord.tick()).toEqual([]);
+      await new Promise((resolve) => setTimeout(resolve, 0));
+      expect(coord.world.getDrone('c0-d0')!.currentPattern).toBe(HOVER);
+
+      reads = 0;
+      coord.tick();
+      expect(solve).toHaveBeenCalledTimes(2);
+    } finally {
+      await pool.close();
+    }
+  });
+
+  it('solves sets below minParallelDrones inline', async () => {
+    const catalog = makeCatalog();
+    const pool = new SolverPool(catalog, { threads: 2, minParallelDrones: 100 });
+    try {
+      const coord = setup(catalog, pool);
+      expect(coord.tick().length).toBeGreaterThan(0);
+      expect(coord.world.getDrone('c0-d0')!.currentPattern).toBe(EMERGENCY_LAND);
+    } finally {
+      await pool.close();
+    }
+  });
+});
+
+describe('Coordinator — leader-relative formation', () => {
+  const FOLLOW = 'formation-hold-autonomous-follower-bare.sim-gazebo';
+
+  /** d1 leads; d2 hovers until a low-battery event forces it into FOLLOW. */
+  function setup(leaderP2pId?: number) {
+    const sim = new SimComms(1000);
+    let deliver: (event: DroneEvent) => void = () => {};
+    vi.spyOn(sim, 'onEvent').mockImplementation((cb: (event: DroneEvent) => void) => { deliver = cb; });
+    const send = vi.spyOn(sim, 'sendCommand').mockImplementation(async () => {});
+
+    const catalog = makeTestCatalog();
+    const follow = makePattern(FOLLOW, 'formation-hold', 'autonomous', 'follower');
+    follow.generator = { type: 'relative-offset', defaults: { offset_x: 0, offset_y: 0, offset_z: 0 }, bounds: {} };
+    follow.preconditions.valid_from = ['hover-autonomous-performer-bare.sim-gazebo'];
+    catalog.patterns.set(FOLLOW, follow);
+    catalog.patterns.get('hover-autonomous-performer-bare.sim-gazebo')!.postconditions.forced_exits = [
+      { condition: 'battery < 0.5', target_pattern: FOLLOW },
+    ];
+
+    const coord = new Coordinator(sim, catalog);
+    const hover = 'hover-autonomous-performer-bare.sim-gazebo';
+    coord.registerDrone('d1', 'sim-gazebo', 'bare', hover, makeSensorState({ x: 0, y: 0, z: 1 }), leaderP2pId);
+    coord.registerDrone('d2', 'sim-gazebo', 'bare', hover, makeSensorState({ x: 1, y: 0, z: 1 }), 12);
+    coord.world.updatePattern('d1', hover, 'hover', 'autonomous', 'leader', 'shared-corridor');
+
+    deliver({
+      droneId: 'd2', seq: 0, oldFlags: 0, newFlags: TelemFlags.LOW_BATTERY,
+      battery: 0.4, patternId: 0, position: { x: 1, y: 0, z: 1 },
+    });
+    const followCmd = send.mock.calls.find(([id]) => id === 'd2')?.[1];
+    return { coord, followCmd };
+  }
+
+  it('sends followers one leader-relative command', () => {
+    const { coord, followCmd } = setup(7);
+    expect(coord.world.getDrone('d2')!.currentPattern).toBe(FOLLOW);
+    expect(followCmd!.flags & CmdFlags.LEADER_RELATIVE).toBe(CmdFlags.LEADER_RELATIVE);
+    expect(followCmd!.leaderId).toBe(7);
+  });
+
+  it('falls back to absolute targets when the leader does not broadcast', () => {
+    const { followCmd } = setup();
+    expect(followCmd!.flags & CmdFlags.LEADER_RELATIVE).toBe(0);
+    expect(followCmd!.leaderId).toBeUndefined();
+  });
+});
+
 describe('Coordinator — 3-drone integration', () => {
   it('manages a 3-drone swarm through ticks', () => {
     const sim = new SimComms(1000);
@@ -6,22 +6,29 @@
  *
  * Loop at 100Hz:
  *   1. Receive telemetry → update world model
- *   2. Detect Δ changes
+ *   2. Detect Δ changes (forced exits, new ε links since the last tick)
  *   3. If Δ ≠ 0: compute blast radius → re-solve assignments → send commands
  *   4. Process operator intent (if any)
  *   5. Periodic role reassignment (1Hz, not every tick)
  *
+ * Priority events (EMERGENCY / LOW_BATTERY transitions) bypass the loop:
+ * they are acked and re-solved on arrival (handleEvent).
+ *
+ * With a solverPool set, re-solves of at least its minParallelDrones run
+ * on worker threads and are applied when they finish (solveAffected).
+ *
  * Graceful shutdown on SIGINT (land all drones).
  */
 
 import { WorldModel, type DroneState } from './world-model.js';
 import { computeCascadingBlastRadius } from './blast-radius.js';
-import { solveAssignment, checkForcedExits, type SwarmObjective, type Assignment } from './constraint-engine.js';
+import { solveAssignment, findForcedExit, type SwarmObjective, type Assignment } from './constraint-engine.js';
 import { assignRoles, type FormationSpec, type CoverageSpec, type RoleAssignmentConfig, DEFAULT_ROLE_CONFIG } from './role-assignment.js';
-import type { DroneComms, DroneTelemetry, DroneCommand } from './comms.js';
+import { CmdFlags, decodeHealthStatus, type DroneComms, type DroneTelemetry, type DroneCommand, type DroneEvent, type HealthStatus, type HealthReport } from './comms.js';
+import type { SolverPool } from './solver-pool.js';
 import type { BehavioralCatalog } from '../catalog/types.js';
-import { lookupPattern } from '../catalog/lookup.js';
-import type { Vec3 } from '../types/dimensions.js';
+import { lookupPattern, buildPatternIdMap } from '../catalog/lookup.js';
+import type { Vec3, HardwareTarget } from '../types/dimensions.js';
 
 // ---------------------------------------------------------------------------
 // Configuration
@@ -38,6 +45,8 @@ export interface CoordinatorConfig {
   staleThresholdMs: number;
   /** Role assignment configuration. */
   roleConfig: RoleAssignmentConfig;
+  /** Onboard loop health limits (see assessHealth). */
+  health: HealthLimits;
 }
 
 export const DEFAULT_COORDINATOR_CONFIG: CoordinatorConfig = {
@@ -46,8 +55,62 @@ export const DEFAULT_COORDINATOR_CONFIG: CoordinatorConfig = {
   commRange: 5.0,
   staleThresholdMs: 500,
   roleConfig: DEFAULT_ROLE_CONFIG,
+  health: {
+    maxJitterLevel: 1,
+    maxCommandAgeMs: Infinity,
+    degradeAfter: 3,
+    recoverAfter: 20,
+  },
 };
 
+// ---------------------------------------------------------------------------
+// Control-Loop Health
+// ---------------------------------------------------------------------------
+
+export interface HealthLimits {
+  /** Highest acceptable jitter level (0-3, see HealthStatus.jitterLevel). */
+  maxJitterLevel: number;
+  /**
+   * Highest acceptable command age at use (ms). Only meaningful when the
+   * ground streams commands at a fixed rate; the coordinator sends on
+   * change, so the default disables the check.
+   */
+  maxCommandAgeMs: number;
+  /** Consecutive unhealthy reports before a drone is flagged degraded. */
+  degradeAfter: number;
+  /** Consecutive healthy reports before the flag clears. */
+  recoverAfter: number;
+}
+
+/** Why a health report is unhealthy. Empty when it is within limits. */
+export function assessHealth(status: HealthStatus, limits: HealthLimits): string[] {
+  const problems: string[] = [];
+  if (status.overrun) problems.push('overrun');
+  if (status.commandGap) problems.push('command-gap');
+  if (status.jitterLevel > limits.maxJitterLevel) problems.push('jitter');
+  if (status.commandAgeMs > limits.maxCommandAgeMs) problems.push('command-age');
+  return problems;
+}
+
+/** Per-drone health hysteresis state. */
+interface HealthTrack {
+  unhealthyRun: number;
+  healthyRun: number;
+  degraded: boolean;
+  problems: string[];
+}
+
+/** Event seqs remembered per drone to drop retransmitted duplicates. */
+const EVENT_SEQ_WINDOW = 16;
+
+/** Per-drone priority event state. */
+interface EventTrack {
+  /** Recently handled seqs, oldest first. */
+  seen: number[];
+  /** Newest seq handled (modulo 256). */
+  latest: number;
+}
+
 // ---------------------------------------------------------------------------
 // Coordinator
 // ---------------------------------------------------------------------------
@@ -77,15 +140,44 @@ export class Coordinator {
   /** Per-drone role hold tick counters for hysteresis. */
   private roleTickCounts: Map<string, number> = new Map();
 
-  /** Pattern ID mapping: pattern string ID → numeric ID for radio. */
-  private patternIdMap: Map<string, number> = new Map();
+  /**
+   * Pattern ID mappings per hardware target: pattern string ID → numeric ID
+   * for radio. Each target flashes its own densely numbered catalog
+   * (compile-catalog --rho), so the same string ID can have different
+   * numeric IDs on different hardware. Built lazily on first use.
+   */
+  private patternIdMaps: Map<HardwareTarget, Map<string, number>> = new Map();
+
+  /** Per-drone onboard loop health, from telemetry and health packets. */
+  private healthTracks: Map<string, HealthTrack> = new Map();
+
+  /** Per-drone event dedupe and ordering. */
+  private eventTracks: Map<string, EventTrack> = new Map();
+
+  /** P2P IDs (PeerStatePacket.drone_id) of drones that broadcast their state. */
+  private p2pIds: Map<string, number> = new Map();
+
+  /** Both endpoints of every ε link formed since the last tick. */
+  private newlyLinked: Set<string> = new Set();
 
   /** Tick counter for the main loop. */
   private tickCount = 0;
 
+  /** Sequence number of the last re-solve started. */
+  private solveSeq = 0;
+
+  /** Per drone: sequence number of the re-solve it was last assigned by. */
+  private assignedBy: Map<string, number> = new Map();
+
+  /** Per drone: sequence number of its re-solve running on the pool. */
+  private offloaded: Map<string, number> = new Map();
+
   /** Whether the coordinator is running. */
   private running = false;
 
+  /** Set by stop(); pool re-solves that finish later are dropped. */
+  private stopped = false;
+
   /** Main loop interval handle. */
   private loopInterval: ReturnType<typeof setInterval> | null = null;
 
@@ -95,6 +187,25 @@ export class Coordinator {
   /** Callback invoked on shutdown. */
   onShutdown?: () => void;
 
+  /**
+   * Callback invoked when a drone is flagged degraded or recovers.
+   * `problems` lists what the last unhealthy report showed.
+   */
+  onHealthChange?: (droneId: string, degraded: boolean, problems: string[]) => void;
+
+  /**
+   * Callback invoked once per distinct priority event, after its
+   * out-of-tick re-solve, with the assignments that re-solve produced
+   * (empty for an event overtaken by a newer one).
+   */
+  onEvent?: (event: DroneEvent, assignments: Assignment[]) => void;
+
+  /**
+   * Worker pool for large re-solves (see solveAffected). The caller owns
+   * it: build it over this coordinator's catalog and close it after stop.
+   */
+  solverPool?: SolverPool;
+
   constructor(
     comms: DroneComms,
     catalog: BehavioralCatalog,
@@ -108,14 +219,17 @@ export class Coordinator {
       staleThresholdMs: this.config.staleThresholdMs,
     });
 
-    // Build pattern ID map (string → sequential uint16)
-    let nextId = 0;
-    for (const patternId of catalog.patterns.keys()) {
-      this.patternIdMap.set(patternId, nextId++);
-    }
+    // A new link is a new compatibility constraint on both drones; a
+    // broken one only relaxes constraints, so it needs no re-solve.
+    this.world.onNeighborChange((change) => {
+      if (change.type !== 'link') return;
+      this.newlyLinked.add(change.droneId);
+      this.newlyLinked.add(change.neighborId);
+    });
 
     // Register telemetry handler
     this.comms.onTelemetry((telemetry) => this.handleTelemetry(telemetry));
+    this.comms.onEvent((event) => this.handleEvent(event));
   }
 
   // -----------------------------------------------------------------------
@@ -128,6 +242,7 @@ export class Coordinator {
   async start(droneIds: string[]): Promise<void> {
     await this.comms.connect(droneIds);
     this.running = true;
+    this.stopped = false;
 
     this.loopInterval = setInterval(() => {
       this.tick();
@@ -139,6 +254,7 @@ export class Coordinator {
    */
   async stop(): Promise<void> {
     this.running = false;
+    this.stopped = true;
 
     if (this.loopInterval) {
       clearInterval(this.loopInterval);
@@ -155,6 +271,8 @@ export class Coordinator {
   /**
    * Run a single tick of the coordinator loop.
    * Exposed for testing — in production, called by the interval.
+   * Returns the assignments applied during the tick; re-solves handed to
+   * the solver pool are applied later and not included.
    */
   tick(): Assignment[] {
     this.tickCount++;
@@ -165,20 +283,20 @@ export class Coordinator {
     // 2. Check forced exits for all drones
     const forcedChanges: string[] = [];
     for (const drone of this.world.drones.values()) {
-      if (drone.stale) continue;
-      const pattern = lookupPattern(this.catalog, drone.currentPattern);
-      if (pattern) {
-        const forcedTarget = checkForcedExits(drone, pattern);
-        if (forcedTarget) {
-          forcedChanges.push(drone.id);
-        }
+      // A drone on an unfinished pool re-solve is still in its old pattern
+      if (drone.stale || this.offloaded.has(drone.id)) continue;
+      if (findForcedExit(this.catalog, this.world, drone)) {
+        forcedChanges.push(drone.id);
       }
     }
 
-    // 3. Detect structural changes (Δ ≠ 0)
-    // In a full implementation, we'd compare the stored state with incoming
-    // telemetry-derived state. For now, forced exits are the primary trigger.
+    // 3. Detect structural changes (Δ ≠ 0): forced exits, and drones that
+    // gained a neighbor they have not been checked against yet
     const changedDrones = new Set(forcedChanges);
+    for (const droneId of this.newlyLinked) {
+      if (this.world.getDrone(droneId)?.stale === false) changedDrones.add(droneId);
+    }
+    this.newlyLinked.clear();
 
     // 4. If any changes, compute blast radius and re-solve
     let assignments: Assignment[] = [];
@@ -187,8 +305,7 @@ export class Coordinator {
         Array.from(changedDrones),
         this.world,
       );
-      assignments = solveAssignment(this.world, this.catalog, affected, this.objectives);
-      this.applyAssignments(assignments);
+      assignments = this.solveAffected(affected);
     }
 
     // 5. Periodic role reassignment (1Hz)
@@ -224,8 +341,7 @@ export class Coordinator {
         }
 
         // Then re-solve assignments
-        const roleAssignments = solveAssignment(this.world, this.catalog, affected, this.objectives);
-        this.applyAssignments(roleAssignments);
+        const roleAssignments = this.solveAffected(affected);
         assignments = assignments.concat(roleAssignments);
       }
 
@@ -252,14 +368,100 @@ export class Coordinator {
     // Update world model with new sensor data
     const drone = this.world.getDrone(telemetry.droneId);
     if (drone) {
-      this.world.updateTelemetry(telemetry.droneId, telemetry.state);
+      this.world.updateTelemetry(telemetry.droneId, telemetry.state, telemetry.maxIntervalMs);
+      const status = decodeHealthStatus(telemetry.health ?? 0);
+      if (status) this.recordHealth(telemetry.droneId, status);
     }
     // Note: if drone is unknown, it should be added via addDrone first
     // during the initialization/connect phase.
   }
 
-  private applyAssignments(assignments: Assignment[]): void {
+  /**
+   * Fast path for priority events: ack, fold the event's battery and
+   * position into the world model, and re-solve the drone's blast radius
+   * now rather than at the next tick. Retransmitted duplicates are
+   * re-acked (the drone missed the ack) but not re-solved, nor are events
+   * that arrive after a newer one (retransmits after a lossy spell).
+   */
+  private handleEvent(event: DroneEvent): void {
+    this.comms.ackEvent(event.droneId, event.seq).catch(() => {
+      // A lost ack only means the drone sends the event again
+    });
+
+    const drone = this.world.getDrone(event.droneId);
+    if (!drone) return;
+
+    let track = this.eventTracks.get(event.droneId);
+    if (!track) {
+      track = { seen: [], latest: (event.seq - 1) & 0xff };
+      this.eventTracks.set(event.droneId, track);
+    }
+    if (track.seen.includes(event.seq)) return;
+    track.seen.push(event.seq);
+    if (track.seen.length > EVENT_SEQ_WINDOW) track.seen.shift();
+
+    if (((event.seq - track.latest) & 0xff) >= 0x80) {
+      this.onEvent?.(event, []);
+      return;
+    }
+    track.latest = event.seq;
+
+    this.world.updateTelemetry(event.droneId, {
+      ...drone.lastTelemetry,
+      position: event.position,
+      battery: { ...drone.lastTelemetry.battery, percentage: event.battery },
+    });
+
+    const affected = computeCascadingBlastRadius([event.droneId], this.world);
+    this.solveAffected(affected, (assignments) => this.onEvent?.(event, assignments));
+  }
+
+  /**
+   * Re-solve `affected` and apply the result, then call `done` with it.
+   * With a solver pool, sets of at least its minParallelDrones are solved
+   * on the workers against the world as it is now, and applied when they
+   * finish; a later re-solve of a drone takes precedence over an earlier
+   * one that finishes after it. Until then the drones' forced exits are
+   * not re-checked; the pool's job timeout bounds how long that lasts.
+   * Returns the assignments applied now.
+   */
+  private solveAffected(
+    affected: Set<string>,
+    done?: (assignments: Assignment[]) => void,
+  ): Assignment[] {
+    const seq = ++this.solveSeq;
+    const pool = this.solverPool;
+    if (!pool || affected.size < pool.options.minParallelDrones) {
+      const assignments = solveAssignment(this.world, this.catalog, affected, this.objectives);
+      this.applyAssignments(assignments, seq);
+      done?.(assignments);
+      return assignments;
+    }
+
+    for (const droneId of affected) this.offloaded.set(droneId, seq);
+    const settled = () => {
+      for (const droneId of affected) {
+        if (this.offloaded.get(droneId) === seq) this.offloaded.delete(droneId);
+      }
+    };
+    pool.solve(this.world, affected, this.objectives)
+      // A worker was lost or timed out mid-solve: solve here instead
+      .catch(() => solveAssignment(this.world, this.catalog, affected, this.objectives))
+      .then((assignments) => {
+        settled();
+        if (this.stopped) return;
+        this.applyAssignments(assignments, seq);
+        done?.(assignments);
+      })
+      // Solving inline failed too; the next tick checks these drones again
+      .catch(settled);
+    return [];
+  }
+
+  private applyAssignments(assignments: Assignment[], seq: number): void {
     for (const assignment of assignments) {
+      if ((this.assignedBy.get(assignment.droneId) ?? 0) > seq) continue;
+      this.assignedBy.set(assignment.droneId, seq);
       const pattern = lookupPattern(this.catalog, assignment.patternId);
       if (!pattern) continue;
 
@@ -274,7 +476,7 @@ export class Coordinator {
       );
 
       // Send command to drone
-      const numericId = this.patternIdMap.get(assignment.patternId) ?? 0;
+      const numericId = this.numericPatternId(pattern.core.rho, assignment.patternId);
       const cmd: DroneCommand = {
         patternId: numericId,
         targetPos: assignment.targetPos ?? { x: 0, y: 0, z: 0 },
@@ -282,6 +484,17 @@ export class Coordinator {
         flags: 0,
       };
 
+      // Relative offsets follow the leader onboard over P2P, so the
+      // formation moves without a per-tick command to every follower.
+      // targetPos is then the follower's slot offset.
+      if (pattern.generator.type === 'relative-offset') {
+        const leaderId = this.leaderP2pId(assignment.droneId);
+        if (leaderId !== undefined) {
+          cmd.flags |= CmdFlags.LEADER_RELATIVE;
+          cmd.leaderId = leaderId;
+        }
+      }
+
       // Fire-and-forget — don't await in the hot loop
       this.comms.sendCommand(assignment.droneId, cmd).catch(() => {
         // Packet loss is expected; drone continues last pattern
@@ -289,6 +502,54 @@ export class Coordinator {
     }
   }
 
+  /**
+   * Fold one health report into the drone's hysteresis: flag it degraded
+   * after `degradeAfter` unhealthy reports in a row, clear the flag after
+   * `recoverAfter` healthy ones.
+   */
+  private recordHealth(droneId: string, status: HealthStatus): void {
+    const limits = this.config.health;
+    let track = this.healthTracks.get(droneId);
+    if (!track) {
+      track = { unhealthyRun: 0, healthyRun: 0, degraded: false, problems: [] };
+      this.healthTracks.set(droneId, track);
+    }
+
+    const problems = assessHealth(status, limits);
+    if (problems.length > 0) {
+      track.unhealthyRun++;
+      track.healthyRun = 0;
+      track.problems = problems;
+      if (!track.degraded && track.unhealthyRun >= limits.degradeAfter) {
+        track.degraded = true;
+        this.onHealthChange?.(droneId, true, problems);
+      }
+    } else {
+      track.healthyRun++;
+      track.unhealthyRun = 0;
+      if (track.degraded && track.healthyRun >= limits.recoverAfter) {
+        track.degraded = false;
+        this.onHealthChange?.(droneId, false, track.problems);
+      }
+    }
+  }
+
+  /** P2P ID of the drone's current leader, if it has one that broadcasts. */
+  private leaderP2pId(droneId: string): number | undefined {
+    const leader = this.world.getNeighborGraph(droneId)?.leader ?? null;
+    return leader === null ? undefined : this.p2pIds.get(leader);
+  }
+
+  /** Translate a pattern string ID into the numeric ID used by a target's firmware. */
+  private numericPatternId(rho: HardwareTarget, patternId: string): number {
+    let idMap = this.patternIdMaps.get(rho);
+    if (!idMap) {
+      idMap = buildPatternIdMap(this.catalog, rho);
+      this.patternIdMaps.set(rho, idMap);
+    }
+    return idMap.get(patternId) ?? 0;
+  }
+
   private async landAll(): Promise<void> {
     // Find land or emergency-land patterns for each drone's hardware
     for (const drone of this.world.drones.values()) {
@@ -300,7 +561,7 @@ export class Coordinator {
 
       if (landPatterns.length > 0) {
         const landPattern = landPatterns[0]!;
-        const numericId = this.patternIdMap.get(landPattern.id) ?? 0;
+        const numericId = this.numericPatternId(drone.coordinate.rho, landPattern.id);
         await this.comms.sendCommand(drone.id, {
           patternId: numericId,
           targetPos: drone.lastTelemetry.position,
@@ -317,7 +578,9 @@ export class Coordinator {
 
   /**
    * Register a drone with the coordinator.
-   * Called during initialization after connecting.
+   * Called during initialization after connecting. `p2pId` is the ID the
+   * drone broadcasts its state under (neighbor_table_init); followers of a
+   * drone without one get absolute targets instead of leader-relative ones.
    */
   registerDrone(
     id: string,
@@ -325,8 +588,31 @@ export class Coordinator {
     tau: 'bare' | 'solar-equipped' | 'battery-carrier' | 'camera-equipped' | 'sensor-extended' | 'dual-deck',
     initialPattern: string,
     telemetry: SensorState,
+    p2pId?: number,
   ): void {
     this.world.addDrone(id, rho, tau, initialPattern, telemetry);
+    if (p2pId !== undefined) this.p2pIds.set(id, p2pId);
+  }
+
+  /**
+   * Feed a decoded HealthPacket from the extended channel. Its window
+   * status counts as one report, like the telemetry health byte.
+   */
+  handleHealthReport(droneId: string, report: HealthReport): void {
+    if (!this.world.getDrone(droneId)) return;
+    this.recordHealth(droneId, report.status);
+  }
+
+  /** Whether a drone is currently flagged degraded by its loop health. */
+  isDegraded(droneId: string): boolean {
+    return this.healthTracks.get(droneId)?.degraded ?? false;
+  }
+
+  /** IDs of all drones currently flagged degraded. */
+  getDegradedDrones(): string[] {
+    return Array.from(this.healthTracks.entries())
+      .filter(([, t]) => t.degraded)
+      .map(([id]) => id);
   }
 
   /** Get the current tick count. */
@@ -83,6 +83,31 @@ describe('Role Assignment — Safety (Rule 1)', () => {
   });
 });
 
+describe('Role Assignment — Safety (Rule 1, flight-time forecast)', () => {
+  function withForecast(wm: WorldModel, id: string, seconds: number): void {
+    const t = wm.getDrone(id)!.lastTelemetry;
+    wm.updateTelemetry(id, { ...t, battery: { ...t.battery, estimated_remaining: seconds } });
+  }
+
+  it('sends a drone in when its forecast is short, whatever its percentage', () => {
+    const wm = buildWorld([
+      { id: 'd1', pos: { x: 0, y: 0, z: 1 }, battery: 0.40 },
+      { id: 'd2', pos: { x: 1, y: 0, z: 1 }, battery: 0.40 },
+    ]);
+    withForecast(wm, 'd1', 45);
+
+    const changes = assignRoles(wm, defaultFormation, defaultCoverage);
+    expect(changes.get('d1')).toBe('charger-inbound');
+    expect(changes.has('d2')).toBe(false);
+  });
+
+  it('ignores an unknown (0) forecast', () => {
+    const wm = buildWorld([{ id: 'd1', pos: { x: 0, y: 0, z: 1 }, battery: 0.40 }]);
+    withForecast(wm, 'd1', 0);
+    expect(assignRoles(wm, defaultFormation, defaultCoverage).has('d1')).toBe(false);
+  });
+});
+
 describe('Role Assignment — Charging Lifecycle (Rules 2-3)', () => {
   it('3. charging drone at 95% -> charger-outbound', () => {
     const wm = buildWorld([
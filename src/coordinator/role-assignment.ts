@@ -8,7 +8,8 @@
  * on battery, position, formation requirements, and coverage needs.
  *
  * Priority order (highest first):
- *   1. Safety: low battery -> charger-inbound (non-negotiable)
+ *   1. Safety: low battery or short flight-time forecast -> charger-inbound
+ *      (non-negotiable)
  *   2. Charging complete: battery >= return threshold -> charger-outbound
  *   3. Charger outbound: airborne -> performer or reserve
  *   4. Relay assignment: coverage needs
@@ -19,7 +20,8 @@
  */
 
 import type { WorldModel, DroneState } from './world-model.js';
-import { vec3Distance } from './world-model.js';
+import type { WorldStore } from './world-store.js';
+import { SIGMA_CODE } from './world-store.js';
 import type { FormationRole, Vec3 } from '../types/dimensions.js';
 
 // ---------------------------------------------------------------------------
@@ -50,6 +52,12 @@ export interface RoleAssignmentConfig {
   batteryChargeThreshold: number;
   /** Battery threshold to allow returning from charging (0-1). Default: 0.90 */
   batteryReturnThreshold: number;
+  /**
+   * Forecast flight seconds (battery.estimated_remaining, from the onboard
+   * forecaster) below which to force charger-inbound: enough to fly to a
+   * pad and land. Ignored while the forecast is 0 (unknown). Default: 60
+   */
+  minFlightSeconds: number;
   /** How many ticks a role must be held before it can change (anti-oscillation). Default: 10 */
   roleHysteresisTickCount: number;
 }
@@ -57,6 +65,7 @@ export interface RoleAssignmentConfig {
 export const DEFAULT_ROLE_CONFIG: RoleAssignmentConfig = {
   batteryChargeThreshold: 0.15,
   batteryReturnThreshold: 0.90,
+  minFlightSeconds: 60,
   roleHysteresisTickCount: 10,
 };
 
@@ -71,8 +80,8 @@ const CHARGING_ROLES: ReadonlySet<FormationRole> = new Set<FormationRole>([
   'charger-outbound',
 ]);
 
-/** Sigma values indicating the drone is on the ground or docked (not airborne). */
-const GROUNDED_SIGMA = new Set(['grounded', 'docked']);
+/** Sigma codes indicating the drone is on the ground or docked (not airborne). */
+const GROUNDED_SIGMA: ReadonlySet<number> = new Set([SIGMA_CODE.get('grounded')!, SIGMA_CODE.get('docked')!]);
 
 // ---------------------------------------------------------------------------
 // Main Entry Point
@@ -96,34 +105,33 @@ export function assignRoles(
   const cfg: RoleAssignmentConfig = { ...DEFAULT_ROLE_CONFIG, ...config };
   const changes = new Map<string, FormationRole>();
 
-  const activeIds = world.getActiveDroneIds();
   const drones: DroneState[] = [];
-  for (const id of activeIds) {
-    const d = world.getDrone(id);
-    if (d) drones.push(d);
+  for (const d of world.drones.values()) {
+    if (!d.stale) drones.push(d);
   }
+  // Scanned fields come from the world store's columns, by slot
+  const store = world.store;
+  const battery = store.battery;
 
   // Build a working snapshot of roles: start with current roles, then overlay changes
   // as we go through the priority rules. This lets later rules see earlier decisions.
-  const effectiveRole = new Map<string, FormationRole>();
-  for (const d of drones) {
-    effectiveRole.set(d.id, d.coordinate.chi);
-  }
+  const effectiveRole = new EffectiveRoles(drones);
 
   // Helper to record a role change
-  const setRole = (id: string, role: FormationRole): void => {
-    effectiveRole.set(id, role);
-    changes.set(id, role);
+  const setRole = (drone: DroneState, role: FormationRole): void => {
+    effectiveRole.set(drone, role);
+    changes.set(drone.id, role);
   };
 
   // -------------------------------------------------------------------------
-  // Rule 1: Safety -- low battery -> charger-inbound
+  // Rule 1: Safety -- low battery or short forecast -> charger-inbound
   // -------------------------------------------------------------------------
   for (const drone of drones) {
-    const battery = drone.lastTelemetry.battery.percentage;
-    const currentRole = effectiveRole.get(drone.id)!;
-    if (battery < cfg.batteryChargeThreshold && !CHARGING_ROLES.has(currentRole)) {
-      setRole(drone.id, 'charger-inbound');
+    const remaining = store.flightRemaining[drone.slot]!;
+    const currentRole = effectiveRole.get(drone);
+    const shortForecast = remaining > 0 && remaining < cfg.minFlightSeconds;
+    if ((battery[drone.slot]! < cfg.batteryChargeThreshold || shortForecast) && !CHARGING_ROLES.has(currentRole)) {
+      setRole(drone, 'charger-inbound');
     }
   }
 
@@ -131,10 +139,9 @@ export function assignRoles(
   // Rule 2: Charging complete -> charger-outbound
   // -------------------------------------------------------------------------
   for (const drone of drones) {
-    const battery = drone.lastTelemetry.battery.percentage;
-    const currentRole = effectiveRole.get(drone.id)!;
-    if (currentRole === 'charging' && battery >= cfg.batteryReturnThreshold) {
-      setRole(drone.id, 'charger-outbound');
+    const currentRole = effectiveRole.get(drone);
+    if (currentRole === 'charging' && battery[drone.slot]! >= cfg.batteryReturnThreshold) {
+      setRole(drone, 'charger-outbound');
     }
   }
 
@@ -142,13 +149,13 @@ export function assignRoles(
   // Rule 3: Charger outbound + airborne -> performer or reserve
   // -------------------------------------------------------------------------
   for (const drone of drones) {
-    const currentRole = effectiveRole.get(drone.id)!;
-    if (currentRole === 'charger-outbound' && !GROUNDED_SIGMA.has(drone.coordinate.sigma)) {
-      const performerCount = countRole(effectiveRole, 'performer');
+    const currentRole = effectiveRole.get(drone);
+    if (currentRole === 'charger-outbound' && !GROUNDED_SIGMA.has(store.sigma[drone.slot]!)) {
+      const performerCount = effectiveRole.count('performer');
       if (performerCount < formation.minPerformers) {
-        setRole(drone.id, 'performer');
+        setRole(drone, 'performer');
       } else {
-        setRole(drone.id, 'reserve');
+        setRole(drone, 'reserve');
       }
     }
   }
@@ -157,11 +164,11 @@ export function assignRoles(
   // Rule 4: Relay assignment
   // -------------------------------------------------------------------------
   if (coverage.needsRelay) {
-    const hasRelay = countRole(effectiveRole, 'relay') > 0;
+    const hasRelay = effectiveRole.count('relay') > 0;
     if (!hasRelay) {
-      const candidate = pickRelayCandidate(drones, effectiveRole, coverage, cfg);
+      const candidate = pickRelayCandidate(drones, store, effectiveRole, coverage, cfg);
       if (candidate) {
-        setRole(candidate.id, 'relay');
+        setRole(candidate, 'relay');
       }
     }
   }
@@ -170,11 +177,11 @@ export function assignRoles(
   // Rule 5: Leader assignment
   // -------------------------------------------------------------------------
   if (formation.needsLeader) {
-    const hasLeader = countRole(effectiveRole, 'leader') > 0;
+    const hasLeader = effectiveRole.count('leader') > 0;
     if (!hasLeader) {
-      const candidate = pickLeaderCandidate(drones, effectiveRole, cfg);
+      const candidate = pickLeaderCandidate(drones, store, effectiveRole, cfg);
       if (candidate) {
-        setRole(candidate.id, 'leader');
+        setRole(candidate, 'leader');
       }
     }
   }
@@ -182,15 +189,15 @@ export function assignRoles(
   // -------------------------------------------------------------------------
   // Rule 6: Performer filling -- promote reserves
   // -------------------------------------------------------------------------
-  const performerCount = countRole(effectiveRole, 'performer');
+  const performerCount = effectiveRole.count('performer');
   if (performerCount < formation.minPerformers) {
     const needed = formation.minPerformers - performerCount;
     const reserves = drones
-      .filter((d) => effectiveRole.get(d.id) === 'reserve')
-      .sort((a, b) => b.lastTelemetry.battery.percentage - a.lastTelemetry.battery.percentage);
+      .filter((d) => effectiveRole.get(d) === 'reserve')
+      .sort((a, b) => battery[b.slot]! - battery[a.slot]!);
 
     for (let i = 0; i < needed && i < reserves.length; i++) {
-      setRole(reserves[i].id, 'performer');
+      setRole(reserves[i], 'performer');
     }
   }
 
@@ -198,8 +205,8 @@ export function assignRoles(
   // Rule 7: Excess performers -> reserve (fairness: demote lowest battery)
   // -------------------------------------------------------------------------
   const currentPerformers = drones
-    .filter((d) => effectiveRole.get(d.id) === 'performer')
-    .sort((a, b) => a.lastTelemetry.battery.percentage - b.lastTelemetry.battery.percentage);
+    .filter((d) => effectiveRole.get(d) === 'performer')
+    .sort((a, b) => battery[a.slot]! - battery[b.slot]!);
 
   const totalPerformersNow = currentPerformers.length;
   // Only demote if we have strictly more than needed
@@ -208,8 +215,8 @@ export function assignRoles(
     for (let i = 0; i < excess; i++) {
       const drone = currentPerformers[i];
       // Only demote if battery is below 50% (low-ish but above charge threshold)
-      if (drone.lastTelemetry.battery.percentage < 0.50) {
-        setRole(drone.id, 'reserve');
+      if (battery[drone.slot]! < 0.50) {
+        setRole(drone, 'reserve');
       }
     }
   }
@@ -250,13 +257,36 @@ export function assignRoles(
 // Candidate Selection Helpers
 // ---------------------------------------------------------------------------
 
-/** Count how many drones currently hold a given role in the effective map. */
-function countRole(effectiveRole: Map<string, FormationRole>, role: FormationRole): number {
-  let count = 0;
-  for (const r of effectiveRole.values()) {
-    if (r === role) count++;
+/**
+ * Working snapshot of active drones' roles, indexed by registry slot, with
+ * a running count per role so the rules need not rescan the swarm.
+ */
+class EffectiveRoles {
+  private readonly roles: FormationRole[] = [];
+  private readonly counts: Map<FormationRole, number> = new Map();
+
+  constructor(drones: DroneState[]) {
+    for (const d of drones) {
+      this.roles[d.slot] = d.coordinate.chi;
+      this.counts.set(d.coordinate.chi, this.count(d.coordinate.chi) + 1);
+    }
+  }
+
+  get(drone: DroneState): FormationRole {
+    return this.roles[drone.slot]!;
+  }
+
+  set(drone: DroneState, role: FormationRole): void {
+    const previous = this.roles[drone.slot]!;
+    this.counts.set(previous, this.count(previous) - 1);
+    this.counts.set(role, this.count(role) + 1);
+    this.roles[drone.slot] = role;
+  }
+
+  /** How many active drones currently hold `role`. */
+  count(role: FormationRole): number {
+    return this.counts.get(role) ?? 0;
   }
-  return count;
 }
 
 /**
@@ -266,15 +296,16 @@ function countRole(effectiveRole: Map<string, FormationRole>, role: FormationRol
  */
 function pickRelayCandidate(
   drones: DroneState[],
-  effectiveRole: Map<string, FormationRole>,
+  store: WorldStore,
+  effectiveRole: EffectiveRoles,
   coverage: CoverageSpec,
   cfg: RoleAssignmentConfig,
 ): DroneState | null {
-  const origin: Vec3 = { x: 0, y: 0, z: 0 };
+  const { battery, position } = store;
   const eligible = drones.filter((d) => {
-    const role = effectiveRole.get(d.id)!;
+    const role = effectiveRole.get(d);
     return (role === 'performer' || role === 'reserve')
-      && d.lastTelemetry.battery.percentage >= cfg.batteryChargeThreshold;
+      && battery[d.slot]! >= cfg.batteryChargeThreshold;
   });
 
   if (eligible.length === 0) return null;
@@ -284,10 +315,11 @@ function pickRelayCandidate(
   let bestScore = Infinity;
 
   for (const drone of eligible) {
-    const distFromOrigin = vec3Distance(drone.lastTelemetry.position, origin);
+    const i = drone.slot * 3;
+    const distFromOrigin = Math.sqrt(position[i]! ** 2 + position[i + 1]! ** 2 + position[i + 2]! ** 2);
     const distToBoundary = Math.abs(distFromOrigin - coverage.coverageRadius);
     // Normalize battery as a small tiebreaker (lower score = better)
-    const score = distToBoundary - drone.lastTelemetry.battery.percentage * 0.01;
+    const score = distToBoundary - battery[drone.slot]! * 0.01;
     if (score < bestScore) {
       bestScore = score;
       best = drone;
@@ -303,22 +335,24 @@ function pickRelayCandidate(
  */
 function pickLeaderCandidate(
   drones: DroneState[],
-  effectiveRole: Map<string, FormationRole>,
+  store: WorldStore,
+  effectiveRole: EffectiveRoles,
   cfg: RoleAssignmentConfig,
 ): DroneState | null {
+  const { battery, positionQuality } = store;
   const eligible = drones.filter((d) => {
-    const role = effectiveRole.get(d.id)!;
+    const role = effectiveRole.get(d);
     return (role === 'performer' || role === 'reserve')
-      && d.lastTelemetry.battery.percentage >= cfg.batteryChargeThreshold;
+      && battery[d.slot]! >= cfg.batteryChargeThreshold;
   });
 
   if (eligible.length === 0) return null;
 
   // Sort by: battery desc, then position_quality desc
   eligible.sort((a, b) => {
-    const battDiff = b.lastTelemetry.battery.percentage - a.lastTelemetry.battery.percentage;
+    const battDiff = battery[b.slot]! - battery[a.slot]!;
     if (Math.abs(battDiff) > 0.001) return battDiff;
-    return b.lastTelemetry.position_quality - a.lastTelemetry.position_quality;
+    return positionQuality[b.slot]! - positionQuality[a.slot]!;
   });
 
   return eligible[0];
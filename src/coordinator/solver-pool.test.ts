@@ -0,0 +1,198 @@
+import { describe, it, expect } from 'vitest';
+import { Worker } from 'node:worker_threads';
+import { SolverPool, shareCatalog, snapshotWorld, SnapshotWorld } from './solver-pool.js';
+import { solveAssignment } from './constraint-engine.js';
+import { WorldModel } from './world-model.js';
+import type { BehavioralPattern, BehavioralCatalog } from '../catalog/types.js';
+import type { SensorState, Vec3 } from '../types/dimensions.js';
+
+// ---------------------------------------------------------------------------
+// Test Helpers
+// ---------------------------------------------------------------------------
+
+function makeTelemetry(pos: Vec3, battery: number): SensorState {
+  return {
+    position: pos,
+    velocity: { x: 0, y: 0, z: 0 },
+    orientation: { x: 0, y: 0, z: 0 },
+    angular_velocity: { x: 0, y: 0, z: 0 },
+    battery: { voltage: 3.7, percentage: battery, discharge_rate: 2.5, estimated_remaining: 300 },
+    position_quality: 0.95,
+    wind_estimate: { x: 0, y: 0, z: 0 },
+  };
+}
+
+function makePattern(
+  id: string,
+  sigma: BehavioralPattern['core']['sigma'],
+  batteryFloor: number,
+  validTo: string[],
+): BehavioralPattern {
+  return {
+    id,
+    core: { sigma, kappa: 'autonomous', chi: 'performer', lambda: 'shared-corridor', tau: 'bare', rho: 'crazyflie-2.1' },
+    description: `Test pattern: ${id}`,
+    preconditions: { battery_floor: batteryFloor, position_quality_floor: 0.5, min_references: 0, valid_from: [] },
+    postconditions: {
+      valid_to: validTo,
+      forced_exits: [{ condition: 'battery < 0.10', target_pattern: 'land-p' }],
+    },
+    generator: { type: 'position-hold', defaults: {}, bounds: {} },
+    verification: {
+      status: 'verified',
+      collision_clearance_m: 0.3,
+      max_velocity_ms: 1.0,
+      max_acceleration_ms2: 2.0,
+      energy_rate_js: 5.0,
+      max_duration_s: 300,
+      verified_transitions: [],
+    },
+  };
+}
+
+/** Hover, orbit and land; orbit pairs need 3 m, so neighbors compete for it. */
+function makeCatalog(): BehavioralCatalog {
+  const patterns = new Map<string, BehavioralPattern>();
+  for (const p of [
+    makePattern('hover-p', 'hover', 0.1, ['orbit-p', 'land-p']),
+    makePattern('orbit-p', 'orbit', 0.4, ['hover-p']),
+    makePattern('land-p', 'land', 0, []),
+  ]) {
+    patterns.set(p.id, p);
+  }
+  return {
+    patterns,
+    compatibility: [
+      { pattern_a: '*', pattern_b: '*', compatible: true, min_separation_m: 0.5 },
+      { pattern_a: 'orbit-*', pattern_b: 'orbit-*', compatible: true, min_separation_m: 3 },
+    ],
+  };
+}
+
+/** Clusters of drones 2 m apart, clusters 50 m apart (commRange 5). */
+function makeClusteredWorld(clusters: number, perCluster: number): WorldModel {
+  const world = new WorldModel({ commRange: 5 });
+  for (let c = 0; c < clusters; c++) {
+    for (let i = 0; i < perCluster; i++) {
+      const battery = [0.9, 0.3, 0.05][(c + i) % 3]!;
+      world.addDrone(`c${c}-d${i}`, 'crazyflie-2.1', 'bare', 'hover-p', makeTelemetry({ x: c * 50 + i * 2, y: 0, z: 1 }, battery));
+    }
+  }
+  // Recompute neighbor graphs after all drones are added
+  for (const id of world.getActiveDroneIds()) {
+    world.updateTelemetry(id, world.getDrone(id)!.lastTelemetry);
+  }
+  return world;
+}
+
+// ---------------------------------------------------------------------------
+// Tests
+// ---------------------------------------------------------------------------
+
+describe('shareCatalog', () => {
+  it('compiles missing tables into shared memory', () => {
+    const shared = shareCatalog(makeCatalog());
+    expect(shared.compatibilityTable!.cells.buffer).toBeInstanceOf(SharedArrayBuffer);
+    expect(shared.transitionGraph!.successors.buffer).toBeInstanceOf(SharedArrayBuffer);
+    expect(shared.coreIndex!.bitsets.sigma.get('hover')!.buffer).toBeInstanceOf(SharedArrayBuffer);
+    expect(shared.forcedExits!.threshold.buffer).toBeInstanceOf(SharedArrayBuffer);
+  });
+});
+
+describe('SnapshotWorld', () => {
+  it('solves a component exactly as the full world does', () => {
+    const catalog = makeCatalog();
+    const world = makeClusteredWorld(3, 6);
+    const affected = ['c1-d4', 'c1-d1', 'c1-d2'];
+    const snapshot = new SnapshotWorld(snapshotWorld(world, affected));
+
+    expect(solveAssignment(snapshot, catalog, new Set(affected), [{ type: 'orbit' }]))
+      .toEqual(solveAssignment(world, catalog, new Set(affected), [{ type: 'orbit' }]));
+  });
+});
+
+describe('SolverPool', () => {
+  it('matches solveAssignment across workers, in affected order', async () => {
+    const catalog = makeCatalog();
+    const world = makeClusteredWorld(12, 8);
+    const affected = new Set(world.getActiveDroneIds().reverse());
+    affected.add('ghost');
+    const objectives = [{ type: 'orbit' as const }];
+
+    const pool = new SolverPool(catalog, { threads: 3, minParallelDrones: 0 });
+    try {
+      const parallel = await pool.solve(world, affected, objectives);
+      expect(parallel).toEqual(solveAssignment(world, catalog, affected, objectives));
+      expect(new Set(parallel.map((a) => a.patternId))).toEqual(new Set(['hover-p', 'orbit-p', 'land-p']));
+    } finally {
+      await pool.close();
+    }
+  });
+
+  it('replaces a worker that dies and keeps solving', async () => {
+    const catalog = makeCatalog();
+    const world = makeClusteredWorld(6, 4);
+    const affected = new Set(world.getActiveDroneIds());
+    const expected = solveAssignment(world, catalog, affected, []);
+
+    // Catch the pool's workers as it posts to them
+    const workers = new Set<Worker>();
+    const postMessage = Worker.prototype.postMessage;
+    Worker.prototype.postMessage = function (this: Worker, ...args: Parameters<Worker['postMessage']>) {
+      workers.add(this);
+      return postMessage.apply(this, args);
+    };
+    const pool = new SolverPool(catalog, { threads: 2, minParallelDrones: 0 });
+    try {
+      expect(await pool.solve(world, affected, [])).toEqual(expected);
+      expect(workers.size).toBe(2);
+      await workers.values().next().value!.terminate();
+
+      expect(pool.threads).toBe(2);
+      expect(await pool.solve(world, affected, [])).toEqual(expected);
+      expect(workers.size).toBe(3);
+    } finally {
+      Worker.prototype.postMessage = postMessage;
+      await pool.close();
+    }
+  });
+
+  it('times out a job its worker never answers and replaces the worker', async () => {
+    const catalog = makeCatalog();
+    const world = makeClusteredWorld(6, 4);
+    const affected = new Set(world.getActiveDroneIds());
+
+    // Lose the first job on its way to the worker, as if the worker wedged
+    let dropped = false;
+    const postMessage = Worker.prototype.postMessage;
+    Worker.prototype.postMessage = function (this: Worker, ...args: Parameters<Worker['postMessage']>) {
+      if (!dropped) {
+        dropped = true;
+        return;
+      }
+      return postMessage.apply(this, args);
+    };
+    const pool = new SolverPool(catalog, { threads: 2, minParallelDrones: 0, jobTimeoutMs: 50 });
+    try {
+      let error: unknown;
+      await pool.solve(world, affected, []).catch((e: unknown) => { error = e; });
+      expect((error as Error).message).toBe('Solver job timed out after 50 ms');
+
+      expect(pool.threads).toBe(2);
+      expect(await pool.solve(world, affected, [])).toEqual(solveAssignment(world, catalog, affected, []));
+    } finally {
+      Worker.prototype.postMessage = postMessage;
+      await pool.close();
+    }
+  });
+
+  it('solves inline without workers', async () => {
+    const catalog = makeCatalog();
+    const world = makeClusteredWorld(2, 4);
+    const affected = new Set(world.getActiveDroneIds());
+    const pool = new SolverPool(catalog, { threads: 0 });
+
+    expect(pool.threads).toBe(0);
+    expect(await pool.solve(world, affected, [])).toEqual(solveAssignment(world, catalog, affected, []));
+  });
+});
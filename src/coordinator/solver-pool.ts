@@ -0,0 +1,495 @@
+/**
+ * Seshat Swarm — Parallel Constraint Solver
+ *
+ * Solves large affected sets on a worker_threads pool so a swarm-wide
+ * re-solve does not hold the coordinator's event loop. The affected set
+ * is split into independent components (partitionAffected); each worker
+ * solves a batch of whole components against a snapshot of the drones
+ * involved, and the results are merged back into affected order, so the
+ * answer is exactly what solveAssignment would return.
+ *
+ * The catalog's compiled tables are moved into SharedArrayBuffers once
+ * (shareCatalog) and shared by every worker rather than copied per job.
+ *
+ * Usage:
+ *   const pool = new SolverPool(catalog, { threads: 4 });
+ *   const assignments = await pool.solve(world, affected, objectives);
+ *   await pool.close();
+ */
+
+import { Worker } from 'node:worker_threads';
+import { availableParallelism } from 'node:os';
+import type {
+  BehavioralCatalog,
+  CoreIndex,
+} from '../catalog/types.js';
+import {
+  buildPatternIdMap,
+  compileCompatibility,
+  compileTransitions,
+  compileCoreIndex,
+} from '../catalog/lookup.js';
+import { compileForcedExits } from '../catalog/forced-exits.js';
+import type { FormationRole, PhysicalTraits, HardwareTarget } from '../types/dimensions.js';
+import { WorldStore } from './world-store.js';
+import {
+  solveAssignment,
+  partitionAffected,
+  type Assignment,
+  type SolverDrone,
+  type SolverWorld,
+  type SwarmObjective,
+} from './constraint-engine.js';
+
+// ---------------------------------------------------------------------------
+// Configuration
+// ---------------------------------------------------------------------------
+
+export interface SolverPoolOptions {
+  /** Worker threads; 0 solves everything inline */
+  threads: number;
+  /** Affected sets smaller than this are solved inline (messaging costs more) */
+  minParallelDrones: number;
+  /**
+   * A job not answered this long after its worker is ready rejects, and
+   * the worker is replaced (a wedged worker would otherwise hold it forever)
+   */
+  jobTimeoutMs: number;
+}
+
+export const DEFAULT_SOLVER_POOL_OPTIONS: SolverPoolOptions = {
+  threads: Math.max(1, availableParallelism() - 1),
+  minParallelDrones: 64,
+  jobTimeoutMs: 1000,
+};
+
+// ---------------------------------------------------------------------------
+// Shared Catalog
+// ---------------------------------------------------------------------------
+
+type SharableArray = Uint8Array | Uint16Array | Uint32Array | Float64Array;
+
+function toShared<T extends SharableArray>(array: T): T {
+  const shared = new (array.constructor as new (buffer: SharedArrayBuffer) => T)(
+    new SharedArrayBuffer(array.byteLength),
+  );
+  shared.set(array);
+  return shared;
+}
+
+function shareBitsets(bitsets: CoreIndex['bitsets']): CoreIndex['bitsets'] {
+  const share = (byValue: Map<string, Uint32Array>) =>
+    new Map(Array.from(byValue, ([value, bits]): [string, Uint32Array] => [value, toShared(bits)]));
+  return {
+    sigma: share(bitsets.sigma),
+    kappa: share(bitsets.kappa),
+    chi: share(bitsets.chi),
+    lambda: share(bitsets.lambda),
+    tau: share(bitsets.tau),
+    rho: share(bitsets.rho),
+  };
+}
+
+/**
+ * A copy of `catalog` with every compiled table present (compiling any a
+ * hand-built catalog lacks) and its typed arrays in SharedArrayBuffers,
+ * so posting it to a worker shares the tables instead of copying them.
+ * The catalog must not be edited afterwards.
+ */
+export function shareCatalog(catalog: BehavioralCatalog): BehavioralCatalog {
+  const index = buildPatternIdMap(catalog);
+  const compatibility = catalog.compatibilityTable ?? compileCompatibility(catalog, index);
+  const transitions = catalog.transitionGraph ?? compileTransitions(catalog, index);
+  const coreIndex = catalog.coreIndex ?? compileCoreIndex(catalog);
+  const forcedExits = catalog.forcedExits ?? compileForcedExits(catalog, index);
+
+  return {
+    ...catalog,
+    compatibilityTable: {
+      ...compatibility,
+      cells: toShared(compatibility.cells),
+      minSeparation: toShared(compatibility.minSeparation),
+    },
+    transitionGraph: {
+      index: transitions.index,
+      ids: transitions.ids,
+      size: transitions.size,
+      words: transitions.words,
+      successors: toShared(transitions.successors),
+    },
+    coreIndex: { ...coreIndex, bitsets: shareBitsets(coreIndex.bitsets) },
+    forcedExits: {
+      ...forcedExits,
+      start: toShared(forcedExits.start),
+      field: toShared(forcedExits.field),
+      op: toShared(forcedExits.op),
+      threshold: toShared(forcedExits.threshold),
+      target: toShared(forcedExits.target),
+    },
+  };
+}
+
+// ---------------------------------------------------------------------------
+// World Snapshots
+// ---------------------------------------------------------------------------
+
+/** Float64 values per drone in WorldSnapshot.values. */
+const SNAPSHOT_VALUES = 9;
+
+/**
+ * What a solve reads, for the affected drones followed by every
+ * unaffected neighbor of theirs (whose current pattern constrains them),
+ * packed into columns that clone cheaply. Numbering follows `ids`.
+ */
+export interface WorldSnapshot {
+  ids: string[];
+  patterns: string[];
+  chi: FormationRole[];
+  tau: PhysicalTraits[];
+  rho: HardwareTarget[];
+  baseStations: string[][];
+  /**
+   * ε neighbors of drone i: links[linkStart[i]] .. links[linkStart[i + 1] - 1].
+   * Unaffected neighbors are not solved, so their links are left out.
+   */
+  linkStart: Uint32Array;
+  links: Uint32Array;
+  /** Per drone: position xyz, velocity xyz, battery, flightRemaining, positionQuality */
+  values: Float64Array;
+}
+
+/** Snapshot `droneIds` and their neighbors out of `world`. */
+export function snapshotWorld(world: SolverWorld, droneIds: string[]): WorldSnapshot {
+  const indexOf = new Map<number, number>();
+  const drones: SolverDrone[] = [];
+  const take = (drone: SolverDrone): number => {
+    let i = indexOf.get(drone.slot);
+    if (i === undefined) {
+      i = drones.length;
+      indexOf.set(drone.slot, i);
+      drones.push(drone);
+    }
+    return i;
+  };
+
+  for (const id of droneIds) take(world.getDrone(id)!);
+  const linkStart = new Uint32Array(droneIds.length + 1);
+  const links: number[] = [];
+  for (let i = 0; i < droneIds.length; i++) {
+    linkStart[i] = links.length;
+    for (const slot of world.neighborSlots(drones[i]!.slot)) links.push(take(world.droneAt(slot)!));
+  }
+  linkStart[droneIds.length] = links.length;
+
+  const store = world.store;
+  const values = new Float64Array(drones.length * SNAPSHOT_VALUES);
+  drones.forEach((drone, i) => {
+    const at = i * SNAPSHOT_VALUES;
+    const xyz = drone.slot * 3;
+    values.set(store.position.subarray(xyz, xyz + 3), at);
+    values.set(store.velocity.subarray(xyz, xyz + 3), at + 3);
+    values[at + 6] = store.battery[drone.slot]!;
+    values[at + 7] = store.flightRemaining[drone.slot]!;
+    values[at + 8] = store.positionQuality[drone.slot]!;
+  });
+
+  return {
+    ids: drones.map((d) => d.id),
+    patterns: drones.map((d) => d.currentPattern),
+    chi: drones.map((d) => d.coordinate.chi),
+    tau: drones.map((d) => d.coordinate.tau),
+    rho: drones.map((d) => d.coordinate.rho),
+    baseStations: drones.map((d) => d.coordinate.epsilon.base_stations),
+    linkStart,
+    links: Uint32Array.from(links),
+    values,
+  };
+}
+
+/** A SolverWorld over a WorldSnapshot; slots are snapshot indices. */
+export class SnapshotWorld implements SolverWorld {
+  readonly store = new WorldStore();
+  readonly #drones: SolverDrone[] = [];
+  readonly #byId = new Map<string, SolverDrone>();
+  readonly #links: number[][] = [];
+
+  constructor(snapshot: WorldSnapshot) {
+    const { ids, linkStart, links, values } = snapshot;
+    if (ids.length > 0) this.store.ensure(ids.length - 1);
+    ids.forEach((id, slot) => {
+      const neighbors = slot + 1 < linkStart.length
+        ? Array.from(links.subarray(linkStart[slot], linkStart[slot + 1]))
+        : [];
+      const drone: SolverDrone = {
+        id,
+        slot,
+        currentPattern: snapshot.patterns[slot]!,
+        coordinate: {
+          chi: snapshot.chi[slot]!,
+          tau: snapshot.tau[slot]!,
+          rho: snapshot.rho[slot]!,
+          epsilon: { neighbors: neighbors.map((n) => ids[n]!), base_stations: snapshot.baseStations[slot]! },
+        },
+      };
+
+      const at = slot * SNAPSHOT_VALUES;
+      this.store.live[slot] = 1;
+      this.store.position.set(values.subarray(at, at + 3), slot * 3);
+      this.store.velocity.set(values.subarray(at + 3, at + 6), slot * 3);
+      this.store.battery[slot] = values[at + 6]!;
+      this.store.flightRemaining[slot] = values[at + 7]!;
+      this.store.positionQuality[slot] = values[at + 8]!;
+
+      this.#drones.push(drone);
+      this.#byId.set(id, drone);
+      this.#links.push(neighbors);
+    });
+  }
+
+  getDrone(id: string): SolverDrone | undefined {
+    return this.#byId.get(id);
+  }
+
+  droneAt(slot: number): SolverDrone | undefined {
+    return this.#drones[slot];
+  }
+
+  neighborSlots(slot: number): readonly number[] {
+    return this.#links[slot] ?? [];
+  }
+}
+
+// ---------------------------------------------------------------------------
+// Worker Protocol
+// ---------------------------------------------------------------------------
+
+/** Coordinator → worker: solve `affected` (in order) over `snapshot`. */
+export interface SolveRequest {
+  job: number;
+  affected: string[];
+  snapshot: WorldSnapshot;
+  objectives: SwarmObjective[];
+}
+
+/** Worker → coordinator. */
+export type SolveReply =
+  | { job: number; assignments: Assignment[] }
+  | { job: number; error: string };
+
+/** Worker → coordinator, once its modules are loaded. */
+export interface SolverWorkerReady {
+  ready: true;
+}
+
+/** workerData for solver-worker. */
+export interface SolverWorkerData {
+  catalog: BehavioralCatalog;
+}
+
+/** Whether this module is running from TypeScript sources (vitest, tsx). */
+const FROM_SOURCE = import.meta.url.endsWith('.ts');
+
+/** The worker entry next to this module, compiled (.js) or not (.ts). */
+const WORKER_URL = new URL(FROM_SOURCE ? './solver-worker.ts' : './solver-worker.js', import.meta.url);
+
+/**
+ * Worker flags. From sources, the worker also registers
+ * solver-worker-hooks.mjs so it can load .ts without the test runner's
+ * loader; compiled workers inherit this thread's flags.
+ */
+const WORKER_EXEC_ARGV = FROM_SOURCE
+  ? [
+      ...process.execArgv,
+      '--import',
+      'data:text/javascript,' + encodeURIComponent(
+        `import { register } from 'node:module'; ` +
+        `register(${JSON.stringify(new URL('./solver-worker-hooks.mjs', import.meta.url).href)});`,
+      ),
+    ]
+  : undefined;
+
+// ---------------------------------------------------------------------------
+// Pool
+// ---------------------------------------------------------------------------
+
+interface PendingJob {
+  worker: Worker;
+  resolve: (assignments: Assignment[]) => void;
+  reject: (error: Error) => void;
+  /** Deadline, armed once the worker is ready */
+  timer?: ReturnType<typeof setTimeout>;
+}
+
+export class SolverPool {
+  readonly options: SolverPoolOptions;
+  /** The shared catalog every solve runs against */
+  readonly catalog: BehavioralCatalog;
+  readonly #workers: Worker[] = [];
+  readonly #pending = new Map<number, PendingJob>();
+  /** Jobs in flight per worker; idle workers are unref'd */
+  readonly #busy = new Map<Worker, number>();
+  /** Workers that have loaded and can take jobs */
+  readonly #ready = new Set<Worker>();
+  readonly #workerData: SolverWorkerData;
+  #nextJob = 0;
+  #closed = false;
+
+  constructor(catalog: BehavioralCatalog, options: Partial<SolverPoolOptions> = {}) {
+    this.options = { ...DEFAULT_SOLVER_POOL_OPTIONS, ...options };
+    this.catalog = shareCatalog(catalog);
+    this.#workerData = { catalog: this.catalog };
+    for (let i = 0; i < this.options.threads; i++) this.spawn();
+  }
+
+  get threads(): number {
+    return this.#workers.length;
+  }
+
+  /**
+   * Solve assignments for `affectedDrones`, in parallel when the set is
+   * large and splits into more than one component. Resolves to the same
+   * assignments, in the same order, as solveAssignment over the world as
+   * it was when solve was called.
+   */
+  async solve(
+    world: SolverWorld,
+    affectedDrones: Set<string>,
+    objectives: SwarmObjective[],
+  ): Promise<Assignment[]> {
+    const components = partitionAffected(world, affectedDrones);
+    const total = components.reduce((sum, c) => sum + c.length, 0);
+    if (this.#workers.length === 0 || components.length < 2 || total < this.options.minParallelDrones) {
+      return solveAssignment(world, this.catalog, affectedDrones, objectives);
+    }
+
+    // Largest component first onto the least-loaded worker; ties go to
+    // the earlier component and worker, so batching is deterministic.
+    const batches: string[][] = this.#workers.map(() => []);
+    const order = components.map((_, i) => i)
+      .sort((a, b) => components[b]!.length - components[a]!.length || a - b);
+    for (const c of order) {
+      let target = 0;
+      for (let w = 1; w < batches.length; w++) {
+        if (batches[w]!.length < batches[target]!.length) target = w;
+      }
+      batches[target]!.push(...components[c]!);
+    }
+
+    // Snapshots are taken now, before any await, so telemetry that lands
+    // while the workers run cannot leak into this solve.
+    const jobs = batches
+      .map((affected, w) => ({ affected, w }))
+      .filter(({ affected }) => affected.length > 0)
+      .map(({ affected, w }) => this.dispatch(this.#workers[w]!, {
+        job: this.#nextJob++,
+        affected,
+        snapshot: snapshotWorld(world, affected),
+        objectives,
+      }));
+
+    const byDrone = new Map<string, Assignment>();
+    for (const assignments of await Promise.all(jobs)) {
+      for (const assignment of assignments) byDrone.set(assignment.droneId, assignment);
+    }
+    const merged: Assignment[] = [];
+    for (const droneId of affectedDrones) {
+      const assignment = byDrone.get(droneId);
+      if (assignment) merged.push(assignment);
+    }
+    return merged;
+  }
+
+  /** Stop the workers. Pending solves reject. */
+  async close(): Promise<void> {
+    this.#closed = true;
+    const workers = this.#workers.splice(0);
+    await Promise.all(workers.map((worker) => worker.terminate()));
+    for (const [job, pending] of this.#pending) {
+      clearTimeout(pending.timer);
+      pending.reject(new Error('Solver pool closed'));
+      this.#pending.delete(job);
+    }
+  }
+
+  /** Start a worker and add it to the pool. */
+  private spawn(): void {
+    const worker = new Worker(WORKER_URL, { workerData: this.#workerData, execArgv: WORKER_EXEC_ARGV });
+    worker.on('message', (message: SolveReply | SolverWorkerReady) => {
+      if ('ready' in message) this.ready(worker);
+      else this.settle(message);
+    });
+    worker.on('error', (error) => this.retire(worker, error));
+    worker.on('exit', (code) => this.retire(worker, new Error(`Solver worker exited with code ${code}`)));
+    worker.unref();
+    this.#workers.push(worker);
+    this.#busy.set(worker, 0);
+  }
+
+  /**
+   * Drop a worker that errored, exited or missed a deadline, and reject
+   * its jobs. It is replaced unless the pool is closing or it died before
+   * it was ready (a replacement would too); with no workers left, solve
+   * runs inline.
+   */
+  private retire(worker: Worker, error: Error): void {
+    const at = this.#workers.indexOf(worker);
+    if (at === -1) return;
+    this.#workers.splice(at, 1);
+    this.#busy.delete(worker);
+    const started = this.#ready.delete(worker);
+    for (const [job, pending] of this.#pending) {
+      if (pending.worker !== worker) continue;
+      clearTimeout(pending.timer);
+      this.#pending.delete(job);
+      pending.reject(error);
+    }
+    if (started && !this.#closed) this.spawn();
+  }
+
+  private dispatch(worker: Worker, request: SolveRequest): Promise<Assignment[]> {
+    return new Promise((resolve, reject) => {
+      const pending: PendingJob = { worker, resolve, reject };
+      this.#pending.set(request.job, pending);
+      if (this.#ready.has(worker)) this.arm(pending);
+
+      const busy = this.#busy.get(worker)!;
+      if (busy === 0) worker.ref();
+      this.#busy.set(worker, busy + 1);
+      const { values, linkStart, links } = request.snapshot;
+      worker.postMessage(request, [values.buffer, linkStart.buffer, links.buffer]);
+    });
+  }
+
+  /** Start the deadlines of jobs queued while the worker was loading. */
+  private ready(worker: Worker): void {
+    this.#ready.add(worker);
+    for (const pending of this.#pending.values()) {
+      if (pending.worker === worker) this.arm(pending);
+    }
+  }
+
+  private arm(pending: PendingJob): void {
+    const { worker } = pending;
+    const timeoutMs = this.options.jobTimeoutMs;
+    pending.timer = setTimeout(() => {
+      this.retire(worker, new Error(`Solver job timed out after ${timeoutMs} ms`));
+      void worker.terminate();
+    }, timeoutMs);
+  }
+
+  private settle(reply: SolveReply): void {
+    const pending = this.#pending.get(reply.job);
+    if (!pending) return;
+    this.#pending.delete(reply.job);
+    clearTimeout(pending.timer);
+    this.release(pending.worker);
+    if ('error' in reply) pending.reject(new Error(reply.error));
+    else pending.resolve(reply.assignments);
+  }
+
+  private release(worker: Worker): void {
+    const busy = this.#busy.get(worker)! - 1;
+    this.#busy.set(worker, busy);
+    if (busy === 0) worker.unref();
+  }
+}
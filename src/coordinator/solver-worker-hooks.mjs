@@ -0,0 +1,39 @@
+/**
+ * Seshat Swarm — Solver Worker Module Hooks
+ *
+ * Registered in SolverPool's workers when the pool runs from TypeScript
+ * sources (vitest, tsx), whose loaders do not reach worker threads. Any
+ * hooks the worker already has get the first try; a relative `.js` import
+ * they cannot find is retried as `.ts`, and `.ts` they cannot load is
+ * transpiled with the typescript compiler.
+ */
+
+import { readFile } from 'node:fs/promises';
+import { fileURLToPath } from 'node:url';
+
+export async function resolve(specifier, context, nextResolve) {
+  try {
+    return await nextResolve(specifier, context);
+  } catch (error) {
+    if (error?.code !== 'ERR_MODULE_NOT_FOUND' || !specifier.startsWith('.') || !specifier.endsWith('.js')) {
+      throw error;
+    }
+    return nextResolve(`${specifier.slice(0, -3)}.ts`, context);
+  }
+}
+
+export async function load(url, context, nextLoad) {
+  if (!url.endsWith('.ts')) return nextLoad(url, context);
+  try {
+    return await nextLoad(url, context);
+  } catch (error) {
+    if (error?.code !== 'ERR_UNKNOWN_FILE_EXTENSION') throw error;
+  }
+
+  const { default: ts } = await import('typescript');
+  const { outputText } = ts.transpileModule(await readFile(new URL(url), 'utf8'), {
+    fileName: fileURLToPath(url),
+    compilerOptions: { module: ts.ModuleKind.ESNext, target: ts.ScriptTarget.ES2022 },
+  });
+  return { format: 'module', source: outputText, shortCircuit: true };
+}
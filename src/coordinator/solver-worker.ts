@@ -0,0 +1,33 @@
+/**
+ * Seshat Swarm — Solver Worker
+ *
+ * worker_threads entry for SolverPool: solves each SolveRequest over a
+ * SnapshotWorld against the shared catalog passed in workerData. Posts
+ * SolverWorkerReady once loaded, which starts its jobs' deadlines.
+ */
+
+import { parentPort, workerData } from 'node:worker_threads';
+import { solveAssignment } from './constraint-engine.js';
+import {
+  SnapshotWorld,
+  type SolveRequest,
+  type SolveReply,
+  type SolverWorkerData,
+  type SolverWorkerReady,
+} from './solver-pool.js';
+
+const { catalog } = workerData as SolverWorkerData;
+
+parentPort!.on('message', (request: SolveRequest) => {
+  let reply: SolveReply;
+  try {
+    const world = new SnapshotWorld(request.snapshot);
+    const assignments = solveAssignment(world, catalog, new Set(request.affected), request.objectives);
+    reply = { job: request.job, assignments };
+  } catch (error) {
+    reply = { job: request.job, error: error instanceof Error ? error.message : String(error) };
+  }
+  parentPort!.postMessage(reply);
+});
+
+parentPort!.postMessage({ ready: true } satisfies SolverWorkerReady);
@@ -0,0 +1,136 @@
+import { describe, it, expect } from 'vitest';
+import { SpatialGrid } from './spatial-grid.js';
+import { WorldModel, vec3Distance } from './world-model.js';
+import type { SensorState, Vec3 } from '../types/dimensions.js';
+
+function makeTelemetry(pos: Vec3): SensorState {
+  return {
+    position: pos,
+    velocity: { x: 0, y: 0, z: 0 },
+    orientation: { x: 0, y: 0, z: 0 },
+    angular_velocity: { x: 0, y: 0, z: 0 },
+    battery: { voltage: 3.7, percentage: 0.8, discharge_rate: 2.5, estimated_remaining: 300 },
+    position_quality: 0.95,
+    wind_estimate: { x: 0, y: 0, z: 0 },
+  };
+}
+
+/** Deterministic LCG so failures reproduce. */
+function makeRng(seed: number): () => number {
+  let state = seed >>> 0;
+  return () => {
+    state = (Math.imul(state, 1664525) + 1013904223) >>> 0;
+    return state / 2 ** 32;
+  };
+}
+
+describe('SpatialGrid', () => {
+  it('finds drones in adjacent cells, across negative coordinates', () => {
+    const grid = new SpatialGrid(2);
+    grid.set(0, { x: -0.1, y: 0, z: 0 });
+    grid.set(1, { x: 0.1, y: 0, z: 0 });
+    grid.set(2, { x: 1.9, y: -1.9, z: 0.5 });
+    grid.set(3, { x: 4.5, y: 0, z: 0 });
+
+    expect(grid.within({ x: 0, y: 0, z: 0 }, 2)).toEqual([0, 1]);
+    expect(grid.within({ x: 1, y: -1, z: 0 }, 2, 2)).toEqual([0, 1]);
+    expect(grid.within({ x: 3, y: -1, z: 0 }, 2)).toEqual([2, 3]);
+  });
+
+  it('moves and removes drones', () => {
+    const grid = new SpatialGrid(1);
+    grid.set(0, { x: 0, y: 0, z: 0 });
+    grid.set(1, { x: 0.5, y: 0, z: 0 });
+    grid.set(0, { x: 10, y: 0, z: 0 });
+    expect(grid.within({ x: 0, y: 0, z: 0 }, 1)).toEqual([1]);
+    expect(grid.within({ x: 10, y: 0, z: 0 }, 1)).toEqual([0]);
+
+    expect(grid.delete(1)).toBe(true);
+    expect(grid.delete(1)).toBe(false);
+    expect(grid.size).toBe(1);
+    expect(grid.within({ x: 0, y: 0, z: 0 }, 1)).toEqual([]);
+  });
+
+  it('lists results in first-insertion order, not by cell or slot', () => {
+    const grid = new SpatialGrid(1);
+    grid.set(7, { x: 0.9, y: 0, z: 0 });
+    grid.set(3, { x: -0.9, y: 0, z: 0 });
+    grid.set(5, { x: 0, y: 0.5, z: 0 });
+    grid.set(7, { x: 0.8, y: 0, z: 0 });  // Move keeps its place
+    expect(grid.within({ x: 0, y: 0, z: 0 }, 1)).toEqual([7, 3, 5]);
+  });
+
+  it('stays correct where packed cell keys alias (1024 cells apart)', () => {
+    const grid = new SpatialGrid(1);
+    grid.set(0, { x: 0.5, y: 0, z: 0 });
+    grid.set(1, { x: 1024.5, y: 0, z: 0 });
+    expect(grid.within({ x: 0, y: 0, z: 0 }, 1)).toEqual([0]);
+    expect(grid.within({ x: 1024, y: 0, z: 0 }, 1)).toEqual([1]);
+  });
+
+  it('rejects a non-positive cell size', () => {
+    expect(() => new SpatialGrid(0)).toThrow();
+  });
+});
+
+describe('WorldModel — ε through the spatial grid', () => {
+  it('matches an all-pairs scan as drones move, join and leave', () => {
+    const rng = makeRng(41);
+    const wm = new WorldModel({ commRange: 3.0 });
+    const ids: string[] = [];
+    for (let i = 0; i < 200; i++) {
+      const id = `d${i}`;
+      ids.push(id);
+      wm.addDrone(id, 'sim-gazebo', 'bare', 'hover', makeTelemetry({
+        x: rng() * 30 - 15, y: rng() * 30 - 15, z: rng() * 6,
+      }));
+    }
+    for (let i = 0; i < 20; i++) wm.removeDrone(`d${i * 10}`);
+
+    for (let step = 0; step < 5; step++) {
+      for (const id of ids) {
+        const drone = wm.getDrone(id);
+        if (!drone) continue;
+        const p = drone.lastTelemetry.position;
+        wm.updateTelemetry(id, makeTelemetry({
+          x: p.x + (rng() - 0.5) * 4, y: p.y + (rng() - 0.5) * 4, z: p.z + (rng() - 0.5),
+        }));
+      }
+    }
+
+    for (const [id, drone] of wm.drones) {
+      const p = drone.lastTelemetry.position;
+      const expected = Array.from(wm.drones.values())
+        .filter((o) => o.id !== id && vec3Distance(p, o.lastTelemetry.position) <= 3.0)
+        .map((o) => o.id);
+      expect(wm.computeNeighborGraph(id, p).neighbors).toEqual(expected);
+    }
+  });
+
+  it('drops a removed drone from its neighbors\' graphs', () => {
+    const wm = new WorldModel({ commRange: 2.0 });
+    wm.addDrone('d1', 'crazyflie-2.1', 'bare', 'hover', makeTelemetry({ x: 0, y: 0, z: 1 }));
+    wm.addDrone('d2', 'crazyflie-2.1', 'bare', 'hover', makeTelemetry({ x: 1, y: 0, z: 1 }));
+    wm.removeDrone('d2');
+    wm.updateTelemetry('d1', makeTelemetry({ x: 0, y: 0, z: 1 }));
+    expect(wm.getNeighborGraph('d1')!.neighbors).toEqual([]);
+  });
+
+  it('keeps a 10,000-drone telemetry update local', () => {
+    const rng = makeRng(10000);
+    const wm = new WorldModel();
+    for (let i = 0; i < 10000; i++) {
+      wm.addDrone(`d${i}`, 'sim-gazebo', 'bare', 'hover', makeTelemetry({
+        x: rng() * 220, y: rng() * 220, z: rng() * 10,
+      }));
+    }
+    const start = performance.now();
+    for (let i = 0; i < 1000; i++) {
+      wm.updateTelemetry(`d${i}`, makeTelemetry({ x: rng() * 220, y: rng() * 220, z: rng() * 10 }));
+    }
+    const elapsed = performance.now() - start;
+    // An all-pairs scan needs ~10M distance checks for these 1000 updates;
+    // the grid needs a few tens per update.
+    expect(elapsed).toBeLessThan(200);
+  });
+});
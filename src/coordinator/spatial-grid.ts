@@ -0,0 +1,153 @@
+/**
+ * Seshat Swarm — Spatial Hash Grid
+ *
+ * Uniform grid of cubic cells, `cellSize` on a side, mapping each cell to
+ * the drones inside it. With cellSize equal to the communication range,
+ * every drone within range of a point lies in the point's cell or one of
+ * its 26 neighbours, so a neighbor query touches 27 cells instead of the
+ * whole swarm. Callers still check the exact distance: the grid only
+ * narrows the candidates.
+ *
+ * Cells are created on first use and dropped when they empty, so memory
+ * follows the drones, not the extent of the flying area.
+ *
+ * Drones are filed by their DroneRegistry slot.
+ */
+
+import type { Vec3 } from '../types/dimensions.js';
+
+/**
+ * Cell coordinates are packed into one small integer (10 bits per axis) so
+ * the cell map needs neither string keys nor boxed numbers. Cells 1024
+ * apart on an axis (5 km at a 5 m range) share a key; that only adds
+ * candidates, never loses one, since insert and query pack alike.
+ */
+const AXIS_BITS = 10;
+const AXIS_MASK = (1 << AXIS_BITS) - 1;
+
+function packCell(ix: number, iy: number, iz: number): number {
+  return (ix & AXIS_MASK) | ((iy & AXIS_MASK) << AXIS_BITS) | ((iz & AXIS_MASK) << (2 * AXIS_BITS));
+}
+
+/** One filed drone. `seq` orders results by first insertion. */
+interface GridEntry {
+  slot: number;
+  position: Vec3;
+  seq: number;
+  cell: number;
+  /** Index in its cell's array, for O(1) removal */
+  index: number;
+}
+
+export class SpatialGrid {
+  readonly cellSize: number;
+  private readonly cells: Map<number, GridEntry[]> = new Map();
+  private readonly entries: Array<GridEntry | undefined> = [];
+  private filed = 0;
+  private nextSeq = 0;
+
+  constructor(cellSize: number) {
+    if (!(cellSize > 0)) throw new Error(`SpatialGrid cell size must be positive, got ${cellSize}`);
+    this.cellSize = cellSize;
+  }
+
+  /** Number of drones filed in the grid. */
+  get size(): number {
+    return this.filed;
+  }
+
+  /**
+   * File a drone at `position`, or move it there if already filed. The
+   * grid keeps the reference; the caller must not mutate it afterwards.
+   */
+  set(slot: number, position: Vec3): void {
+    const key = this.keyOf(position);
+    let entry = this.entries[slot];
+    if (!entry) {
+      entry = { slot, position, seq: this.nextSeq++, cell: key, index: 0 };
+      this.entries[slot] = entry;
+      this.filed++;
+      this.file(entry);
+      return;
+    }
+    entry.position = position;
+    if (entry.cell === key) return;
+    this.unfile(entry);
+    entry.cell = key;
+    this.file(entry);
+  }
+
+  /** Order in which `slot` was first filed (lower is earlier), or -1. */
+  seqOf(slot: number): number {
+    return this.entries[slot]?.seq ?? -1;
+  }
+
+  /** Remove a drone. Returns false if it was not filed. */
+  delete(slot: number): boolean {
+    const entry = this.entries[slot];
+    if (!entry) return false;
+    this.unfile(entry);
+    this.entries[slot] = undefined;
+    this.filed--;
+    return true;
+  }
+
+  /**
+   * Slots of the drones within `radius` of `position` (at most cellSize;
+   * only the 27 surrounding cells are searched), in the order they were
+   * first filed. `exclude` is left out.
+   */
+  within(position: Vec3, radius: number, exclude = -1): number[] {
+    const found: GridEntry[] = [];
+    const ix = Math.floor(position.x / this.cellSize);
+    const iy = Math.floor(position.y / this.cellSize);
+    const iz = Math.floor(position.z / this.cellSize);
+    for (let dx = -1; dx <= 1; dx++) {
+      for (let dy = -1; dy <= 1; dy++) {
+        for (let dz = -1; dz <= 1; dz++) {
+          const cell = this.cells.get(packCell(ix + dx, iy + dy, iz + dz));
+          if (!cell) continue;
+          for (const entry of cell) {
+            const ex = entry.position.x - position.x;
+            const ey = entry.position.y - position.y;
+            const ez = entry.position.z - position.z;
+            if (Math.sqrt(ex * ex + ey * ey + ez * ez) <= radius && entry.slot !== exclude) {
+              found.push(entry);
+            }
+          }
+        }
+      }
+    }
+    found.sort((a, b) => a.seq - b.seq);
+    return found.map((entry) => entry.slot);
+  }
+
+  private keyOf(position: Vec3): number {
+    return packCell(
+      Math.floor(position.x / this.cellSize),
+      Math.floor(position.y / this.cellSize),
+      Math.floor(position.z / this.cellSize),
+    );
+  }
+
+  private file(entry: GridEntry): void {
+    let cell = this.cells.get(entry.cell);
+    if (!cell) {
+      cell = [];
+      this.cells.set(entry.cell, cell);
+    }
+    entry.index = cell.length;
+    cell.push(entry);
+  }
+
+  /** Swap-remove from its cell; drop the cell once empty. */
+  private unfile(entry: GridEntry): void {
+    const cell = this.cells.get(entry.cell)!;
+    const last = cell.pop()!;
+    if (last !== entry) {
+      cell[entry.index] = last;
+      last.index = entry.index;
+    }
+    if (cell.length === 0) this.cells.delete(entry.cell);
+  }
+}
@@ -1,5 +1,5 @@
 import { describe, it, expect } from 'vitest';
-import { WorldModel, vec3Distance } from './world-model.js';
+import { WorldModel, vec3Distance, type NeighborChange } from './world-model.js';
 import type { SensorState, Vec3 } from '../types/dimensions.js';
 
 function makeTelemetry(pos: Vec3, battery = 0.8): SensorState {
@@ -58,6 +58,32 @@ describe('WorldModel — drone management', () => {
   });
 });
 
+describe('WorldModel — adaptive telemetry rates', () => {
+  it('stretches the stale threshold to missed keepalives per drone', () => {
+    const wm = new WorldModel({ staleThresholdMs: 500, staleMissedKeepalives: 3 });
+    wm.addDrone('fixed', 'crazyflie-2.1', 'bare', 'hover', makeTelemetry({ x: 0, y: 0, z: 1 }));
+    wm.addDrone('idle', 'crazyflie-2.1', 'bare', 'grounded', makeTelemetry({ x: 1, y: 0, z: 0 }));
+    wm.updateTelemetry('idle', makeTelemetry({ x: 1, y: 0, z: 0 }), 1000);
+
+    const now = Date.now();
+    wm.getDrone('fixed')!.lastUpdate = now - 1200;
+    wm.getDrone('idle')!.lastUpdate = now - 1200;
+    expect(wm.markStaleDrones(now)).toEqual(['fixed']);
+    expect(wm.staleThresholdFor(wm.getDrone('idle')!)).toBe(3000);
+
+    wm.getDrone('idle')!.lastUpdate = now - 3100;
+    expect(wm.markStaleDrones(now)).toEqual(['idle']);
+  });
+
+  it('keeps the last advertised interval when a packet omits it', () => {
+    const wm = new WorldModel();
+    wm.addDrone('d1', 'crazyflie-2.1', 'bare', 'hover', makeTelemetry({ x: 0, y: 0, z: 1 }));
+    wm.updateTelemetry('d1', makeTelemetry({ x: 0, y: 0, z: 1 }), 500);
+    wm.updateTelemetry('d1', makeTelemetry({ x: 0, y: 0, z: 1 }));
+    expect(wm.getDrone('d1')!.telemetryIntervalMs).toBe(500);
+  });
+});
+
 describe('WorldModel — telemetry updates', () => {
   it('updates sensor data and timestamp', () => {
     const wm = new WorldModel();
@@ -128,6 +154,126 @@ describe('WorldModel — neighbor graph (ε)', () => {
   });
 });
 
+describe('WorldModel — incremental ε', () => {
+  function record(wm: WorldModel): NeighborChange[] {
+    const changes: NeighborChange[] = [];
+    wm.onNeighborChange((change) => changes.push(change));
+    return changes;
+  }
+
+  it('links and unlinks both endpoints, reporting each link once', () => {
+    const wm = new WorldModel({ commRange: 2.0, neighborHysteresis: 0.5 });
+    const changes = record(wm);
+    wm.addDrone('d1', 'crazyflie-2.1', 'bare', 'hover', makeTelemetry({ x: 0, y: 0, z: 1 }));
+    wm.addDrone('d2', 'crazyflie-2.1', 'bare', 'hover', makeTelemetry({ x: 10, y: 0, z: 1 }));
+    expect(changes).toEqual([]);
+
+    wm.updateTelemetry('d2', makeTelemetry({ x: 1.5, y: 0, z: 1 }));
+    expect(wm.getNeighborGraph('d1')!.neighbors).toEqual(['d2']);
+    expect(wm.getNeighborGraph('d2')!.neighbors).toEqual(['d1']);
+    expect(changes).toEqual([{ type: 'link', droneId: 'd2', neighborId: 'd1' }]);
+
+    wm.updateTelemetry('d2', makeTelemetry({ x: 6, y: 0, z: 1 }));
+    expect(wm.getNeighborGraph('d1')!.neighbors).toEqual([]);
+    expect(wm.getNeighborGraph('d2')!.neighbors).toEqual([]);
+    expect(changes[1]).toEqual({ type: 'unlink', droneId: 'd2', neighborId: 'd1' });
+  });
+
+  it('holds a link inside the hysteresis band', () => {
+    const wm = new WorldModel({ commRange: 2.0, neighborHysteresis: 0.5 });
+    const changes = record(wm);
+    wm.addDrone('d1', 'crazyflie-2.1', 'bare', 'hover', makeTelemetry({ x: 0, y: 0, z: 1 }));
+    wm.addDrone('d2', 'crazyflie-2.1', 'bare', 'hover', makeTelemetry({ x: 1.9, y: 0, z: 1 }));
+
+    // Jitter around commRange, out to 2.4 m: the link survives
+    for (const x of [2.1, 1.95, 2.3, 2.05, 2.4]) {
+      wm.updateTelemetry('d2', makeTelemetry({ x, y: 0, z: 1 }));
+    }
+    expect(wm.getNeighborGraph('d1')!.neighbors).toEqual(['d2']);
+    expect(changes).toHaveLength(1);
+
+    wm.updateTelemetry('d2', makeTelemetry({ x: 2.8, y: 0, z: 1 }));
+    expect(wm.getNeighborGraph('d1')!.neighbors).toEqual([]);
+    expect(changes).toHaveLength(2);
+  });
+
+  it('does not re-evaluate links for sub-band moves', () => {
+    const wm = new WorldModel({ commRange: 2.0, neighborHysteresis: 0.5 });
+    wm.addDrone('d1', 'crazyflie-2.1', 'bare', 'hover', makeTelemetry({ x: 0, y: 0, z: 1 }));
+    wm.addDrone('d2', 'crazyflie-2.1', 'bare', 'hover', makeTelemetry({ x: 2.2, y: 0, z: 1 }));
+    const graph = wm.getNeighborGraph('d1')!;
+
+    // 0.2 m < hysteresis / 2: d1 is now within range of d2 but not re-evaluated
+    wm.updateTelemetry('d1', makeTelemetry({ x: 0.2, y: 0, z: 1 }));
+    expect(wm.getNeighborGraph('d1')).toBe(graph);
+    expect(graph.neighbors).toEqual([]);
+
+    // Another 0.1 m takes it past the band from where it was evaluated
+    wm.updateTelemetry('d1', makeTelemetry({ x: 0.3, y: 0, z: 1 }));
+    expect(graph.neighbors).toEqual(['d2']);
+  });
+
+  it('re-derives role links on a χ change without any telemetry', () => {
+    const wm = new WorldModel({ commRange: 5.0 });
+    wm.addDrone('leader', 'crazyflie-2.1', 'bare', 'hover', makeTelemetry({ x: 0, y: 0, z: 1 }));
+    wm.addDrone('follower', 'crazyflie-2.1', 'bare', 'hover', makeTelemetry({ x: 1, y: 0, z: 1 }));
+
+    wm.updatePattern('follower', 'hover-autonomous-follower-bare.crazyflie-2.1', 'hover', 'autonomous', 'follower', 'shared-corridor');
+    wm.updatePattern('leader', 'hover-autonomous-leader-bare.crazyflie-2.1', 'hover', 'autonomous', 'leader', 'exclusive-volume');
+    expect(wm.getNeighborGraph('follower')!.leader).toBe('leader');
+    expect(wm.getNeighborGraph('leader')!.followers).toEqual(['follower']);
+
+    wm.updatePattern('leader', 'hover-autonomous-performer-bare.crazyflie-2.1', 'hover', 'autonomous', 'performer', 'shared-corridor');
+    expect(wm.getNeighborGraph('follower')!.leader).toBeNull();
+  });
+
+  it('unlinks every neighbor of a removed drone', () => {
+    const wm = new WorldModel({ commRange: 2.0 });
+    wm.addDrone('d1', 'crazyflie-2.1', 'bare', 'hover', makeTelemetry({ x: 0, y: 0, z: 1 }));
+    wm.addDrone('d2', 'crazyflie-2.1', 'bare', 'hover', makeTelemetry({ x: 1, y: 0, z: 1 }));
+    wm.addDrone('d3', 'crazyflie-2.1', 'bare', 'hover', makeTelemetry({ x: 0, y: 1, z: 1 }));
+    const changes = record(wm);
+
+    wm.removeDrone('d1');
+    expect(changes).toEqual([
+      { type: 'unlink', droneId: 'd1', neighborId: 'd2' },
+      { type: 'unlink', droneId: 'd1', neighborId: 'd3' },
+    ]);
+    expect(wm.getNeighborGraph('d2')!.neighbors).toEqual(['d3']);
+    expect(wm.getNeighborGraph('d3')!.neighbors).toEqual(['d2']);
+  });
+
+  it('keeps every pair within commRange − hysteresis linked under random motion', () => {
+    const wm = new WorldModel({ commRange: 3.0, neighborHysteresis: 0.4 });
+    let seed = 42;
+    const rng = () => {
+      seed = (Math.imul(seed, 1664525) + 1013904223) >>> 0;
+      return seed / 2 ** 32;
+    };
+    for (let i = 0; i < 60; i++) {
+      wm.addDrone(`d${i}`, 'sim-gazebo', 'bare', 'hover', makeTelemetry({ x: rng() * 12, y: rng() * 12, z: 1 }));
+    }
+    for (let step = 0; step < 50; step++) {
+      for (const [id, drone] of wm.drones) {
+        const p = drone.lastTelemetry.position;
+        wm.updateTelemetry(id, makeTelemetry({ x: p.x + (rng() - 0.5) * 0.3, y: p.y + (rng() - 0.5) * 0.3, z: 1 }));
+      }
+    }
+
+    for (const [id, drone] of wm.drones) {
+      const graph = drone.coordinate.epsilon;
+      for (const [otherId, other] of wm.drones) {
+        if (otherId === id) continue;
+        const d = vec3Distance(drone.lastTelemetry.position, other.lastTelemetry.position);
+        const linked = graph.neighbors.includes(otherId);
+        expect(linked).toBe(other.coordinate.epsilon.neighbors.includes(id));
+        if (d <= 3.0 - 0.4) expect(linked).toBe(true);
+        if (d > 3.0 + 2 * 0.4) expect(linked).toBe(false);
+      }
+    }
+  });
+});
+
 describe('WorldModel — delta detection (Δ classifier)', () => {
   it('Δ = 0 when no structural dimensions change', () => {
     const wm = new WorldModel();
@@ -5,6 +5,18 @@
  * Computes neighbor graphs (ε), detects structural changes (Δ),
  * and provides the shared state that the constraint engine,
  * blast radius engine, and role assignment all operate on.
+ *
+ * ε is maintained incrementally. Links are symmetric: both endpoints'
+ * neighbor lists change together, and each change is reported once to
+ * onNeighborChange listeners. A drone's links are re-evaluated only when
+ * it has moved far enough to matter (see neighborHysteresis); a role
+ * change re-derives leader/follower/relay fields without touching links.
+ *
+ * Internally every drone has a dense DroneRegistry slot; links, the
+ * spatial grid and per-drone bookkeeping are arrays indexed by slot.
+ * String IDs are kept for the public API and for ε itself. The scalars
+ * the coordinator scans each tick live in a WorldStore (typed arrays by
+ * slot); DroneState objects are views that read and write through to it.
  */
 
 import type {
@@ -21,6 +33,9 @@ import type {
   HardwareTarget,
 } from '../types/dimensions.js';
 import { extractCore } from '../types/dimensions.js';
+import { SpatialGrid } from './spatial-grid.js';
+import { DroneRegistry, SlotSet } from './drone-registry.js';
+import { WorldStore, CHI_LEADER, CHI_FOLLOWER, CHI_RELAY } from './world-store.js';
 
 // ---------------------------------------------------------------------------
 // Configuration
@@ -31,11 +46,28 @@ export interface WorldModelConfig {
   commRange: number;
   /** Stale threshold in ms. Drones not heard from in this time are marked stale. */
   staleThresholdMs: number;
+  /**
+   * For drones that advertise a variable telemetry rate: keepalive intervals
+   * that may be missed before the drone is stale. Its threshold is the larger
+   * of staleThresholdMs and this many keepalive intervals.
+   */
+  staleMissedKeepalives: number;
+  /**
+   * Hysteresis band on ε in meters. A link forms within commRange and
+   * breaks beyond commRange + neighborHysteresis, and a drone's links are
+   * re-evaluated only after it moves neighborHysteresis / 2 from where
+   * they were last evaluated. Drones closer than commRange −
+   * neighborHysteresis are therefore always linked, and drones farther
+   * than commRange + 2 × neighborHysteresis never are.
+   */
+  neighborHysteresis: number;
 }
 
 export const DEFAULT_CONFIG: WorldModelConfig = {
   commRange: 5.0,
   staleThresholdMs: 500,
+  staleMissedKeepalives: 3,
+  neighborHysteresis: 0.25,
 };
 
 // ---------------------------------------------------------------------------
@@ -45,14 +77,18 @@ export const DEFAULT_CONFIG: WorldModelConfig = {
 export interface DroneState {
   /** Unique drone identifier */
   id: string;
+  /** Dense registry slot (uint16), stable while the drone is registered */
+  slot: number;
   /** Full 9D coordinate */
   coordinate: DroneCoordinate;
   /** Currently executing pattern ID */
   currentPattern: string;
-  /** Most recent sensor data (δ) */
+  /** Most recent sensor data (δ). Replace through updateTelemetry, never in place. */
   lastTelemetry: SensorState;
   /** Timestamp of last telemetry update (Date.now()) */
   lastUpdate: number;
+  /** Longest gap the drone's adaptive telemetry rate allows (ms); 0 = fixed rate */
+  telemetryIntervalMs: number;
   /** Whether this drone is considered stale (no recent telemetry) */
   stale: boolean;
 }
@@ -71,9 +107,80 @@ export interface DeltaResult {
   changedDimensions: string[];
 }
 
+/**
+ * DroneState whose timestamps and stale flag live in the WorldStore, so
+ * staleness scans need not touch the objects.
+ */
+class StoredDrone implements DroneState {
+  readonly id: string;
+  readonly slot: number;
+  coordinate: DroneCoordinate;
+  currentPattern: string;
+  lastTelemetry: SensorState;
+  readonly #store: WorldStore;
+
+  constructor(store: WorldStore, id: string, slot: number, coordinate: DroneCoordinate, pattern: string, telemetry: SensorState) {
+    this.#store = store;
+    this.id = id;
+    this.slot = slot;
+    this.coordinate = coordinate;
+    this.currentPattern = pattern;
+    this.lastTelemetry = telemetry;
+  }
+
+  get lastUpdate(): number {
+    return this.#store.lastUpdate[this.slot]!;
+  }
+
+  set lastUpdate(value: number) {
+    this.#store.lastUpdate[this.slot] = value;
+  }
+
+  get telemetryIntervalMs(): number {
+    return this.#store.telemetryIntervalMs[this.slot]!;
+  }
+
+  set telemetryIntervalMs(value: number) {
+    this.#store.telemetryIntervalMs[this.slot] = value;
+  }
+
+  get stale(): boolean {
+    return this.#store.stale[this.slot] === 1;
+  }
+
+  set stale(value: boolean) {
+    this.#store.stale[this.slot] = value ? 1 : 0;
+  }
+}
+
 /** No change detected. */
 const NO_CHANGE: DeltaResult = { changed: false, structural: false, changedDimensions: [] };
 
+// ---------------------------------------------------------------------------
+// Neighbor Changes
+// ---------------------------------------------------------------------------
+
+/** One ε link formed or broken. Reported once per link, not per endpoint. */
+export interface NeighborChange {
+  type: 'link' | 'unlink';
+  /** The drone whose update caused the change */
+  droneId: string;
+  /** The other endpoint */
+  neighborId: string;
+}
+
+function emptyGraph(): NeighborGraph {
+  return {
+    neighbors: [],
+    leader: null,
+    followers: [],
+    relay_target: null,
+    relay_source: null,
+    dock_target: null,
+    base_stations: [], // Populated from positioning system, not world model
+  };
+}
+
 // ---------------------------------------------------------------------------
 // World Model
 // ---------------------------------------------------------------------------
@@ -81,9 +188,24 @@ const NO_CHANGE: DeltaResult = { changed: false, structural: false, changedDimen
 export class WorldModel {
   readonly config: WorldModelConfig;
   readonly drones: Map<string, DroneState> = new Map();
+  /** Dense slot per drone; every array below is indexed by slot. */
+  readonly registry: DroneRegistry = new DroneRegistry();
+  /** Per-slot typed-array columns mirroring the drones' scanned state. */
+  readonly store: WorldStore = new WorldStore();
+  private readonly bySlot: Array<DroneState | undefined> = [];
+  /** ε links as neighbor slots, in join order (mirrors epsilon.neighbors). */
+  private readonly links: number[][] = [];
+  /** Where each drone's links were last evaluated. */
+  private readonly anchors: Array<Vec3 | undefined> = [];
+  /** Drones filed by position in commRange-sized cells, for ε queries. */
+  private readonly grid: SpatialGrid;
+  /** Scratch membership for relink(); always left empty. */
+  private marks: SlotSet = new SlotSet(0);
+  private readonly neighborListeners: Array<(change: NeighborChange) => void> = [];
 
   constructor(config: Partial<WorldModelConfig> = {}) {
     this.config = { ...DEFAULT_CONFIG, ...config };
+    this.grid = new SpatialGrid(this.config.commRange);
   }
 
   // -----------------------------------------------------------------------
@@ -108,21 +230,29 @@ export class WorldModel {
       lambda: 'shared-corridor',
       tau,
       rho,
-      epsilon: this.computeNeighborGraph(id, telemetry.position),
+      epsilon: emptyGraph(),
       delta: telemetry,
       sigma_upper: '',
     };
 
-    const state: DroneState = {
-      id,
-      coordinate,
-      currentPattern: initialPattern,
-      lastTelemetry: telemetry,
-      lastUpdate: Date.now(),
-      stale: false,
-    };
+    const existing = this.drones.get(id);
+    if (existing) this.unlinkAll(existing.slot);
+    const slot = this.registry.acquire(id);
+    this.store.ensure(slot);
+    this.store.live[slot] = 1;
+    this.store.writeTelemetry(slot, telemetry);
+    this.store.writeCoordinate(slot, coordinate.sigma, coordinate.kappa, coordinate.chi, coordinate.lambda);
+
+    const state = new StoredDrone(this.store, id, slot, coordinate, initialPattern, telemetry);
+    state.lastUpdate = Date.now();
+    state.telemetryIntervalMs = 0;
+    state.stale = false;
 
     this.drones.set(id, state);
+    this.bySlot[slot] = state;
+    this.links[slot] = [];
+    this.grid.set(slot, telemetry.position);
+    this.relink(slot, telemetry.position);
     return state;
   }
 
@@ -131,6 +261,14 @@ export class WorldModel {
    * Called when a drone is powered off or lost.
    */
   removeDrone(id: string): boolean {
+    const drone = this.drones.get(id);
+    if (!drone) return false;
+    this.unlinkAll(drone.slot);
+    this.grid.delete(drone.slot);
+    this.anchors[drone.slot] = undefined;
+    this.bySlot[drone.slot] = undefined;
+    this.store.live[drone.slot] = 0;
+    this.registry.release(id);
     return this.drones.delete(id);
   }
 
@@ -141,6 +279,16 @@ export class WorldModel {
     return this.drones.get(id);
   }
 
+  /** A drone's state by registry slot. */
+  droneAt(slot: number): DroneState | undefined {
+    return this.bySlot[slot];
+  }
+
+  /** A drone's ε neighbors as registry slots, in the order of epsilon.neighbors. */
+  neighborSlots(slot: number): readonly number[] {
+    return this.links[slot] ?? [];
+  }
+
   /**
    * Get all active (non-stale) drone IDs.
    */
@@ -161,19 +309,26 @@ export class WorldModel {
 
   /**
    * Update a drone's sensor state from incoming telemetry.
-   * Recomputes the neighbor graph (ε) for the updated drone.
+   * Re-evaluates the drone's ε links if it has moved at least
+   * neighborHysteresis / 2 since they were last evaluated.
+   * `maxIntervalMs` is the drone's advertised keepalive interval, if it
+   * adapts its telemetry rate; it stretches the drone's stale threshold.
    */
-  updateTelemetry(droneId: string, telemetry: SensorState): void {
+  updateTelemetry(droneId: string, telemetry: SensorState, maxIntervalMs?: number): void {
     const drone = this.drones.get(droneId);
     if (!drone) return;
 
     drone.lastTelemetry = telemetry;
     drone.coordinate.delta = telemetry;
+    this.store.writeTelemetry(drone.slot, telemetry);
     drone.lastUpdate = Date.now();
     drone.stale = false;
+    if (maxIntervalMs !== undefined) drone.telemetryIntervalMs = maxIntervalMs;
+    this.grid.set(drone.slot, telemetry.position);
 
-    // Recompute neighbor graph based on new position
-    drone.coordinate.epsilon = this.computeNeighborGraph(droneId, telemetry.position);
+    const anchor = this.anchors[drone.slot];
+    if (anchor && vec3Distance(anchor, telemetry.position) < this.config.neighborHysteresis / 2) return;
+    this.relink(drone.slot, telemetry.position);
   }
 
   /**
@@ -199,21 +354,43 @@ export class WorldModel {
     drone.coordinate.kappa = kappa;
     drone.coordinate.chi = chi;
     drone.coordinate.lambda = lambda;
+    this.store.writeCoordinate(drone.slot, sigma, kappa, chi, lambda);
+
+    // Role links are derived from both endpoints' χ
+    if (oldCore.chi !== chi) {
+      this.deriveRoles(drone.slot);
+      for (const other of this.links[drone.slot]!) this.deriveRoles(other);
+    }
 
     return this.detectDelta(oldCore, extractCore(drone.coordinate));
   }
 
   /**
-   * Mark drones as stale if their last telemetry is too old.
+   * Stale threshold for one drone (ms): staleThresholdMs, stretched to
+   * staleMissedKeepalives intervals for drones that report at a slower
+   * keepalive rate while idle.
+   */
+  staleThresholdFor(drone: DroneState): number {
+    return Math.max(
+      this.config.staleThresholdMs,
+      drone.telemetryIntervalMs * this.config.staleMissedKeepalives,
+    );
+  }
+
+  /**
+   * Mark drones as stale if their last telemetry is too old for their rate.
+   * Returns the newly stale drones' IDs in slot order.
    */
   markStaleDrones(now: number = Date.now()): string[] {
     const staleIds: string[] = [];
-    for (const drone of this.drones.values()) {
-      const wasStale = drone.stale;
-      drone.stale = (now - drone.lastUpdate) > this.config.staleThresholdMs;
-      if (drone.stale && !wasStale) {
-        staleIds.push(drone.id);
-      }
+    const { live, stale, lastUpdate, telemetryIntervalMs } = this.store;
+    const { staleThresholdMs, staleMissedKeepalives } = this.config;
+    for (let slot = 0; slot < this.registry.capacity; slot++) {
+      if (live[slot] === 0) continue;
+      const threshold = Math.max(staleThresholdMs, telemetryIntervalMs[slot]! * staleMissedKeepalives);
+      const isStale = now - lastUpdate[slot]! > threshold ? 1 : 0;
+      if (isStale === 1 && stale[slot] === 0) staleIds.push(this.bySlot[slot]!.id);
+      stale[slot] = isStale;
     }
     return staleIds;
   }
@@ -223,55 +400,28 @@ export class WorldModel {
   // -----------------------------------------------------------------------
 
   /**
-   * Compute the neighbor graph for a drone at a given position.
-   * Neighbors are all other drones within communication range.
+   * Compute the neighbor graph for a drone at a given position from
+   * scratch, without hysteresis and without changing the world model.
+   * Neighbors are all other drones within communication range, listed in
+   * the order they joined. Only the 27 grid cells around `position` are
+   * searched, so the cost follows local density rather than swarm size.
    */
   computeNeighborGraph(droneId: string, position: Vec3): NeighborGraph {
-    const neighbors: string[] = [];
-    let leader: string | null = null;
-    const followers: string[] = [];
-    let relayTarget: string | null = null;
-    let relaySource: string | null = null;
-    let dockTarget: string | null = null;
-
-    for (const [otherId, other] of this.drones) {
-      if (otherId === droneId) continue;
-
-      const dist = vec3Distance(position, other.lastTelemetry.position);
-      if (dist <= this.config.commRange) {
-        neighbors.push(otherId);
-
-        // Derive role relationships from structural coordinates
-        const myDrone = this.drones.get(droneId);
-        if (myDrone) {
-          // If I'm a follower and the other is a leader, they're my leader
-          if (myDrone.coordinate.chi === 'follower' && other.coordinate.chi === 'leader') {
-            leader = otherId;
-          }
-          // If I'm a leader and the other is a follower, they're my follower
-          if (myDrone.coordinate.chi === 'leader' && other.coordinate.chi === 'follower') {
-            followers.push(otherId);
-          }
-          // Relay relationships
-          if (myDrone.coordinate.chi === 'relay') {
-            relayTarget = otherId; // Simplified: relay targets nearest neighbor
-          }
-          if (other.coordinate.chi === 'relay') {
-            relaySource = otherId;
-          }
-        }
-      }
-    }
+    const graph = emptyGraph();
+    const slots = this.grid.within(position, this.config.commRange, this.registry.slotOf(droneId));
+    graph.neighbors = slots.map((slot) => this.bySlot[slot]!.id);
+    const drone = this.drones.get(droneId);
+    if (drone) this.fillRoles(drone.slot, graph, slots);
+    else clearRoles(graph);
+    return graph;
+  }
 
-    return {
-      neighbors,
-      leader,
-      followers,
-      relay_target: relayTarget,
-      relay_source: relaySource,
-      dock_target: dockTarget,
-      base_stations: [], // Populated from positioning system, not world model
-    };
+  /**
+   * Subscribe to ε link changes. Listeners run synchronously, after both
+   * endpoints' graphs have been updated.
+   */
+  onNeighborChange(listener: (change: NeighborChange) => void): void {
+    this.neighborListeners.push(listener);
   }
 
   /**
@@ -281,6 +431,117 @@ export class WorldModel {
     return this.drones.get(droneId)?.coordinate.epsilon;
   }
 
+  /**
+   * Re-evaluate one drone's links at `position`: break those beyond
+   * commRange + neighborHysteresis, form new ones within commRange.
+   */
+  private relink(slot: number, position: Vec3): void {
+    const breakAt = this.config.commRange + this.config.neighborHysteresis;
+    const marks = this.scratchMarks();
+    const kept: number[] = [];
+    const changed: number[] = [];
+    const changes: NeighborChange[] = [];
+    const droneId = this.bySlot[slot]!.id;
+
+    for (const other of this.links[slot]!) {
+      if (this.store.distanceSq(slot, other) > breakAt * breakAt) {
+        removeSlot(this.links[other]!, slot);
+        changed.push(other);
+        changes.push({ type: 'unlink', droneId, neighborId: this.bySlot[other]!.id });
+      } else {
+        kept.push(other);
+        marks.add(other);
+      }
+    }
+    for (const other of this.grid.within(position, this.config.commRange, slot)) {
+      if (marks.has(other)) continue;
+      kept.push(other);
+      this.insertByJoinOrder(this.links[other]!, slot);
+      changed.push(other);
+      changes.push({ type: 'link', droneId, neighborId: this.bySlot[other]!.id });
+    }
+    for (const other of this.links[slot]!) marks.delete(other);
+    this.anchors[slot] = position;
+    if (changes.length === 0) return;
+
+    kept.sort((a, b) => this.grid.seqOf(a) - this.grid.seqOf(b));
+    this.links[slot] = kept;
+    this.syncGraph(slot);
+    for (const other of changed) this.syncGraph(other);
+    this.emit(changes);
+  }
+
+  /** Break every link of a drone that is leaving or being replaced. */
+  private unlinkAll(slot: number): void {
+    const droneId = this.bySlot[slot]!.id;
+    const others = this.links[slot]!;
+    this.links[slot] = [];
+    this.syncGraph(slot);
+    for (const other of others) {
+      removeSlot(this.links[other]!, slot);
+      this.syncGraph(other);
+    }
+    this.emit(others.map((other): NeighborChange => ({
+      type: 'unlink', droneId, neighborId: this.bySlot[other]!.id,
+    })));
+  }
+
+  /** Rewrite a drone's ε from its links. */
+  private syncGraph(slot: number): void {
+    this.bySlot[slot]!.coordinate.epsilon.neighbors = this.links[slot]!.map((other) => this.bySlot[other]!.id);
+    this.deriveRoles(slot);
+  }
+
+  private deriveRoles(slot: number): void {
+    this.fillRoles(slot, this.bySlot[slot]!.coordinate.epsilon, this.links[slot]!);
+  }
+
+  /** Fill a graph's role links from its neighbors (in ε order) and χ on both ends. */
+  private fillRoles(slot: number, graph: NeighborGraph, neighbors: readonly number[]): void {
+    clearRoles(graph);
+    const roles = this.store.chi;
+    const chi = roles[slot];
+    for (const other of neighbors) {
+      const otherChi = roles[other];
+      // If I'm a follower and the other is a leader, they're my leader
+      if (chi === CHI_FOLLOWER && otherChi === CHI_LEADER) {
+        graph.leader = this.bySlot[other]!.id;
+      }
+      // If I'm a leader and the other is a follower, they're my follower
+      if (chi === CHI_LEADER && otherChi === CHI_FOLLOWER) {
+        graph.followers.push(this.bySlot[other]!.id);
+      }
+      // Relay relationships
+      if (chi === CHI_RELAY) {
+        graph.relay_target = this.bySlot[other]!.id; // Simplified: relay targets nearest neighbor
+      }
+      if (otherChi === CHI_RELAY) {
+        graph.relay_source = this.bySlot[other]!.id;
+      }
+    }
+  }
+
+  /** Empty SlotSet covering every slot in use. */
+  private scratchMarks(): SlotSet {
+    if (this.marks.capacity < this.registry.capacity) {
+      this.marks = new SlotSet(this.registry.capacity * 2);
+    }
+    return this.marks;
+  }
+
+  private insertByJoinOrder(links: number[], slot: number): void {
+    const seq = this.grid.seqOf(slot);
+    let i = links.length;
+    while (i > 0 && this.grid.seqOf(links[i - 1]!) > seq) i--;
+    links.splice(i, 0, slot);
+  }
+
+  private emit(changes: NeighborChange[]): void {
+    for (const change of changes) {
+      for (const listener of this.neighborListeners) listener(change);
+    }
+  }
+
   // -----------------------------------------------------------------------
   // Delta Detection (Δ Classifier)
   // -----------------------------------------------------------------------
@@ -316,6 +577,20 @@ export class WorldModel {
 // Utilities
 // ---------------------------------------------------------------------------
 
+/** Clear a graph's role links. */
+function clearRoles(graph: NeighborGraph): void {
+  graph.leader = null;
+  graph.followers = [];
+  graph.relay_target = null;
+  graph.relay_source = null;
+}
+
+/** Remove one occurrence of `slot` from `list`, in place. */
+function removeSlot(list: number[], slot: number): void {
+  const i = list.indexOf(slot);
+  if (i >= 0) list.splice(i, 1);
+}
+
 /** Euclidean distance between two Vec3 points. */
 export function vec3Distance(a: Vec3, b: Vec3): number {
   const dx = a.x - b.x;
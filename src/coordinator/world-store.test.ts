@@ -0,0 +1,76 @@
+import { describe, it, expect } from 'vitest';
+import { WorldStore, CHI_CODE, SIGMA_CODE, NO_CODE } from './world-store.js';
+import { WorldModel } from './world-model.js';
+import type { SensorState, Vec3 } from '../types/dimensions.js';
+
+function makeTelemetry(pos: Vec3, battery = 0.8): SensorState {
+  return {
+    position: pos,
+    velocity: { x: 0.5, y: 0, z: -0.5 },
+    orientation: { x: 0, y: 0, z: 0 },
+    angular_velocity: { x: 0, y: 0, z: 0 },
+    battery: { voltage: 3.7, percentage: battery, discharge_rate: 2.5, estimated_remaining: 300 },
+    position_quality: 0.95,
+    wind_estimate: { x: 0, y: 0, z: 0 },
+  };
+}
+
+describe('WorldStore', () => {
+  it('keeps every column\'s values when it grows', () => {
+    const store = new WorldStore();
+    store.ensure(3);
+    store.writeTelemetry(3, makeTelemetry({ x: 1, y: 2, z: 3 }, 0.4));
+    store.writeCoordinate(3, 'hover', 'autonomous', 'leader', 'shared-corridor');
+    const before = store.capacity;
+
+    store.ensure(before * 4);
+    expect(store.capacity).toBeGreaterThan(before * 4);
+    expect(Array.from(store.position.subarray(9, 12))).toEqual([1, 2, 3]);
+    expect(store.battery[3]).toBe(0.4);
+    expect(store.chi[3]).toBe(CHI_CODE.get('leader'));
+  });
+
+  it('stores unknown enum values as NO_CODE', () => {
+    const store = new WorldStore();
+    store.ensure(0);
+    store.writeCoordinate(0, 'not-a-mode' as never, 'autonomous', 'reserve', 'shared-corridor');
+    expect(store.sigma[0]).toBe(NO_CODE);
+  });
+});
+
+describe('WorldModel — world store', () => {
+  it('mirrors telemetry and pattern updates into the drone\'s slot', () => {
+    const wm = new WorldModel();
+    wm.addDrone('d1', 'crazyflie-2.1', 'bare', 'hover', makeTelemetry({ x: 0, y: 0, z: 1 }));
+    const slot = wm.getDrone('d1')!.slot;
+
+    wm.updateTelemetry('d1', makeTelemetry({ x: 4, y: 5, z: 6 }, 0.3));
+    wm.updatePattern('d1', 'p', 'orbit', 'autonomous', 'relay', 'shared-corridor');
+
+    expect(Array.from(wm.store.position.subarray(slot * 3, slot * 3 + 3))).toEqual([4, 5, 6]);
+    expect(wm.store.battery[slot]).toBe(0.3);
+    expect(wm.store.sigma[slot]).toBe(SIGMA_CODE.get('orbit'));
+    expect(wm.store.chi[slot]).toBe(CHI_CODE.get('relay'));
+  });
+
+  it('reads and writes DroneState timestamps and staleness through the store', () => {
+    const wm = new WorldModel({ staleThresholdMs: 100 });
+    const drone = wm.addDrone('d1', 'crazyflie-2.1', 'bare', 'hover', makeTelemetry({ x: 0, y: 0, z: 1 }));
+
+    drone.lastUpdate = 1000;
+    expect(wm.store.lastUpdate[drone.slot]).toBe(1000);
+    expect(wm.markStaleDrones(1200)).toEqual(['d1']);
+    expect(drone.stale).toBe(true);
+    expect(wm.store.stale[drone.slot]).toBe(1);
+  });
+
+  it('skips freed slots when scanning for stale drones', () => {
+    const wm = new WorldModel({ staleThresholdMs: 100 });
+    wm.addDrone('d1', 'crazyflie-2.1', 'bare', 'hover', makeTelemetry({ x: 0, y: 0, z: 1 }));
+    wm.addDrone('d2', 'crazyflie-2.1', 'bare', 'hover', makeTelemetry({ x: 9, y: 0, z: 1 }));
+    wm.getDrone('d1')!.lastUpdate = 0;
+    wm.removeDrone('d1');
+    wm.getDrone('d2')!.lastUpdate = 0;
+    expect(wm.markStaleDrones(1000)).toEqual(['d2']);
+  });
+});
@@ -0,0 +1,152 @@
+/**
+ * Seshat Swarm — World Store
+ *
+ * Structure-of-arrays copy of the per-drone state the coordinator scans
+ * every tick: position, velocity, battery, position quality, timestamps
+ * and the structural coordinate enums, each in one typed array indexed
+ * by DroneRegistry slot. A scan over the swarm (staleness, role rules,
+ * ε distance checks) reads contiguous memory instead of chasing each
+ * drone's nested telemetry objects.
+ *
+ * WorldModel owns the store and writes it whenever it accepts telemetry
+ * or a pattern assignment; DroneState objects remain the public view.
+ * Columns are reallocated when the store grows, so callers must not hold
+ * on to a column across calls that can add drones.
+ *
+ * Columns are Float64Array rather than Float32Array: the role and
+ * precondition thresholds compare battery and quality against values
+ * like 0.90, which float32 cannot represent (0.9f < 0.9).
+ */
+
+import type {
+  SensorState,
+  BehavioralMode,
+  AutonomyLevel,
+  FormationRole,
+  ResourceOwnership,
+} from '../types/dimensions.js';
+import {
+  BEHAVIORAL_MODES,
+  AUTONOMY_LEVELS,
+  FORMATION_ROLES,
+  RESOURCE_OWNERSHIPS,
+} from '../types/dimensions.js';
+
+// ---------------------------------------------------------------------------
+// Enum Codes
+// ---------------------------------------------------------------------------
+
+/** Code of each value in the coordinate enums: its index in the value list. */
+function codes<T extends string>(values: readonly T[]): ReadonlyMap<T, number> {
+  return new Map(values.map((value, i) => [value, i]));
+}
+
+export const SIGMA_CODE = codes<BehavioralMode>(BEHAVIORAL_MODES);
+export const KAPPA_CODE = codes<AutonomyLevel>(AUTONOMY_LEVELS);
+export const CHI_CODE = codes<FormationRole>(FORMATION_ROLES);
+export const LAMBDA_CODE = codes<ResourceOwnership>(RESOURCE_OWNERSHIPS);
+
+/** Role codes tested in the hot loops. */
+export const CHI_LEADER = CHI_CODE.get('leader')!;
+export const CHI_FOLLOWER = CHI_CODE.get('follower')!;
+export const CHI_RELAY = CHI_CODE.get('relay')!;
+
+/** Stored for values outside the enum lists (e.g. the empty initial state). */
+export const NO_CODE = 0xff;
+
+// ---------------------------------------------------------------------------
+// Store
+// ---------------------------------------------------------------------------
+
+const INITIAL_CAPACITY = 64;
+
+export class WorldStore {
+  /** Slots the columns currently hold. */
+  capacity = 0;
+
+  /** x, y, z per slot */
+  position = new Float64Array(0);
+  /** x, y, z per slot */
+  velocity = new Float64Array(0);
+  /** State of charge (0-1) */
+  battery = new Float64Array(0);
+  /** Forecast flight seconds (battery.estimated_remaining); 0 = unknown */
+  flightRemaining = new Float64Array(0);
+  positionQuality = new Float64Array(0);
+  /** Date.now() of the last telemetry */
+  lastUpdate = new Float64Array(0);
+  /** Advertised keepalive interval (ms); 0 = fixed rate */
+  telemetryIntervalMs = new Float64Array(0);
+  /** 1 while the slot holds a drone */
+  live = new Uint8Array(0);
+  stale = new Uint8Array(0);
+  sigma = new Uint8Array(0);
+  kappa = new Uint8Array(0);
+  chi = new Uint8Array(0);
+  lambda = new Uint8Array(0);
+
+  /** Make room for `slot`, doubling the columns as needed. */
+  ensure(slot: number): void {
+    if (slot < this.capacity) return;
+    let capacity = Math.max(this.capacity, INITIAL_CAPACITY);
+    while (capacity <= slot) capacity *= 2;
+
+    this.position = grow(this.position, capacity * 3);
+    this.velocity = grow(this.velocity, capacity * 3);
+    this.battery = grow(this.battery, capacity);
+    this.flightRemaining = grow(this.flightRemaining, capacity);
+    this.positionQuality = grow(this.positionQuality, capacity);
+    this.lastUpdate = grow(this.lastUpdate, capacity);
+    this.telemetryIntervalMs = grow(this.telemetryIntervalMs, capacity);
+    this.live = grow(this.live, capacity);
+    this.stale = grow(this.stale, capacity);
+    this.sigma = grow(this.sigma, capacity);
+    this.kappa = grow(this.kappa, capacity);
+    this.chi = grow(this.chi, capacity);
+    this.lambda = grow(this.lambda, capacity);
+    this.capacity = capacity;
+  }
+
+  /** Copy the scanned fields of one telemetry report into `slot`. */
+  writeTelemetry(slot: number, telemetry: SensorState): void {
+    const i = slot * 3;
+    this.position[i] = telemetry.position.x;
+    this.position[i + 1] = telemetry.position.y;
+    this.position[i + 2] = telemetry.position.z;
+    this.velocity[i] = telemetry.velocity.x;
+    this.velocity[i + 1] = telemetry.velocity.y;
+    this.velocity[i + 2] = telemetry.velocity.z;
+    this.battery[slot] = telemetry.battery.percentage;
+    this.flightRemaining[slot] = telemetry.battery.estimated_remaining;
+    this.positionQuality[slot] = telemetry.position_quality;
+  }
+
+  writeCoordinate(
+    slot: number,
+    sigma: BehavioralMode,
+    kappa: AutonomyLevel,
+    chi: FormationRole,
+    lambda: ResourceOwnership,
+  ): void {
+    this.sigma[slot] = SIGMA_CODE.get(sigma) ?? NO_CODE;
+    this.kappa[slot] = KAPPA_CODE.get(kappa) ?? NO_CODE;
+    this.chi[slot] = CHI_CODE.get(chi) ?? NO_CODE;
+    this.lambda[slot] = LAMBDA_CODE.get(lambda) ?? NO_CODE;
+  }
+
+  /** Squared distance between two slots' positions. */
+  distanceSq(a: number, b: number): number {
+    const i = a * 3;
+    const j = b * 3;
+    const dx = this.position[i]! - this.position[j]!;
+    const dy = this.position[i + 1]! - this.position[j + 1]!;
+    const dz = this.position[i + 2]! - this.position[j + 2]!;
+    return dx * dx + dy * dy + dz * dz;
+  }
+}
+
+function grow<T extends Float64Array | Uint8Array>(column: T, length: number): T {
+  const next = new (column.constructor as new (length: number) => T)(length);
+  next.set(column);
+  return next;
+}
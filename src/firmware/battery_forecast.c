@@ -0,0 +1,188 @@
+/**
+ * Seshat Swarm — Battery / Energy Forecaster Implementation
+ *
+ * All EWMAs use alpha = dt / (tau + dt), so the forecast behaves the same
+ * whatever rate the caller updates at. State is a few floats per
+ * generator type; nothing is stored per sample.
+ *
+ * Target: STM32F405 (Crazyflie 2.1+), arm-none-eabi-gcc.
+ */
+
+#include "battery_forecast.h"
+#include "telemetry_reporter.h"
+
+/* -----------------------------------------------------------------------
+ * State
+ * ----------------------------------------------------------------------- */
+
+static const BatteryForecastConfig s_defaults = BATTERY_FORECAST_DEFAULTS;
+
+/** A resistance sample's reference point goes stale after this long. */
+#define SAG_REF_MAX_AGE_US  2000000u
+
+/** Below this the drone is effectively unpowered; remaining saturates. */
+#define MIN_POWER_W  0.05f
+
+static struct {
+    BatteryForecastConfig cfg;
+    uint8_t  started;
+    uint32_t last_us;
+    float    v_filt;
+    float    i_filt;
+    float    v_ref;
+    float    i_ref;
+    uint32_t ref_us;
+    float    resistance;
+    uint8_t  have_resistance;
+    float    power[GEN_COUNT];
+    uint8_t  have_power[GEN_COUNT];
+    BatteryForecast out;
+} s_fc;
+
+/* -----------------------------------------------------------------------
+ * Internal helpers
+ * ----------------------------------------------------------------------- */
+
+/**
+ * 1S LiPo resting voltage at 0%, 10%, ... 100% state of charge. Energy is
+ * close enough to linear in state of charge over this curve.
+ */
+static const float k_soc_curve[11] = {
+    3.30f, 3.65f, 3.70f, 3.73f, 3.77f, 3.80f, 3.84f, 3.88f, 3.95f, 4.05f, 4.20f,
+};
+
+static float soc_from_voltage(float v) {
+    int i;
+    if (!(v > k_soc_curve[0])) return 0.0f;
+    for (i = 1; i < 11; i++) {
+        if (v < k_soc_curve[i]) {
+            float f = (v - k_soc_curve[i - 1]) / (k_soc_curve[i] - k_soc_curve[i - 1]);
+            return ((float)(i - 1) + f) * 0.1f;
+        }
+    }
+    return 1.0f;
+}
+
+static float ewma(float avg, float sample, float dt, float tau) {
+    return avg + (sample - avg) * (dt / (tau + dt));
+}
+
+/** Seconds from resting state of charge `soc` at a steady `power_w`. */
+static uint16_t remaining_at(float soc, float power_w) {
+    float i_end, soc_end, seconds;
+
+    if (power_w < MIN_POWER_W) return BATTERY_FORECAST_UNKNOWN - 1u;
+
+    /* Empty when resting voltage − I·R reaches cutoff, with I taken at
+     * cutoff voltage (the worst case, as current rises while V falls). */
+    i_end = power_w / s_fc.cfg.v_cutoff;
+    soc_end = soc_from_voltage(s_fc.cfg.v_cutoff + i_end * s_fc.resistance);
+    if (soc <= soc_end) return 0;
+
+    seconds = (soc - soc_end) * s_fc.cfg.capacity_j / power_w;
+    return seconds < 65534.0f ? (uint16_t)seconds : (uint16_t)(BATTERY_FORECAST_UNKNOWN - 1u);
+}
+
+static void update_resistance(uint32_t now_us) {
+    float di = s_fc.i_filt - s_fc.i_ref;
+    float r;
+
+    if (now_us - s_fc.ref_us > SAG_REF_MAX_AGE_US) {
+        /* Too long since the reference: state of charge has moved too. */
+        s_fc.v_ref = s_fc.v_filt;
+        s_fc.i_ref = s_fc.i_filt;
+        s_fc.ref_us = now_us;
+        return;
+    }
+    if (di < s_fc.cfg.min_step_a && di > -s_fc.cfg.min_step_a) return;
+
+    r = -(s_fc.v_filt - s_fc.v_ref) / di;
+    if (r > 0.0f && r < 1.0f) {
+        float dt = (float)(now_us - s_fc.ref_us) * 1e-6f;
+        s_fc.resistance = s_fc.have_resistance
+            ? ewma(s_fc.resistance, r, dt, s_fc.cfg.sag_tau_s) : r;
+        s_fc.have_resistance = 1;
+    }
+    s_fc.v_ref = s_fc.v_filt;
+    s_fc.i_ref = s_fc.i_filt;
+    s_fc.ref_us = now_us;
+}
+
+static void publish(void) {
+    float soc = s_fc.out.resting_soc * 200.0f + 0.5f;
+    float r = s_fc.out.resistance_ohm * 250.0f + 0.5f;   /* 4 mΩ units */
+    telemetry_set_forecast(s_fc.out.remaining_s,
+                           soc < 200.0f ? (uint8_t)soc : 200u,
+                           r < 255.0f ? (uint8_t)r : 255u);
+}
+
+/* -----------------------------------------------------------------------
+ * Public API
+ * ----------------------------------------------------------------------- */
+
+void battery_forecast_init(const BatteryForecastConfig* cfg) {
+    uint8_t g;
+
+    s_fc.cfg = cfg ? *cfg : s_defaults;
+    s_fc.started = 0;
+    s_fc.resistance = 0.0f;
+    s_fc.have_resistance = 0;
+    for (g = 0; g < GEN_COUNT; g++) {
+        s_fc.power[g] = 0.0f;
+        s_fc.have_power[g] = 0;
+    }
+    s_fc.out.remaining_s = BATTERY_FORECAST_UNKNOWN;
+    s_fc.out.resting_soc = 0.0f;
+    s_fc.out.resistance_ohm = 0.0f;
+    s_fc.out.power_w = 0.0f;
+    publish();
+}
+
+void battery_forecast_update(const SensorState* state, uint8_t generator_type,
+                             uint32_t now_us) {
+    float v = state->battery_voltage;
+    float p = state->discharge_rate;
+    float dt;
+    uint8_t g = (uint8_t)(generator_type % GEN_COUNT);
+
+    if (!(v > 1.0f) || !(p >= 0.0f)) return;
+
+    if (!s_fc.started) {
+        s_fc.started = 1;
+        s_fc.v_filt = v;
+        s_fc.i_filt = p / v;
+        s_fc.v_ref = v;
+        s_fc.i_ref = s_fc.i_filt;
+        s_fc.ref_us = now_us;
+        dt = 0.0f;
+    } else {
+        dt = (float)(now_us - s_fc.last_us) * 1e-6f;
+        s_fc.v_filt = ewma(s_fc.v_filt, v, dt, s_fc.cfg.filter_tau_s);
+        s_fc.i_filt = ewma(s_fc.i_filt, p / v, dt, s_fc.cfg.filter_tau_s);
+        update_resistance(now_us);
+    }
+    s_fc.last_us = now_us;
+
+    if (s_fc.have_power[g]) {
+        s_fc.power[g] = ewma(s_fc.power[g], p, dt, s_fc.cfg.power_tau_s);
+    } else {
+        s_fc.power[g] = p;
+        s_fc.have_power[g] = 1;
+    }
+
+    s_fc.out.resting_soc = soc_from_voltage(s_fc.v_filt + s_fc.i_filt * s_fc.resistance);
+    s_fc.out.resistance_ohm = s_fc.resistance;
+    s_fc.out.power_w = s_fc.power[g];
+    s_fc.out.remaining_s = remaining_at(s_fc.out.resting_soc, s_fc.power[g]);
+    publish();
+}
+
+const BatteryForecast* battery_forecast_get(void) {
+    return &s_fc.out;
+}
+
+uint16_t battery_forecast_remaining_for(uint8_t generator_type) {
+    uint8_t g = (uint8_t)(generator_type % GEN_COUNT);
+    if (!s_fc.have_power[g]) return BATTERY_FORECAST_UNKNOWN;
+    return remaining_at(s_fc.out.resting_soc, s_fc.power[g]);
+}
@@ -0,0 +1,81 @@
+/**
+ * Seshat Swarm — Battery / Energy Forecaster
+ *
+ * Estimates how many seconds of flight remain at the current pattern's
+ * energy rate, incrementally, so the ground can plan charger swaps from
+ * one telemetry field instead of fitting per-drone history.
+ *
+ * Per update, O(1) and no history:
+ *   - Power: an EWMA of SensorState.discharge_rate per generator type, so
+ *     switching pattern switches to that pattern's learned draw at once.
+ *   - Sag: an EWMA of the pack's internal resistance, taken from voltage
+ *     steps across current steps (ΔV / ΔI) on a lightly filtered V and I.
+ *   - Resting voltage: loaded voltage + I·R, mapped to state of charge
+ *     through a 1S LiPo discharge curve. Unlike the loaded voltage behind
+ *     battery_pct, this does not jump when the drone throttles up.
+ *   - Remaining: energy between the resting state of charge and the point
+ *     where the loaded voltage at this pattern's current would hit
+ *     v_cutoff, divided by this pattern's power. Hungrier patterns lose
+ *     both ways: more power, and more of the pack stranded behind sag.
+ *
+ * The result is published in the TELEM_EXT_FORECAST telemetry slot.
+ *
+ * Usage:
+ *   battery_forecast_init(NULL);                 // Crazyflie 2.1 defaults
+ *   // Control loop, any rate from 10 Hz up:
+ *   battery_forecast_update(&sensor, entry->generator_type, now_us());
+ *
+ * Target: STM32F405 (Crazyflie 2.1+), arm-none-eabi-gcc.
+ */
+
+#ifndef SESHAT_SWARM_BATTERY_FORECAST_H
+#define SESHAT_SWARM_BATTERY_FORECAST_H
+
+#include "types.h"
+
+typedef struct {
+    float capacity_j;      /* Pack energy, full to empty at rest            */
+    float v_cutoff;        /* Loaded voltage the pack must stay above       */
+    float power_tau_s;     /* Time constant of the per-pattern power EWMA   */
+    float sag_tau_s;       /* Time constant of the resistance EWMA          */
+    float filter_tau_s;    /* Pre-filter on V and I before ΔV / ΔI          */
+    float min_step_a;      /* Current step needed for a resistance sample   */
+} BatteryForecastConfig;
+
+/* 250 mAh × 3.7 V; 3.0 V cutoff; 5 s power, 20 s sag, 0.2 s filter; 0.3 A */
+#define BATTERY_FORECAST_DEFAULTS { 3330.0f, 3.0f, 5.0f, 20.0f, 0.2f, 0.3f }
+
+/** remaining_s before the current pattern's power has been learned. */
+#define BATTERY_FORECAST_UNKNOWN  0xFFFFu
+
+typedef struct {
+    uint16_t remaining_s;  /* At the current pattern; BATTERY_FORECAST_UNKNOWN */
+    float resting_soc;     /* Sag-compensated state of charge, 0.0–1.0      */
+    float resistance_ohm;  /* Internal resistance; 0 until first estimate   */
+    float power_w;         /* Learned power of the current pattern          */
+} BatteryForecast;
+
+/**
+ * Configure the forecaster (NULL for BATTERY_FORECAST_DEFAULTS) and
+ * forget everything learned.
+ */
+void battery_forecast_init(const BatteryForecastConfig* cfg);
+
+/**
+ * Fold one sensor sample in and refresh the forecast and its telemetry
+ * slot. `generator_type` is the active pattern's GeneratorType.
+ */
+void battery_forecast_update(const SensorState* state, uint8_t generator_type,
+                             uint32_t now_us);
+
+/** The forecast as of the last update. */
+const BatteryForecast* battery_forecast_get(void);
+
+/**
+ * Seconds remaining if the drone switched to `generator_type` now, from
+ * that type's learned power. BATTERY_FORECAST_UNKNOWN if it has not been
+ * flown since init.
+ */
+uint16_t battery_forecast_remaining_for(uint8_t generator_type);
+
+#endif /* SESHAT_SWARM_BATTERY_FORECAST_H */
@@ -3,8 +3,9 @@
  *
  * AUTO-GENERATED by scripts/compile-catalog.ts
  * DO NOT EDIT MANUALLY — regenerate with: pnpm compile-catalog
- * Generated: 2026-02-09T04:36:05.766Z
- * Patterns: 50
+ * Generated: 2026-10-16T11:58:32.187Z
+ * Patterns: 34
+ * Target: crazyflie-2.1
  */
 
 #ifndef SESHAT_CATALOG_DATA_H
@@ -12,8 +13,21 @@
 
 #include "types.h"
 
-#define CATALOG_SIZE 50
+#define CATALOG_SIZE 34
+#define CATALOG_RHO RHO_CRAZYFLIE_2_1
 
+/* Generators referenced by this catalog (bit n = GeneratorType n) */
+#define GEN_USED_MASK 0xFBu
+#define GEN_USES_POSITION_HOLD 1
+#define GEN_USES_VELOCITY_TRACK 1
+#define GEN_USES_WAYPOINT_SEQUENCE 0
+#define GEN_USES_RELATIVE_OFFSET 1
+#define GEN_USES_ORBIT_CENTER 1
+#define GEN_USES_TRAJECTORY_SPLINE 1
+#define GEN_USES_EMERGENCY_STOP 1
+#define GEN_USES_IDLE 1
+
+/* Entries are stored in ID order: CATALOG[i].id == i. */
 static const PatternEntry CATALOG[CATALOG_SIZE] = {
     /* [0] avoid-emergency-performer-bare.crazyflie-2.1 */
     {
@@ -26,20 +40,9 @@ static const PatternEntry CATALOG[CATALOG_SIZE] = {
         .battery_floor = 0.0f,
         .pos_quality_floor = 0.0f,
     },
-    /* [1] avoid-emergency-performer-bare.sim-gazebo */
+    /* [1] dock-autonomous-charger-inbound-bare.crazyflie-2.1 */
     {
         .id = 1,
-        .generator_type = 6,
-        ._pad = 0,
-        .defaults = { 0.5f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
-        .bounds_min = { 0.2f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
-        .bounds_max = { 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
-        .battery_floor = 0.0f,
-        .pos_quality_floor = 0.0f,
-    },
-    /* [2] dock-autonomous-charger-inbound-bare.crazyflie-2.1 */
-    {
-        .id = 2,
         .generator_type = 1,
         ._pad = 0,
         .defaults = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
@@ -48,9 +51,9 @@ static const PatternEntry CATALOG[CATALOG_SIZE] = {
         .battery_floor = 0.03f,
         .pos_quality_floor = 0.7f,
     },
-    /* [3] docked-autonomous-charging-bare.crazyflie-2.1 */
+    /* [2] docked-autonomous-charging-bare.crazyflie-2.1 */
     {
-        .id = 3,
+        .id = 2,
         .generator_type = 7,
         ._pad = 0,
         .defaults = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
@@ -59,31 +62,9 @@ static const PatternEntry CATALOG[CATALOG_SIZE] = {
         .battery_floor = 0.0f,
         .pos_quality_floor = 0.0f,
     },
-    /* [4] formation-hold-autonomous-follower-bare.crazyflie-2.1 */
+    /* [3] formation-hold-autonomous-follower-bare.crazyflie-2.1 */
     {
-        .id = 4,
-        .generator_type = 3,
-        ._pad = 0,
-        .defaults = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
-        .bounds_min = { -2.0f, -2.0f, -2.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
-        .bounds_max = { 2.0f, 2.0f, 2.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
-        .battery_floor = 0.2f,
-        .pos_quality_floor = 0.5f,
-    },
-    /* [5] formation-hold-autonomous-follower-bare.sim-gazebo */
-    {
-        .id = 5,
-        .generator_type = 3,
-        ._pad = 0,
-        .defaults = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
-        .bounds_min = { -2.0f, -2.0f, -2.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
-        .bounds_max = { 2.0f, 2.0f, 2.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
-        .battery_floor = 0.2f,
-        .pos_quality_floor = 0.5f,
-    },
-    /* [6] formation-hold-autonomous-performer-bare.crazyflie-2.1 */
-    {
-        .id = 6,
+        .id = 3,
         .generator_type = 3,
         ._pad = 0,
         .defaults = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
@@ -92,9 +73,9 @@ static const PatternEntry CATALOG[CATALOG_SIZE] = {
         .battery_floor = 0.2f,
         .pos_quality_floor = 0.5f,
     },
-    /* [7] formation-hold-autonomous-performer-bare.sim-gazebo */
+    /* [4] formation-hold-autonomous-performer-bare.crazyflie-2.1 */
     {
-        .id = 7,
+        .id = 4,
         .generator_type = 3,
         ._pad = 0,
         .defaults = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
@@ -103,9 +84,9 @@ static const PatternEntry CATALOG[CATALOG_SIZE] = {
         .battery_floor = 0.2f,
         .pos_quality_floor = 0.5f,
     },
-    /* [8] formation-transition-autonomous-follower-bare.crazyflie-2.1 */
+    /* [5] formation-transition-autonomous-follower-bare.crazyflie-2.1 */
     {
-        .id = 8,
+        .id = 5,
         .generator_type = 5,
         ._pad = 0,
         .defaults = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
@@ -114,9 +95,9 @@ static const PatternEntry CATALOG[CATALOG_SIZE] = {
         .battery_floor = 0.2f,
         .pos_quality_floor = 0.5f,
     },
-    /* [9] formation-transition-autonomous-performer-bare.crazyflie-2.1 */
+    /* [6] formation-transition-autonomous-performer-bare.crazyflie-2.1 */
     {
-        .id = 9,
+        .id = 6,
         .generator_type = 5,
         ._pad = 0,
         .defaults = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
@@ -125,20 +106,9 @@ static const PatternEntry CATALOG[CATALOG_SIZE] = {
         .battery_floor = 0.2f,
         .pos_quality_floor = 0.5f,
     },
-    /* [10] grounded-autonomous-reserve-bare.crazyflie-2.1 */
+    /* [7] grounded-autonomous-reserve-bare.crazyflie-2.1 */
     {
-        .id = 10,
-        .generator_type = 7,
-        ._pad = 0,
-        .defaults = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
-        .bounds_min = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
-        .bounds_max = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
-        .battery_floor = 0.0f,
-        .pos_quality_floor = 0.0f,
-    },
-    /* [11] grounded-autonomous-reserve-bare.sim-gazebo */
-    {
-        .id = 11,
+        .id = 7,
         .generator_type = 7,
         ._pad = 0,
         .defaults = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
@@ -147,9 +117,9 @@ static const PatternEntry CATALOG[CATALOG_SIZE] = {
         .battery_floor = 0.0f,
         .pos_quality_floor = 0.0f,
     },
-    /* [12] hover-autonomous-anchor-bare.crazyflie-2.1 */
+    /* [8] hover-autonomous-anchor-bare.crazyflie-2.1 */
     {
-        .id = 12,
+        .id = 8,
         .generator_type = 0,
         ._pad = 0,
         .defaults = { 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
@@ -158,9 +128,9 @@ static const PatternEntry CATALOG[CATALOG_SIZE] = {
         .battery_floor = 0.2f,
         .pos_quality_floor = 0.6f,
     },
-    /* [13] hover-autonomous-charger-inbound-bare.crazyflie-2.1 */
+    /* [9] hover-autonomous-charger-inbound-bare.crazyflie-2.1 */
     {
-        .id = 13,
+        .id = 9,
         .generator_type = 0,
         ._pad = 0,
         .defaults = { 0.4f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
@@ -169,9 +139,9 @@ static const PatternEntry CATALOG[CATALOG_SIZE] = {
         .battery_floor = 0.05f,
         .pos_quality_floor = 0.5f,
     },
-    /* [14] hover-autonomous-charger-outbound-bare.crazyflie-2.1 */
+    /* [10] hover-autonomous-charger-outbound-bare.crazyflie-2.1 */
     {
-        .id = 14,
+        .id = 10,
         .generator_type = 0,
         ._pad = 0,
         .defaults = { 0.6f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
@@ -180,9 +150,9 @@ static const PatternEntry CATALOG[CATALOG_SIZE] = {
         .battery_floor = 0.5f,
         .pos_quality_floor = 0.5f,
     },
-    /* [15] hover-autonomous-charging-bare.crazyflie-2.1 */
+    /* [11] hover-autonomous-charging-bare.crazyflie-2.1 */
     {
-        .id = 15,
+        .id = 11,
         .generator_type = 0,
         ._pad = 0,
         .defaults = { 0.5f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
@@ -191,20 +161,9 @@ static const PatternEntry CATALOG[CATALOG_SIZE] = {
         .battery_floor = 0.05f,
         .pos_quality_floor = 0.5f,
     },
-    /* [16] hover-autonomous-follower-bare.crazyflie-2.1 */
-    {
-        .id = 16,
-        .generator_type = 0,
-        ._pad = 0,
-        .defaults = { 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
-        .bounds_min = { 0.2f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
-        .bounds_max = { 2.5f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
-        .battery_floor = 0.15f,
-        .pos_quality_floor = 0.5f,
-    },
-    /* [17] hover-autonomous-follower-bare.sim-gazebo */
+    /* [12] hover-autonomous-follower-bare.crazyflie-2.1 */
     {
-        .id = 17,
+        .id = 12,
         .generator_type = 0,
         ._pad = 0,
         .defaults = { 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
@@ -213,20 +172,9 @@ static const PatternEntry CATALOG[CATALOG_SIZE] = {
         .battery_floor = 0.15f,
         .pos_quality_floor = 0.5f,
     },
-    /* [18] hover-autonomous-leader-bare.crazyflie-2.1 */
-    {
-        .id = 18,
-        .generator_type = 0,
-        ._pad = 0,
-        .defaults = { 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
-        .bounds_min = { 0.2f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
-        .bounds_max = { 2.5f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
-        .battery_floor = 0.2f,
-        .pos_quality_floor = 0.6f,
-    },
-    /* [19] hover-autonomous-leader-bare.sim-gazebo */
+    /* [13] hover-autonomous-leader-bare.crazyflie-2.1 */
     {
-        .id = 19,
+        .id = 13,
         .generator_type = 0,
         ._pad = 0,
         .defaults = { 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
@@ -235,20 +183,9 @@ static const PatternEntry CATALOG[CATALOG_SIZE] = {
         .battery_floor = 0.2f,
         .pos_quality_floor = 0.6f,
     },
-    /* [20] hover-autonomous-performer-bare.crazyflie-2.1 */
-    {
-        .id = 20,
-        .generator_type = 0,
-        ._pad = 0,
-        .defaults = { 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
-        .bounds_min = { 0.2f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
-        .bounds_max = { 2.5f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
-        .battery_floor = 0.15f,
-        .pos_quality_floor = 0.5f,
-    },
-    /* [21] hover-autonomous-performer-bare.sim-gazebo */
+    /* [14] hover-autonomous-performer-bare.crazyflie-2.1 */
     {
-        .id = 21,
+        .id = 14,
         .generator_type = 0,
         ._pad = 0,
         .defaults = { 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
@@ -257,9 +194,9 @@ static const PatternEntry CATALOG[CATALOG_SIZE] = {
         .battery_floor = 0.15f,
         .pos_quality_floor = 0.5f,
     },
-    /* [22] hover-autonomous-relay-bare.crazyflie-2.1 */
+    /* [15] hover-autonomous-relay-bare.crazyflie-2.1 */
     {
-        .id = 22,
+        .id = 15,
         .generator_type = 0,
         ._pad = 0,
         .defaults = { 1.5f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
@@ -268,9 +205,9 @@ static const PatternEntry CATALOG[CATALOG_SIZE] = {
         .battery_floor = 0.2f,
         .pos_quality_floor = 0.5f,
     },
-    /* [23] hover-autonomous-reserve-bare.crazyflie-2.1 */
+    /* [16] hover-autonomous-reserve-bare.crazyflie-2.1 */
     {
-        .id = 23,
+        .id = 16,
         .generator_type = 0,
         ._pad = 0,
         .defaults = { 0.8f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
@@ -279,20 +216,9 @@ static const PatternEntry CATALOG[CATALOG_SIZE] = {
         .battery_floor = 0.3f,
         .pos_quality_floor = 0.5f,
     },
-    /* [24] hover-emergency-performer-bare.crazyflie-2.1 */
+    /* [17] hover-emergency-performer-bare.crazyflie-2.1 */
     {
-        .id = 24,
-        .generator_type = 0,
-        ._pad = 0,
-        .defaults = { 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
-        .bounds_min = { 0.2f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
-        .bounds_max = { 2.5f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
-        .battery_floor = 0.0f,
-        .pos_quality_floor = 0.0f,
-    },
-    /* [25] hover-emergency-performer-bare.sim-gazebo */
-    {
-        .id = 25,
+        .id = 17,
         .generator_type = 0,
         ._pad = 0,
         .defaults = { 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
@@ -301,9 +227,9 @@ static const PatternEntry CATALOG[CATALOG_SIZE] = {
         .battery_floor = 0.0f,
         .pos_quality_floor = 0.0f,
     },
-    /* [26] hover-operator-guided-performer-bare.crazyflie-2.1 */
+    /* [18] hover-operator-guided-performer-bare.crazyflie-2.1 */
     {
-        .id = 26,
+        .id = 18,
         .generator_type = 0,
         ._pad = 0,
         .defaults = { 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
@@ -312,20 +238,9 @@ static const PatternEntry CATALOG[CATALOG_SIZE] = {
         .battery_floor = 0.15f,
         .pos_quality_floor = 0.5f,
     },
-    /* [27] land-autonomous-performer-bare.crazyflie-2.1 */
-    {
-        .id = 27,
-        .generator_type = 1,
-        ._pad = 0,
-        .defaults = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
-        .bounds_min = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
-        .bounds_max = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
-        .battery_floor = 0.05f,
-        .pos_quality_floor = 0.3f,
-    },
-    /* [28] land-autonomous-performer-bare.sim-gazebo */
+    /* [19] land-autonomous-performer-bare.crazyflie-2.1 */
     {
-        .id = 28,
+        .id = 19,
         .generator_type = 1,
         ._pad = 0,
         .defaults = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
@@ -334,20 +249,9 @@ static const PatternEntry CATALOG[CATALOG_SIZE] = {
         .battery_floor = 0.05f,
         .pos_quality_floor = 0.3f,
     },
-    /* [29] land-emergency-performer-bare.crazyflie-2.1 */
-    {
-        .id = 29,
-        .generator_type = 1,
-        ._pad = 0,
-        .defaults = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
-        .bounds_min = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
-        .bounds_max = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
-        .battery_floor = 0.0f,
-        .pos_quality_floor = 0.0f,
-    },
-    /* [30] land-emergency-performer-bare.sim-gazebo */
+    /* [20] land-emergency-performer-bare.crazyflie-2.1 */
     {
-        .id = 30,
+        .id = 20,
         .generator_type = 1,
         ._pad = 0,
         .defaults = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
@@ -356,20 +260,9 @@ static const PatternEntry CATALOG[CATALOG_SIZE] = {
         .battery_floor = 0.0f,
         .pos_quality_floor = 0.0f,
     },
-    /* [31] orbit-autonomous-follower-bare.crazyflie-2.1 */
-    {
-        .id = 31,
-        .generator_type = 4,
-        ._pad = 0,
-        .defaults = { 0.5f, 0.5f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
-        .bounds_min = { 0.3f, 0.1f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
-        .bounds_max = { 1.5f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
-        .battery_floor = 0.2f,
-        .pos_quality_floor = 0.5f,
-    },
-    /* [32] orbit-autonomous-performer-bare.crazyflie-2.1 */
+    /* [21] orbit-autonomous-follower-bare.crazyflie-2.1 */
     {
-        .id = 32,
+        .id = 21,
         .generator_type = 4,
         ._pad = 0,
         .defaults = { 0.5f, 0.5f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
@@ -378,9 +271,9 @@ static const PatternEntry CATALOG[CATALOG_SIZE] = {
         .battery_floor = 0.2f,
         .pos_quality_floor = 0.5f,
     },
-    /* [33] orbit-autonomous-performer-bare.sim-gazebo */
+    /* [22] orbit-autonomous-performer-bare.crazyflie-2.1 */
     {
-        .id = 33,
+        .id = 22,
         .generator_type = 4,
         ._pad = 0,
         .defaults = { 0.5f, 0.5f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
@@ -389,9 +282,9 @@ static const PatternEntry CATALOG[CATALOG_SIZE] = {
         .battery_floor = 0.2f,
         .pos_quality_floor = 0.5f,
     },
-    /* [34] orbit-operator-guided-performer-bare.crazyflie-2.1 */
+    /* [23] orbit-operator-guided-performer-bare.crazyflie-2.1 */
     {
-        .id = 34,
+        .id = 23,
         .generator_type = 4,
         ._pad = 0,
         .defaults = { 0.5f, 0.3f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
@@ -400,20 +293,9 @@ static const PatternEntry CATALOG[CATALOG_SIZE] = {
         .battery_floor = 0.2f,
         .pos_quality_floor = 0.5f,
     },
-    /* [35] relay-hold-autonomous-relay-bare.crazyflie-2.1 */
-    {
-        .id = 35,
-        .generator_type = 0,
-        ._pad = 0,
-        .defaults = { 1.5f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
-        .bounds_min = { 0.5f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
-        .bounds_max = { 2.5f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
-        .battery_floor = 0.2f,
-        .pos_quality_floor = 0.5f,
-    },
-    /* [36] relay-hold-autonomous-relay-bare.sim-gazebo */
+    /* [24] relay-hold-autonomous-relay-bare.crazyflie-2.1 */
     {
-        .id = 36,
+        .id = 24,
         .generator_type = 0,
         ._pad = 0,
         .defaults = { 1.5f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
@@ -422,20 +304,9 @@ static const PatternEntry CATALOG[CATALOG_SIZE] = {
         .battery_floor = 0.2f,
         .pos_quality_floor = 0.5f,
     },
-    /* [37] takeoff-autonomous-performer-bare.crazyflie-2.1 */
-    {
-        .id = 37,
-        .generator_type = 1,
-        ._pad = 0,
-        .defaults = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
-        .bounds_min = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
-        .bounds_max = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
-        .battery_floor = 0.3f,
-        .pos_quality_floor = 0.6f,
-    },
-    /* [38] takeoff-autonomous-performer-bare.sim-gazebo */
+    /* [25] takeoff-autonomous-performer-bare.crazyflie-2.1 */
     {
-        .id = 38,
+        .id = 25,
         .generator_type = 1,
         ._pad = 0,
         .defaults = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
@@ -444,9 +315,9 @@ static const PatternEntry CATALOG[CATALOG_SIZE] = {
         .battery_floor = 0.3f,
         .pos_quality_floor = 0.6f,
     },
-    /* [39] translate-autonomous-charger-inbound-bare.crazyflie-2.1 */
+    /* [26] translate-autonomous-charger-inbound-bare.crazyflie-2.1 */
     {
-        .id = 39,
+        .id = 26,
         .generator_type = 1,
         ._pad = 0,
         .defaults = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
@@ -455,9 +326,9 @@ static const PatternEntry CATALOG[CATALOG_SIZE] = {
         .battery_floor = 0.08f,
         .pos_quality_floor = 0.4f,
     },
-    /* [40] translate-autonomous-charger-outbound-bare.crazyflie-2.1 */
+    /* [27] translate-autonomous-charger-outbound-bare.crazyflie-2.1 */
     {
-        .id = 40,
+        .id = 27,
         .generator_type = 1,
         ._pad = 0,
         .defaults = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
@@ -466,20 +337,9 @@ static const PatternEntry CATALOG[CATALOG_SIZE] = {
         .battery_floor = 0.5f,
         .pos_quality_floor = 0.5f,
     },
-    /* [41] translate-autonomous-follower-bare.crazyflie-2.1 */
-    {
-        .id = 41,
-        .generator_type = 1,
-        ._pad = 0,
-        .defaults = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
-        .bounds_min = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
-        .bounds_max = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
-        .battery_floor = 0.2f,
-        .pos_quality_floor = 0.5f,
-    },
-    /* [42] translate-autonomous-follower-bare.sim-gazebo */
+    /* [28] translate-autonomous-follower-bare.crazyflie-2.1 */
     {
-        .id = 42,
+        .id = 28,
         .generator_type = 1,
         ._pad = 0,
         .defaults = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
@@ -488,20 +348,9 @@ static const PatternEntry CATALOG[CATALOG_SIZE] = {
         .battery_floor = 0.2f,
         .pos_quality_floor = 0.5f,
     },
-    /* [43] translate-autonomous-leader-bare.crazyflie-2.1 */
+    /* [29] translate-autonomous-leader-bare.crazyflie-2.1 */
     {
-        .id = 43,
-        .generator_type = 1,
-        ._pad = 0,
-        .defaults = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
-        .bounds_min = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
-        .bounds_max = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
-        .battery_floor = 0.25f,
-        .pos_quality_floor = 0.6f,
-    },
-    /* [44] translate-autonomous-leader-bare.sim-gazebo */
-    {
-        .id = 44,
+        .id = 29,
         .generator_type = 1,
         ._pad = 0,
         .defaults = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
@@ -510,20 +359,9 @@ static const PatternEntry CATALOG[CATALOG_SIZE] = {
         .battery_floor = 0.25f,
         .pos_quality_floor = 0.6f,
     },
-    /* [45] translate-autonomous-performer-bare.crazyflie-2.1 */
+    /* [30] translate-autonomous-performer-bare.crazyflie-2.1 */
     {
-        .id = 45,
-        .generator_type = 1,
-        ._pad = 0,
-        .defaults = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
-        .bounds_min = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
-        .bounds_max = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
-        .battery_floor = 0.2f,
-        .pos_quality_floor = 0.5f,
-    },
-    /* [46] translate-autonomous-performer-bare.sim-gazebo */
-    {
-        .id = 46,
+        .id = 30,
         .generator_type = 1,
         ._pad = 0,
         .defaults = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
@@ -532,9 +370,9 @@ static const PatternEntry CATALOG[CATALOG_SIZE] = {
         .battery_floor = 0.2f,
         .pos_quality_floor = 0.5f,
     },
-    /* [47] translate-autonomous-relay-bare.crazyflie-2.1 */
+    /* [31] translate-autonomous-relay-bare.crazyflie-2.1 */
     {
-        .id = 47,
+        .id = 31,
         .generator_type = 1,
         ._pad = 0,
         .defaults = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
@@ -543,9 +381,9 @@ static const PatternEntry CATALOG[CATALOG_SIZE] = {
         .battery_floor = 0.2f,
         .pos_quality_floor = 0.5f,
     },
-    /* [48] translate-operator-guided-performer-bare.crazyflie-2.1 */
+    /* [32] translate-operator-guided-performer-bare.crazyflie-2.1 */
     {
-        .id = 48,
+        .id = 32,
         .generator_type = 1,
         ._pad = 0,
         .defaults = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
@@ -554,9 +392,9 @@ static const PatternEntry CATALOG[CATALOG_SIZE] = {
         .battery_floor = 0.2f,
         .pos_quality_floor = 0.5f,
     },
-    /* [49] undock-autonomous-charger-outbound-bare.crazyflie-2.1 */
+    /* [33] undock-autonomous-charger-outbound-bare.crazyflie-2.1 */
     {
-        .id = 49,
+        .id = 33,
         .generator_type = 1,
         ._pad = 0,
         .defaults = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
@@ -569,54 +407,38 @@ static const PatternEntry CATALOG[CATALOG_SIZE] = {
 
 /* Pattern ID defines (for firmware code readability) */
 #define PATTERN_AVOID_EMERGENCY_PERFORMER_BARE_CRAZYFLIE_2_1 0
-#define PATTERN_AVOID_EMERGENCY_PERFORMER_BARE_SIM_GAZEBO 1
-#define PATTERN_DOCK_AUTONOMOUS_CHARGER_INBOUND_BARE_CRAZYFLIE_2_1 2
-#define PATTERN_DOCKED_AUTONOMOUS_CHARGING_BARE_CRAZYFLIE_2_1 3
-#define PATTERN_FORMATION_HOLD_AUTONOMOUS_FOLLOWER_BARE_CRAZYFLIE_2_1 4
-#define PATTERN_FORMATION_HOLD_AUTONOMOUS_FOLLOWER_BARE_SIM_GAZEBO 5
-#define PATTERN_FORMATION_HOLD_AUTONOMOUS_PERFORMER_BARE_CRAZYFLIE_2_1 6
-#define PATTERN_FORMATION_HOLD_AUTONOMOUS_PERFORMER_BARE_SIM_GAZEBO 7
-#define PATTERN_FORMATION_TRANSITION_AUTONOMOUS_FOLLOWER_BARE_CRAZYFLIE_2_1 8
-#define PATTERN_FORMATION_TRANSITION_AUTONOMOUS_PERFORMER_BARE_CRAZYFLIE_2_1 9
-#define PATTERN_GROUNDED_AUTONOMOUS_RESERVE_BARE_CRAZYFLIE_2_1 10
-#define PATTERN_GROUNDED_AUTONOMOUS_RESERVE_BARE_SIM_GAZEBO 11
-#define PATTERN_HOVER_AUTONOMOUS_ANCHOR_BARE_CRAZYFLIE_2_1 12
-#define PATTERN_HOVER_AUTONOMOUS_CHARGER_INBOUND_BARE_CRAZYFLIE_2_1 13
-#define PATTERN_HOVER_AUTONOMOUS_CHARGER_OUTBOUND_BARE_CRAZYFLIE_2_1 14
-#define PATTERN_HOVER_AUTONOMOUS_CHARGING_BARE_CRAZYFLIE_2_1 15
-#define PATTERN_HOVER_AUTONOMOUS_FOLLOWER_BARE_CRAZYFLIE_2_1 16
-#define PATTERN_HOVER_AUTONOMOUS_FOLLOWER_BARE_SIM_GAZEBO 17
-#define PATTERN_HOVER_AUTONOMOUS_LEADER_BARE_CRAZYFLIE_2_1 18
-#define PATTERN_HOVER_AUTONOMOUS_LEADER_BARE_SIM_GAZEBO 19
-#define PATTERN_HOVER_AUTONOMOUS_PERFORMER_BARE_CRAZYFLIE_2_1 20
-#define PATTERN_HOVER_AUTONOMOUS_PERFORMER_BARE_SIM_GAZEBO 21
-#define PATTERN_HOVER_AUTONOMOUS_RELAY_BARE_CRAZYFLIE_2_1 22
-#define PATTERN_HOVER_AUTONOMOUS_RESERVE_BARE_CRAZYFLIE_2_1 23
-#define PATTERN_HOVER_EMERGENCY_PERFORMER_BARE_CRAZYFLIE_2_1 24
-#define PATTERN_HOVER_EMERGENCY_PERFORMER_BARE_SIM_GAZEBO 25
-#define PATTERN_HOVER_OPERATOR_GUIDED_PERFORMER_BARE_CRAZYFLIE_2_1 26
-#define PATTERN_LAND_AUTONOMOUS_PERFORMER_BARE_CRAZYFLIE_2_1 27
-#define PATTERN_LAND_AUTONOMOUS_PERFORMER_BARE_SIM_GAZEBO 28
-#define PATTERN_LAND_EMERGENCY_PERFORMER_BARE_CRAZYFLIE_2_1 29
-#define PATTERN_LAND_EMERGENCY_PERFORMER_BARE_SIM_GAZEBO 30
-#define PATTERN_ORBIT_AUTONOMOUS_FOLLOWER_BARE_CRAZYFLIE_2_1 31
-#define PATTERN_ORBIT_AUTONOMOUS_PERFORMER_BARE_CRAZYFLIE_2_1 32
-#define PATTERN_ORBIT_AUTONOMOUS_PERFORMER_BARE_SIM_GAZEBO 33
-#define PATTERN_ORBIT_OPERATOR_GUIDED_PERFORMER_BARE_CRAZYFLIE_2_1 34
-#define PATTERN_RELAY_HOLD_AUTONOMOUS_RELAY_BARE_CRAZYFLIE_2_1 35
-#define PATTERN_RELAY_HOLD_AUTONOMOUS_RELAY_BARE_SIM_GAZEBO 36
-#define PATTERN_TAKEOFF_AUTONOMOUS_PERFORMER_BARE_CRAZYFLIE_2_1 37
-#define PATTERN_TAKEOFF_AUTONOMOUS_PERFORMER_BARE_SIM_GAZEBO 38
-#define PATTERN_TRANSLATE_AUTONOMOUS_CHARGER_INBOUND_BARE_CRAZYFLIE_2_1 39
-#define PATTERN_TRANSLATE_AUTONOMOUS_CHARGER_OUTBOUND_BARE_CRAZYFLIE_2_1 40
-#define PATTERN_TRANSLATE_AUTONOMOUS_FOLLOWER_BARE_CRAZYFLIE_2_1 41
-#define PATTERN_TRANSLATE_AUTONOMOUS_FOLLOWER_BARE_SIM_GAZEBO 42
-#define PATTERN_TRANSLATE_AUTONOMOUS_LEADER_BARE_CRAZYFLIE_2_1 43
-#define PATTERN_TRANSLATE_AUTONOMOUS_LEADER_BARE_SIM_GAZEBO 44
-#define PATTERN_TRANSLATE_AUTONOMOUS_PERFORMER_BARE_CRAZYFLIE_2_1 45
-#define PATTERN_TRANSLATE_AUTONOMOUS_PERFORMER_BARE_SIM_GAZEBO 46
-#define PATTERN_TRANSLATE_AUTONOMOUS_RELAY_BARE_CRAZYFLIE_2_1 47
-#define PATTERN_TRANSLATE_OPERATOR_GUIDED_PERFORMER_BARE_CRAZYFLIE_2_1 48
-#define PATTERN_UNDOCK_AUTONOMOUS_CHARGER_OUTBOUND_BARE_CRAZYFLIE_2_1 49
+#define PATTERN_DOCK_AUTONOMOUS_CHARGER_INBOUND_BARE_CRAZYFLIE_2_1 1
+#define PATTERN_DOCKED_AUTONOMOUS_CHARGING_BARE_CRAZYFLIE_2_1 2
+#define PATTERN_FORMATION_HOLD_AUTONOMOUS_FOLLOWER_BARE_CRAZYFLIE_2_1 3
+#define PATTERN_FORMATION_HOLD_AUTONOMOUS_PERFORMER_BARE_CRAZYFLIE_2_1 4
+#define PATTERN_FORMATION_TRANSITION_AUTONOMOUS_FOLLOWER_BARE_CRAZYFLIE_2_1 5
+#define PATTERN_FORMATION_TRANSITION_AUTONOMOUS_PERFORMER_BARE_CRAZYFLIE_2_1 6
+#define PATTERN_GROUNDED_AUTONOMOUS_RESERVE_BARE_CRAZYFLIE_2_1 7
+#define PATTERN_HOVER_AUTONOMOUS_ANCHOR_BARE_CRAZYFLIE_2_1 8
+#define PATTERN_HOVER_AUTONOMOUS_CHARGER_INBOUND_BARE_CRAZYFLIE_2_1 9
+#define PATTERN_HOVER_AUTONOMOUS_CHARGER_OUTBOUND_BARE_CRAZYFLIE_2_1 10
+#define PATTERN_HOVER_AUTONOMOUS_CHARGING_BARE_CRAZYFLIE_2_1 11
+#define PATTERN_HOVER_AUTONOMOUS_FOLLOWER_BARE_CRAZYFLIE_2_1 12
+#define PATTERN_HOVER_AUTONOMOUS_LEADER_BARE_CRAZYFLIE_2_1 13
+#define PATTERN_HOVER_AUTONOMOUS_PERFORMER_BARE_CRAZYFLIE_2_1 14
+#define PATTERN_HOVER_AUTONOMOUS_RELAY_BARE_CRAZYFLIE_2_1 15
+#define PATTERN_HOVER_AUTONOMOUS_RESERVE_BARE_CRAZYFLIE_2_1 16
+#define PATTERN_HOVER_EMERGENCY_PERFORMER_BARE_CRAZYFLIE_2_1 17
+#define PATTERN_HOVER_OPERATOR_GUIDED_PERFORMER_BARE_CRAZYFLIE_2_1 18
+#define PATTERN_LAND_AUTONOMOUS_PERFORMER_BARE_CRAZYFLIE_2_1 19
+#define PATTERN_LAND_EMERGENCY_PERFORMER_BARE_CRAZYFLIE_2_1 20
+#define PATTERN_ORBIT_AUTONOMOUS_FOLLOWER_BARE_CRAZYFLIE_2_1 21
+#define PATTERN_ORBIT_AUTONOMOUS_PERFORMER_BARE_CRAZYFLIE_2_1 22
+#define PATTERN_ORBIT_OPERATOR_GUIDED_PERFORMER_BARE_CRAZYFLIE_2_1 23
+#define PATTERN_RELAY_HOLD_AUTONOMOUS_RELAY_BARE_CRAZYFLIE_2_1 24
+#define PATTERN_TAKEOFF_AUTONOMOUS_PERFORMER_BARE_CRAZYFLIE_2_1 25
+#define PATTERN_TRANSLATE_AUTONOMOUS_CHARGER_INBOUND_BARE_CRAZYFLIE_2_1 26
+#define PATTERN_TRANSLATE_AUTONOMOUS_CHARGER_OUTBOUND_BARE_CRAZYFLIE_2_1 27
+#define PATTERN_TRANSLATE_AUTONOMOUS_FOLLOWER_BARE_CRAZYFLIE_2_1 28
+#define PATTERN_TRANSLATE_AUTONOMOUS_LEADER_BARE_CRAZYFLIE_2_1 29
+#define PATTERN_TRANSLATE_AUTONOMOUS_PERFORMER_BARE_CRAZYFLIE_2_1 30
+#define PATTERN_TRANSLATE_AUTONOMOUS_RELAY_BARE_CRAZYFLIE_2_1 31
+#define PATTERN_TRANSLATE_OPERATOR_GUIDED_PERFORMER_BARE_CRAZYFLIE_2_1 32
+#define PATTERN_UNDOCK_AUTONOMOUS_CHARGER_OUTBOUND_BARE_CRAZYFLIE_2_1 33
 
 #endif /* SESHAT_CATALOG_DATA_H */
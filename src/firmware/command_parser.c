@@ -15,6 +15,7 @@
  */
 
 #include "command_parser.h"
+#include "perf_probes.h"
 #include "types.h"
 #include <string.h>
 #include <stdint.h>
@@ -22,7 +23,7 @@
 /* Expected packet size — must match sizeof(GroundCommand) exactly. */
 #define COMMAND_PACKET_SIZE ((uint16_t)sizeof(GroundCommand))
 
-int command_parse(const uint8_t* raw, uint16_t len, GroundCommand* out)
+static int parse_packet(const uint8_t* raw, uint16_t len, GroundCommand* out)
 {
     /* Reject NULL pointers immediately. */
     if (raw == NULL || out == NULL) {
@@ -54,6 +55,15 @@ int command_parse(const uint8_t* raw, uint16_t len, GroundCommand* out)
     return 1;
 }
 
+int command_parse(const uint8_t* raw, uint16_t len, GroundCommand* out)
+{
+    int ok;
+    PERF_PROBE_BEGIN(t0);
+    ok = parse_packet(raw, len, out);
+    PERF_PROBE_END(PROBE_COMMAND_PARSE, t0);
+    return ok;
+}
+
 int command_validate(const GroundCommand* cmd, uint16_t catalog_size)
 {
     if (cmd == NULL) {
@@ -0,0 +1,130 @@
+/**
+ * Seshat Swarm — Priority Event Queue Implementation
+ *
+ * A short array of EventPackets in transition order, each with its own
+ * send state. Entries leave only by acknowledgement; the array is
+ * compacted on removal, which at EVENT_QUEUE_DEPTH entries is cheaper
+ * than ring bookkeeping.
+ *
+ * Target: STM32F405 (Crazyflie 2.1+), arm-none-eabi-gcc.
+ */
+
+#include "event_queue.h"
+#include <string.h>  /* memcpy, memmove, memset */
+
+/* -----------------------------------------------------------------------
+ * State
+ * ----------------------------------------------------------------------- */
+
+typedef struct {
+    EventPacket packet;
+    uint8_t  sent;
+    uint32_t last_sent_us;
+} EventEntry;
+
+static struct {
+    EventEntry entries[EVENT_QUEUE_DEPTH];
+    uint8_t  count;
+    uint8_t  next_seq;
+    uint8_t  have_baseline;
+    uint8_t  prev_flags;
+    uint32_t retransmit_us;
+} s_events;
+
+/* -----------------------------------------------------------------------
+ * Internal helpers
+ * ----------------------------------------------------------------------- */
+
+static void fill_state(EventPacket* p, const SensorState* state,
+                       uint16_t pattern_id) {
+    float batt = state->battery_pct * 200.0f;
+    p->battery_pct = (batt > 0.0f) ? (batt < 200.0f ? (uint8_t)batt : 200u) : 0u;
+    p->pattern_id = pattern_id;
+    p->pos_x = float_to_mm(state->position.x);
+    p->pos_y = float_to_mm(state->position.y);
+    p->pos_z = float_to_mm(state->position.z);
+}
+
+static uint16_t emit(EventEntry* e, uint32_t now_us, uint8_t* buf) {
+    e->sent = 1;
+    e->last_sent_us = now_us;
+    memcpy(buf, &e->packet, sizeof(EventPacket));
+    return (uint16_t)sizeof(EventPacket);
+}
+
+/* -----------------------------------------------------------------------
+ * Public API
+ * ----------------------------------------------------------------------- */
+
+void event_queue_init(uint32_t retransmit_us) {
+    memset(&s_events, 0, sizeof(s_events));
+    s_events.retransmit_us = retransmit_us;
+}
+
+void event_queue_note_flags(uint8_t flags, const SensorState* state,
+                            uint16_t pattern_id) {
+    uint8_t changed = (uint8_t)((flags ^ s_events.prev_flags) & EVENT_FLAG_MASK);
+    EventEntry* e;
+
+    if (!s_events.have_baseline) {
+        s_events.have_baseline = 1;
+        s_events.prev_flags = flags;
+        return;
+    }
+    if (changed == 0) return;
+
+    if (s_events.count == EVENT_QUEUE_DEPTH) {
+        /* Full: fold this transition into the newest entry, keeping its
+         * old_flags so the ground sees the whole swing. */
+        e = &s_events.entries[EVENT_QUEUE_DEPTH - 1u];
+    } else {
+        e = &s_events.entries[s_events.count++];
+        e->packet.old_flags = s_events.prev_flags;
+    }
+    e->packet.kind = EXT_PACKET_EVENT;
+    e->packet.seq = s_events.next_seq++;
+    e->packet.new_flags = flags;
+    fill_state(&e->packet, state, pattern_id);
+    e->sent = 0;
+
+    s_events.prev_flags = flags;
+}
+
+uint16_t event_queue_next(uint32_t now_us, uint8_t* buf, uint16_t len) {
+    uint8_t i;
+
+    if (buf == NULL || len < sizeof(EventPacket)) return 0;
+
+    for (i = 0; i < s_events.count; i++) {
+        if (!s_events.entries[i].sent) return emit(&s_events.entries[i], now_us, buf);
+    }
+    for (i = 0; i < s_events.count; i++) {
+        EventEntry* e = &s_events.entries[i];
+        if (now_us - e->last_sent_us >= s_events.retransmit_us) {
+            return emit(e, now_us, buf);
+        }
+    }
+    return 0;
+}
+
+int event_queue_ack(const uint8_t* raw, uint16_t len) {
+    uint8_t i;
+
+    if (raw == NULL || len != sizeof(EventAckPacket) || raw[0] != UPLINK_EVENT_ACK) {
+        return 0;
+    }
+
+    for (i = 0; i < s_events.count; i++) {
+        if (s_events.entries[i].packet.seq == raw[1]) {
+            memmove(&s_events.entries[i], &s_events.entries[i + 1u],
+                    (size_t)(s_events.count - i - 1u) * sizeof(EventEntry));
+            s_events.count--;
+            break;
+        }
+    }
+    return 1;
+}
+
+uint8_t event_queue_pending(void) {
+    return s_events.count;
+}
@@ -0,0 +1,68 @@
+/**
+ * Seshat Swarm — Priority Event Queue
+ *
+ * A change of TELEM_FLAG_EMERGENCY or TELEM_FLAG_LOW_BATTERY should not
+ * wait for the next routine telemetry slot. telemetry_build_flags() feeds
+ * every flag set it builds to event_queue_note_flags(); a transition of an
+ * EVENT_FLAG_MASK bit enqueues an EventPacket. The radio layer asks
+ * event_queue_next() first in every TX slot, so events go out ahead of
+ * routine traffic, and each is retransmitted every retransmit interval
+ * until the ground acknowledges it with an EventAckPacket.
+ *
+ * Acks are selective, so one lost packet does not hold back the events
+ * behind it. If the queue fills (a flapping flag with the ground
+ * unreachable), the newest entry is updated in place under a fresh seq:
+ * the ground still learns the latest flags.
+ *
+ * Usage:
+ *   event_queue_init(20000);                     // Retransmit every 20 ms
+ *   // Radio TX slot:
+ *   n = event_queue_next(now_us(), buf, sizeof(buf));
+ *   if (n == 0) n = routine_packet(buf);         // telemetry, history, ...
+ *   // Radio RX:
+ *   if (!command_parse(raw, len, &cmd)) event_queue_ack(raw, len);
+ *
+ * Target: STM32F405 (Crazyflie 2.1+), arm-none-eabi-gcc.
+ */
+
+#ifndef SESHAT_SWARM_EVENT_QUEUE_H
+#define SESHAT_SWARM_EVENT_QUEUE_H
+
+#include "types.h"
+
+#define EVENT_QUEUE_DEPTH  4u
+
+/**
+ * Clear the queue. The next noted flag set is the baseline and raises no
+ * event.
+ */
+void event_queue_init(uint32_t retransmit_us);
+
+/**
+ * Compare `flags` with the previous set and enqueue an EventPacket if an
+ * EVENT_FLAG_MASK bit changed. Called by telemetry_build_flags().
+ */
+void event_queue_note_flags(uint8_t flags, const SensorState* state,
+                            uint16_t pattern_id);
+
+/**
+ * Next event to transmit now: the oldest event not yet sent, else the
+ * oldest unacknowledged one whose retransmit interval has elapsed.
+ * Call at the start of every TX slot, before any routine packet.
+ *
+ * @return Bytes written (sizeof(EventPacket)), or 0 if nothing is due.
+ */
+uint16_t event_queue_next(uint32_t now_us, uint8_t* buf, uint16_t len);
+
+/**
+ * Handle a ground → drone EventAckPacket. Acks for unknown seqs (already
+ * acked, or superseded by coalescing) are ignored.
+ *
+ * @return 1 if `raw` was an event ack, 0 otherwise.
+ */
+int event_queue_ack(const uint8_t* raw, uint16_t len);
+
+/** Events awaiting acknowledgement. */
+uint8_t event_queue_pending(void);
+
+#endif /* SESHAT_SWARM_EVENT_QUEUE_H */
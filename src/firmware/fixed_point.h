@@ -0,0 +1,168 @@
+/**
+ * Seshat Swarm — Q16.16 Fixed-Point Math
+ *
+ * Signed 16.16 fixed point for targets without a single-precision FPU
+ * (ESP-drone class MCUs, future cells) or that want to keep the FPU
+ * powered down. The executor uses it when built with -DSESHAT_FIXED_POINT;
+ * the default float build does not include this header.
+ *
+ * Range: ±32767.99998 at 1/65536 (~1.5e-5) resolution. Positions and
+ * velocities are already limited to ±32.767 by the radio encoding
+ * (float_to_mm), so differences and squares of them stay in range.
+ *
+ * Float <-> Q16 conversions work on the IEEE-754 bit pattern with integer
+ * ops only, so ingesting a SensorState pulls in no soft-float helpers.
+ * NaN maps to 0, infinities and out-of-range values saturate, and
+ * denormals flush to 0.
+ *
+ * Target: any C99 compiler with 64-bit integer support.
+ */
+
+#ifndef SESHAT_SWARM_FIXED_POINT_H
+#define SESHAT_SWARM_FIXED_POINT_H
+
+#include <stdint.h>
+#include <string.h>  /* memcpy */
+
+/** Q16.16 value: real = q / 65536. */
+typedef int32_t q16_t;
+
+#define Q16_ONE  ((q16_t)0x00010000)
+#define Q16_MAX  ((q16_t)0x7FFFFFFF)
+#define Q16_MIN  ((q16_t)(-0x7FFFFFFF - 1))
+
+/** Q16 constant from a literal. Folded at compile time — no runtime float. */
+#define Q16_CONST(x) ((q16_t)((x) * 65536.0 + ((x) >= 0 ? 0.5 : -0.5)))
+
+/* -----------------------------------------------------------------------
+ * Arithmetic (round-to-nearest, saturating)
+ * ----------------------------------------------------------------------- */
+
+static inline q16_t q16_sat(int64_t v) {
+    if (v > (int64_t)Q16_MAX) return Q16_MAX;
+    if (v < (int64_t)Q16_MIN) return Q16_MIN;
+    return (q16_t)v;
+}
+
+static inline q16_t q16_mul(q16_t a, q16_t b) {
+    return q16_sat(((int64_t)a * b + 0x8000) >> 16);
+}
+
+/** a / b. Division by zero saturates toward the sign of a. */
+static inline q16_t q16_div(q16_t a, q16_t b) {
+    if (b == 0) return (a >= 0) ? Q16_MAX : Q16_MIN;
+    return q16_sat(((int64_t)a * 65536) / b);
+}
+
+/** floor(sqrt(v)) for a 64-bit radicand. Bitwise, one bit per iteration. */
+static inline uint32_t q16_isqrt64(uint64_t v) {
+    uint64_t res = 0, one = (uint64_t)1 << 62;
+    while (one > v) one >>= 2;
+    while (one != 0) {
+        if (v >= res + one) {
+            v   -= res + one;
+            res  = (res >> 1) + one;
+        } else {
+            res >>= 1;
+        }
+        one >>= 2;
+    }
+    return (uint32_t)res;
+}
+
+/** Square root; non-positive inputs return 0. */
+static inline q16_t q16_sqrt(q16_t a) {
+    if (a <= 0) return 0;
+    return (q16_t)q16_isqrt64((uint64_t)a << 16);   /* sqrt(a/2^16)·2^16 */
+}
+
+/** sqrt(a² + b²). Squares are summed in Q32, so short vectors keep full
+ *  precision (a Q16 square of 0.01 m is only ~6 LSB). */
+static inline q16_t q16_hypot(q16_t a, q16_t b) {
+    uint64_t sum = (uint64_t)((int64_t)a * a) + (uint64_t)((int64_t)b * b);
+    return q16_sat((int64_t)q16_isqrt64(sum));
+}
+
+/* -----------------------------------------------------------------------
+ * Float conversions (integer-only)
+ * ----------------------------------------------------------------------- */
+
+/** float -> Q16. NaN -> 0, saturates at Q16_MIN/Q16_MAX, rounds to nearest. */
+static inline q16_t q16_from_float(float f) {
+    uint32_t bits, exp, mant, mag;
+    int shift;
+    memcpy(&bits, &f, sizeof(bits));
+    exp  = (bits >> 23) & 0xFFu;
+    mant = bits & 0x7FFFFFu;
+
+    if (exp == 0xFFu) {
+        if (mant) return 0;                               /* NaN  */
+        return (bits >> 31) ? Q16_MIN : Q16_MAX;          /* ±Inf */
+    }
+    if (exp < 110u) return 0;        /* |f| < 2^-17: zero, denormal, tiny */
+
+    mant |= 0x800000u;               /* Implicit leading 1 */
+    shift = (int)exp - 134;          /* f·2^16 = mant·2^(exp-127-23+16) */
+    if (shift >= 8) {
+        return (bits >> 31) ? Q16_MIN : Q16_MAX;          /* |f| >= 2^15 */
+    } else if (shift >= 0) {
+        mag = mant << shift;
+    } else {
+        mag = (mant + (1u << (-shift - 1))) >> -shift;
+    }
+    if (mag > 0x7FFFFFFFu) mag = 0x7FFFFFFFu;
+    return (bits >> 31) ? -(q16_t)mag : (q16_t)mag;
+}
+
+/** Q16 -> float. Exact for |q| < 2^24, otherwise rounded to nearest. */
+static inline float q16_to_float(q16_t q) {
+    uint32_t sign = 0, mag, bits, mant;
+    int msb, exp;
+    float f;
+    if (q == 0) return 0.0f;
+    if (q < 0) {
+        sign = 0x80000000u;
+        mag = (uint32_t)0 - (uint32_t)q;
+    } else {
+        mag = (uint32_t)q;
+    }
+    msb = 31;
+    while (!(mag & (1u << msb))) msb--;
+    if (msb > 23) {
+        uint32_t drop = (uint32_t)(msb - 23);
+        mant = (mag + (1u << (drop - 1))) >> drop;
+        if (mant & 0x1000000u) { mant >>= 1; msb++; }     /* Rounding carry */
+    } else {
+        mant = mag << (23 - msb);
+    }
+    exp  = msb - 16 + 127;
+    bits = sign | ((uint32_t)exp << 23) | (mant & 0x7FFFFFu);
+    memcpy(&f, &bits, sizeof(f));
+    return f;
+}
+
+/* -----------------------------------------------------------------------
+ * Radio encoding (fixed-point counterparts of float_to_mm / mm_to_float)
+ *
+ * Same wire format as the float versions in types.h: int16 millimetres,
+ * clamped to ±32.767 m. Encoding rounds to nearest so decode -> encode is
+ * lossless; float_to_mm truncates, so the two may differ by 1 mm.
+ * ----------------------------------------------------------------------- */
+
+#define Q16_MM_LIMIT Q16_CONST(32.767)
+
+static inline q16_t q16_from_mm(int16_t mm) {
+    int32_t v = (int32_t)mm * 65536;
+    return (q16_t)((v + (v >= 0 ? 500 : -500)) / 1000);
+}
+
+static inline int16_t q16_to_mm(q16_t meters) {
+    q16_t clamped = meters;
+    int32_t scaled;
+    if (clamped > Q16_MM_LIMIT)  clamped = Q16_MM_LIMIT;
+    if (clamped < -Q16_MM_LIMIT) clamped = -Q16_MM_LIMIT;
+    scaled = (int32_t)clamped * 1000;
+    return (int16_t)((scaled + (scaled >= 0 ? 32768 : -32768)) / 65536);
+}
+
+#endif /* SESHAT_SWARM_FIXED_POINT_H */
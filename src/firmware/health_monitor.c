@@ -0,0 +1,186 @@
+/**
+ * Seshat Swarm — Control-Loop Health Monitor Implementation
+ *
+ * All state is static and updated with integer arithmetic only, so a step
+ * costs a few dozen cycles. Two windows run side by side: the latched
+ * status byte (cleared by health_monitor_take_status at the telemetry
+ * rate) and the packet statistics (cleared by health_monitor_pack at the
+ * extended-channel rate).
+ *
+ * Target: STM32F405 (Crazyflie 2.1+), arm-none-eabi-gcc.
+ */
+
+#include "health_monitor.h"
+#include <string.h>  /* memset */
+
+/* -----------------------------------------------------------------------
+ * State
+ * ----------------------------------------------------------------------- */
+
+typedef struct {
+    uint32_t jitter_max_us;
+    uint32_t jitter_sum_us;
+    uint32_t jitter_samples;
+    uint32_t exec_max_us;
+    uint32_t cmd_age_max_us;
+    uint32_t cmd_age_sum_ms;
+    uint32_t cmd_age_samples;
+    uint32_t cmd_gap_max_us;
+} HealthWindow;
+
+typedef struct {
+    uint32_t period_us;
+    uint32_t cmd_gap_limit_us;
+
+    uint32_t steps;
+    uint16_t overruns;
+    uint16_t cmd_gaps;
+
+    uint8_t  have_step;
+    uint8_t  have_cmd;
+    uint32_t last_start_us;
+    uint32_t last_cmd_us;
+
+    /* Latched for the status byte */
+    uint8_t  latched_flags;
+    uint8_t  latched_jitter;
+    uint32_t latched_cmd_age_us;
+
+    HealthWindow window;
+} HealthState;
+
+static HealthState s_health;
+
+/* -----------------------------------------------------------------------
+ * Internal helpers
+ * ----------------------------------------------------------------------- */
+
+static uint16_t sat_u16(uint32_t v) {
+    return v > 0xFFFFu ? 0xFFFFu : (uint16_t)v;
+}
+
+static void inc_sat_u16(uint16_t* v) {
+    if (*v != 0xFFFFu) (*v)++;
+}
+
+/** Jitter level 0..3 relative to the period (see HEALTH_JITTER_MASK). */
+static uint8_t jitter_level(uint32_t jitter_us, uint32_t period_us) {
+    if (jitter_us < period_us / 16u) return 0;
+    if (jitter_us < period_us / 8u) return 1;
+    if (jitter_us < period_us / 4u) return 2;
+    return 3;
+}
+
+static uint8_t cmd_age_code(uint32_t age_us) {
+    uint32_t code = age_us / (HEALTH_CMD_AGE_UNIT_MS * 1000u);
+    return code > 7u ? 7u : (uint8_t)code;
+}
+
+/* -----------------------------------------------------------------------
+ * Public API
+ * ----------------------------------------------------------------------- */
+
+void health_monitor_init(uint32_t period_us, uint32_t cmd_gap_limit_us) {
+    memset(&s_health, 0, sizeof(s_health));
+    s_health.period_us = period_us;
+    s_health.cmd_gap_limit_us = cmd_gap_limit_us;
+}
+
+void health_monitor_command_received(uint32_t now_us) {
+    HealthState* h = &s_health;
+    if (h->have_cmd) {
+        uint32_t gap = now_us - h->last_cmd_us;
+        if (gap > h->window.cmd_gap_max_us) h->window.cmd_gap_max_us = gap;
+        if (gap > h->cmd_gap_limit_us) {
+            inc_sat_u16(&h->cmd_gaps);
+            h->latched_flags |= HEALTH_STATUS_CMD_GAP;
+        }
+    }
+    h->have_cmd = 1;
+    h->last_cmd_us = now_us;
+}
+
+void health_monitor_step(uint32_t start_us, uint32_t end_us) {
+    HealthState* h = &s_health;
+    HealthWindow* w = &h->window;
+    uint32_t exec_us = end_us - start_us;
+
+    if (h->steps != UINT32_MAX) h->steps++;
+
+    /* Jitter: deviation of this step's start from the nominal period. */
+    if (h->have_step) {
+        uint32_t interval = start_us - h->last_start_us;
+        uint32_t jitter = interval > h->period_us ? interval - h->period_us
+                                                  : h->period_us - interval;
+        uint8_t level = jitter_level(jitter, h->period_us);
+        if (jitter > w->jitter_max_us) w->jitter_max_us = jitter;
+        w->jitter_sum_us += jitter;
+        w->jitter_samples++;
+        if (level > h->latched_jitter) h->latched_jitter = level;
+    }
+    h->have_step = 1;
+    h->last_start_us = start_us;
+
+    /* Deadline: the step must finish within one period. */
+    if (exec_us > w->exec_max_us) w->exec_max_us = exec_us;
+    if (exec_us > h->period_us) {
+        inc_sat_u16(&h->overruns);
+        h->latched_flags |= HEALTH_STATUS_OVERRUN;
+    }
+
+    /* Age of the command this step acted on. Before the first command
+     * the age is unbounded; report it as saturated. */
+    {
+        uint32_t age = h->have_cmd ? start_us - h->last_cmd_us : UINT32_MAX;
+        if (age > h->latched_cmd_age_us) h->latched_cmd_age_us = age;
+        if (age > w->cmd_age_max_us) w->cmd_age_max_us = age;
+        w->cmd_age_sum_ms += sat_u16(age / 1000u);
+        w->cmd_age_samples++;
+    }
+}
+
+uint8_t health_monitor_take_status(void) {
+    HealthState* h = &s_health;
+    uint8_t status = (uint8_t)(HEALTH_STATUS_VALID
+        | h->latched_flags
+        | (h->latched_jitter << HEALTH_JITTER_SHIFT)
+        | (cmd_age_code(h->latched_cmd_age_us) << HEALTH_CMD_AGE_SHIFT));
+
+    h->latched_flags = 0;
+    h->latched_jitter = 0;
+    h->latched_cmd_age_us = 0;
+    return status;
+}
+
+void health_monitor_pack(HealthPacket* out) {
+    HealthState* h = &s_health;
+    const HealthWindow* w = &h->window;
+    uint8_t window_flags = 0;
+
+    if (w->jitter_samples > 0) {
+        window_flags |= (uint8_t)(jitter_level(w->jitter_max_us, h->period_us)
+                                  << HEALTH_JITTER_SHIFT);
+    }
+    if (w->exec_max_us > h->period_us) window_flags |= HEALTH_STATUS_OVERRUN;
+    if (w->cmd_gap_max_us > h->cmd_gap_limit_us) window_flags |= HEALTH_STATUS_CMD_GAP;
+    if (w->cmd_age_samples > 0) {
+        window_flags |= (uint8_t)(cmd_age_code(w->cmd_age_max_us) << HEALTH_CMD_AGE_SHIFT);
+    }
+
+    out->kind = EXT_PACKET_HEALTH;
+    out->status = (uint8_t)(HEALTH_STATUS_VALID | window_flags);
+    out->period_us = sat_u16(h->period_us);
+    out->steps = h->steps;
+    out->overruns = h->overruns;
+    out->cmd_gaps = h->cmd_gaps;
+    out->jitter_max_us = sat_u16(w->jitter_max_us);
+    out->jitter_mean_us = w->jitter_samples
+        ? sat_u16(w->jitter_sum_us / w->jitter_samples) : 0;
+    out->exec_max_us = sat_u16(w->exec_max_us);
+    out->cmd_age_max_ms = sat_u16(w->cmd_age_max_us / 1000u);
+    out->cmd_age_mean_ms = w->cmd_age_samples
+        ? sat_u16(w->cmd_age_sum_ms / w->cmd_age_samples) : 0;
+    out->cmd_gap_max_ms = sat_u16(w->cmd_gap_max_us / 1000u);
+
+    memset(&h->window, 0, sizeof(h->window));
+}
@@ -0,0 +1,76 @@
+/**
+ * Seshat Swarm — Control-Loop Health Monitor
+ *
+ * Tells the ground *why* a drone misbehaves: whether its own loop is
+ * late or overrunning, or whether its commands stopped arriving. The
+ * caller feeds it timestamps; it never reads a clock itself.
+ *
+ * Tracked per step:
+ *   jitter    |start − previous start − period|
+ *   overrun   step execution time > period (the step missed its deadline)
+ *   cmd age   step start − arrival time of the command in use
+ * Tracked per received command:
+ *   cmd gap   time since the previous command > cmd_gap_limit_us
+ *
+ * Reported two ways:
+ *   - health_monitor_take_status(): one byte for TelemetryPacket.health,
+ *     summarising the steps since the previous call (flags are latched
+ *     until read, so a slower telemetry rate does not hide events).
+ *   - health_monitor_pack(): a HealthPacket for the extended channel with
+ *     cumulative counters and window max/mean.
+ *
+ * Usage:
+ *   health_monitor_init(2000, 50000);          // 500 Hz loop, 50 ms gap
+ *   // Radio RX:
+ *   if (command_parse(raw, len, &cmd)) health_monitor_command_received(now_us());
+ *   // Control loop:
+ *   uint32_t t0 = now_us();
+ *   sp = pattern_executor_step(&cmd, &sensor);
+ *   health_monitor_step(t0, now_us());
+ *   // Telemetry:
+ *   telemetry_pack(&sensor, id, flags, &pkt);
+ *   pkt.health = health_monitor_take_status();
+ *
+ * Timestamps are free-running µs counters; all differences are taken
+ * modulo 2^32, so wrap-around is harmless.
+ *
+ * Target: STM32F405 (Crazyflie 2.1+), arm-none-eabi-gcc.
+ */
+
+#ifndef SESHAT_SWARM_HEALTH_MONITOR_H
+#define SESHAT_SWARM_HEALTH_MONITOR_H
+
+#include "types.h"
+
+/**
+ * Reset all counters.
+ *
+ * @param period_us         Nominal control-loop period (the step deadline).
+ * @param cmd_gap_limit_us  Command spacing above which a gap is counted.
+ */
+void health_monitor_init(uint32_t period_us, uint32_t cmd_gap_limit_us);
+
+/** Record that a valid command arrived at `now_us`. */
+void health_monitor_command_received(uint32_t now_us);
+
+/**
+ * Record one control-loop step.
+ *
+ * @param start_us  Time the step began (used for jitter and command age).
+ * @param end_us    Time the step finished (used for the overrun check).
+ */
+void health_monitor_step(uint32_t start_us, uint32_t end_us);
+
+/**
+ * Health byte for TelemetryPacket.health (HEALTH_STATUS_* in types.h)
+ * covering the steps since the previous call. Clears the latched flags.
+ */
+uint8_t health_monitor_take_status(void);
+
+/**
+ * Fill a HealthPacket and start a new statistics window. Does not clear
+ * the flags latched for health_monitor_take_status().
+ */
+void health_monitor_pack(HealthPacket* out);
+
+#endif /* SESHAT_SWARM_HEALTH_MONITOR_H */
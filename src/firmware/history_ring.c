@@ -0,0 +1,231 @@
+/**
+ * Seshat Swarm — Onboard Telemetry History Ring Implementation
+ *
+ * A static array of HistorySamples indexed by a free-running sequence
+ * number (seq % HISTORY_CAPACITY). Recording is a quantize and a 28-byte
+ * store; the download path linearizes the ring oldest-first on the fly,
+ * so no second buffer is needed.
+ *
+ * Target: STM32F405 (Crazyflie 2.1+), arm-none-eabi-gcc.
+ */
+
+#include "history_ring.h"
+#include <string.h>  /* memcpy, memset */
+
+#if HISTORY_CAPACITY > 65535u || HISTORY_POST_TRIGGER >= HISTORY_CAPACITY
+#error "history_ring: need HISTORY_POST_TRIGGER < HISTORY_CAPACITY <= 65535"
+#endif
+
+/* -----------------------------------------------------------------------
+ * State
+ * ----------------------------------------------------------------------- */
+
+typedef struct {
+    HistorySample samples[HISTORY_CAPACITY];
+    uint32_t seq;               /* Samples recorded since the last reset */
+    uint32_t trigger_seq;       /* Sequence number of the trigger sample */
+    uint16_t post_remaining;
+    uint16_t period_us;
+    uint8_t  state;             /* HistoryState                          */
+    uint8_t  trigger;           /* HISTORY_TRIGGER_*                     */
+    uint8_t  pending_trigger;   /* From history_trigger()                */
+    uint8_t  capture_id;
+    uint8_t  prev_cmd_flags;
+
+    /* Download carousel */
+    uint16_t chunk_cursor;
+    uint16_t packets_sent;
+} HistoryRing;
+
+static HistoryRing s_ring;
+
+/* -----------------------------------------------------------------------
+ * Quantization
+ * ----------------------------------------------------------------------- */
+
+#define RAD_TO_CDEG 5729.5779513f   /* 18000 / π */
+
+/**
+ * Scale and round to int16, clamping to ±32767; NaN maps to
+ * HISTORY_NAN_I16. Rounds rather than truncating like float_to_mm, so a
+ * post-mortem sees no systematic half-unit bias.
+ */
+static int16_t quant_i16(float v, float scale) {
+    float x = v * scale;
+    if (x != x) return HISTORY_NAN_I16;
+    if (x > 32767.0f) return 32767;
+    if (x < -32767.0f) return -32767;
+    return (int16_t)(x >= 0.0f ? x + 0.5f : x - 0.5f);
+}
+
+void history_quantize(const SensorState* state, const MotorSetpoints* sp,
+                      HistorySample* out) {
+    float thrust = sp->thrust;
+    float batt = state->battery_pct * 200.0f;
+
+    out->pos_x = quant_i16(state->position.x, 1000.0f);
+    out->pos_y = quant_i16(state->position.y, 1000.0f);
+    out->pos_z = quant_i16(state->position.z, 1000.0f);
+    out->vel_x = quant_i16(state->velocity.x, 1000.0f);
+    out->vel_y = quant_i16(state->velocity.y, 1000.0f);
+    out->vel_z = quant_i16(state->velocity.z, 1000.0f);
+    out->roll_cdeg  = quant_i16(state->orientation.x, RAD_TO_CDEG);
+    out->pitch_cdeg = quant_i16(state->orientation.y, RAD_TO_CDEG);
+    out->yaw_cdeg   = quant_i16(state->orientation.z, RAD_TO_CDEG);
+    out->sp_roll_cdeg  = quant_i16(sp->roll, 100.0f);
+    out->sp_pitch_cdeg = quant_i16(sp->pitch, 100.0f);
+    out->sp_yaw_rate_ddps = quant_i16(sp->yaw, 10.0f);
+    out->sp_thrust = (thrust >= 0.0f)
+        ? (thrust < 65535.0f ? (uint16_t)thrust : 65535u) : 0u;
+    out->battery_pct = (batt >= 0.0f)
+        ? (batt < 200.0f ? (uint8_t)batt : 200u) : 0u;
+    out->sensor_flags = (uint8_t)(state->flags & 0xFFu);
+}
+
+/* -----------------------------------------------------------------------
+ * Internal helpers
+ * ----------------------------------------------------------------------- */
+
+static uint16_t sample_count(void) {
+    return s_ring.seq < HISTORY_CAPACITY ? (uint16_t)s_ring.seq
+                                         : (uint16_t)HISTORY_CAPACITY;
+}
+
+static uint16_t chunk_count(void) {
+    uint32_t bytes = (uint32_t)sample_count() * sizeof(HistorySample);
+    return (uint16_t)((bytes + HISTORY_CHUNK_BYTES - 1u) / HISTORY_CHUNK_BYTES);
+}
+
+static void reset_recording(void) {
+    s_ring.seq = 0;
+    s_ring.state = HISTORY_RECORDING;
+    s_ring.trigger = HISTORY_TRIGGER_NONE;
+    s_ring.pending_trigger = HISTORY_TRIGGER_NONE;
+    s_ring.chunk_cursor = 0;
+    s_ring.packets_sent = 0;
+}
+
+/** Trigger reason for a rising command flag, or HISTORY_TRIGGER_NONE. */
+static uint8_t command_trigger(uint8_t flags, uint8_t prev) {
+    uint8_t rising = (uint8_t)(flags & ~prev);
+    if (rising & CMD_FLAG_EMERGENCY) return HISTORY_TRIGGER_EMERGENCY;
+    if (rising & CMD_FLAG_FORCE_PATTERN) return HISTORY_TRIGGER_FORCED_EXIT;
+    if (rising & CMD_FLAG_HISTORY_FREEZE) return HISTORY_TRIGGER_GROUND;
+    return HISTORY_TRIGGER_NONE;
+}
+
+/* -----------------------------------------------------------------------
+ * Public API
+ * ----------------------------------------------------------------------- */
+
+void history_init(uint16_t period_us) {
+    memset(&s_ring, 0, sizeof(s_ring));
+    s_ring.period_us = period_us;
+    reset_recording();
+}
+
+void history_trigger(uint8_t reason) {
+    if (s_ring.state == HISTORY_RECORDING && reason != HISTORY_TRIGGER_NONE) {
+        s_ring.pending_trigger = reason;
+    }
+}
+
+void history_release(void) {
+    reset_recording();
+}
+
+HistoryState history_state(void) {
+    return (HistoryState)s_ring.state;
+}
+
+void history_record(const SensorState* state, const MotorSetpoints* sp,
+                    uint8_t cmd_flags) {
+    uint8_t trigger = command_trigger(cmd_flags, s_ring.prev_cmd_flags);
+    uint8_t release = (uint8_t)(cmd_flags & ~s_ring.prev_cmd_flags
+                                & CMD_FLAG_HISTORY_RELEASE);
+    s_ring.prev_cmd_flags = cmd_flags;
+
+    if (s_ring.state == HISTORY_FROZEN) {
+        if (release) reset_recording();
+        else return;
+    }
+
+    history_quantize(state, sp, &s_ring.samples[s_ring.seq % HISTORY_CAPACITY]);
+
+    if (s_ring.state == HISTORY_RECORDING) {
+        if (trigger == HISTORY_TRIGGER_NONE) trigger = s_ring.pending_trigger;
+        if (trigger != HISTORY_TRIGGER_NONE) {
+            s_ring.state = HISTORY_TRIGGERED;
+            s_ring.trigger = trigger;
+            s_ring.trigger_seq = s_ring.seq;
+            s_ring.post_remaining = HISTORY_POST_TRIGGER;
+            s_ring.pending_trigger = HISTORY_TRIGGER_NONE;
+        }
+    } else if (s_ring.post_remaining > 0) {
+        s_ring.post_remaining--;
+    }
+
+    s_ring.seq++;
+
+    if (s_ring.state == HISTORY_TRIGGERED && s_ring.post_remaining == 0) {
+        s_ring.state = HISTORY_FROZEN;
+        s_ring.capture_id++;
+        s_ring.chunk_cursor = 0;
+        s_ring.packets_sent = 0;
+    }
+}
+
+uint16_t history_next_packet(uint8_t* buf, uint16_t len) {
+    uint32_t oldest;
+    uint16_t chunks;
+
+    if (s_ring.state != HISTORY_FROZEN || buf == NULL) return 0;
+
+    oldest = s_ring.seq - sample_count();
+    chunks = chunk_count();
+
+    if (s_ring.packets_sent++ % HISTORY_INFO_EVERY == 0) {
+        HistoryInfoPacket info;
+        if (len < sizeof(info)) return 0;
+        info.kind = EXT_PACKET_HISTORY_INFO;
+        info.trigger = s_ring.trigger;
+        info.capture_id = s_ring.capture_id;
+        info.sample_size = (uint8_t)sizeof(HistorySample);
+        info.period_us = s_ring.period_us;
+        info.sample_count = sample_count();
+        info.trigger_index = (uint16_t)(s_ring.trigger_seq - oldest);
+        info.chunk_count = chunks;
+        memcpy(buf, &info, sizeof(info));
+        return (uint16_t)sizeof(info);
+    }
+
+    {
+        HistoryChunkPacket chunk;
+        uint32_t offset = (uint32_t)s_ring.chunk_cursor * HISTORY_CHUNK_BYTES;
+        uint32_t total = (uint32_t)sample_count() * sizeof(HistorySample);
+        uint16_t i;
+
+        if (len < sizeof(chunk)) return 0;
+        chunk.kind = EXT_PACKET_HISTORY_CHUNK;
+        chunk.capture_id = s_ring.capture_id;
+        chunk.chunk_index = s_ring.chunk_cursor;
+        memset(chunk.data, 0, sizeof(chunk.data));
+
+        /* Copy the slice sample by sample; it may straddle two samples
+         * and the ring's wrap point. */
+        for (i = 0; i < HISTORY_CHUNK_BYTES && offset + i < total; ) {
+            uint32_t byte = offset + i;
+            uint32_t idx = (oldest + byte / sizeof(HistorySample)) % HISTORY_CAPACITY;
+            uint32_t within = byte % sizeof(HistorySample);
+            uint32_t n = sizeof(HistorySample) - within;
+            if (n > HISTORY_CHUNK_BYTES - i) n = HISTORY_CHUNK_BYTES - i;
+            if (n > total - byte) n = total - byte;
+            memcpy(&chunk.data[i], (const uint8_t*)&s_ring.samples[idx] + within, n);
+            i = (uint16_t)(i + n);
+        }
+
+        s_ring.chunk_cursor = (uint16_t)((s_ring.chunk_cursor + 1u) % chunks);
+        memcpy(buf, &chunk, sizeof(chunk));
+        return (uint16_t)sizeof(chunk);
+    }
+}
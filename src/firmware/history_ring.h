@@ -0,0 +1,91 @@
+/**
+ * Seshat Swarm — Onboard Telemetry History Ring
+ *
+ * The radio carries TelemetryPacket at 100 Hz at most; this ring keeps
+ * every control-loop sample (500 Hz) in RAM so a maneuver such as
+ * avoid-emergency can be replayed at full rate afterwards.
+ *
+ * Samples are quantized to 28-byte HistorySamples (types.h). The ring
+ * records continuously until a trigger fires, keeps recording
+ * HISTORY_POST_TRIGGER more samples, then freezes. Triggers:
+ *   - CMD_FLAG_EMERGENCY rising edge
+ *   - CMD_FLAG_FORCE_PATTERN rising edge (the ground forced an exit)
+ *   - CMD_FLAG_HISTORY_FREEZE (ground request), or history_trigger()
+ *
+ * A frozen capture is downloaded as a carousel: each call to
+ * history_next_packet() yields the next HistoryChunkPacket, with a
+ * HistoryInfoPacket every HISTORY_INFO_EVERY packets. The radio layer
+ * calls it only in otherwise idle TX slots, so steady-state link load is
+ * unchanged; lost chunks simply come round again. When the ground has
+ * every chunk it sets CMD_FLAG_HISTORY_RELEASE and recording resumes.
+ *
+ * RAM: HISTORY_CAPACITY × 28 bytes (28 KB at the default 1024 samples,
+ * ~2 s at 500 Hz).
+ *
+ * Usage:
+ *   history_init(2000);                         // 500 Hz
+ *   // Control loop, after pattern_executor_step:
+ *   history_record(&sensor, &sp, cmd.flags);
+ *   // Radio, when a TX slot would otherwise go unused:
+ *   uint8_t buf[32];
+ *   uint16_t n = history_next_packet(buf, sizeof(buf));
+ *   if (n) radio_send_ext(buf, n);
+ *
+ * Target: STM32F405 (Crazyflie 2.1+), arm-none-eabi-gcc.
+ */
+
+#ifndef SESHAT_SWARM_HISTORY_RING_H
+#define SESHAT_SWARM_HISTORY_RING_H
+
+#include "types.h"
+
+#ifndef HISTORY_CAPACITY
+#define HISTORY_CAPACITY      1024u   /* Samples kept (must fit uint16)   */
+#endif
+#ifndef HISTORY_POST_TRIGGER
+#define HISTORY_POST_TRIGGER  256u    /* Samples recorded after a trigger */
+#endif
+#define HISTORY_INFO_EVERY    16u     /* Info packet cadence in download  */
+
+typedef enum {
+    HISTORY_RECORDING = 0,
+    HISTORY_TRIGGERED = 1,            /* Recording the post-trigger tail  */
+    HISTORY_FROZEN    = 2             /* Capture ready for download       */
+} HistoryState;
+
+/** Clear the ring and start recording at the given sample period. */
+void history_init(uint16_t period_us);
+
+/**
+ * Record one control-loop sample and evaluate the command-flag triggers
+ * (rising edges of CMD_FLAG_EMERGENCY / CMD_FLAG_FORCE_PATTERN /
+ * CMD_FLAG_HISTORY_FREEZE; CMD_FLAG_HISTORY_RELEASE while frozen).
+ * Does nothing to the ring while frozen.
+ */
+void history_record(const SensorState* state, const MotorSetpoints* sp,
+                    uint8_t cmd_flags);
+
+/**
+ * Trigger a freeze from onboard code (HISTORY_TRIGGER_*). The next
+ * recorded sample is the trigger sample. Ignored unless recording.
+ */
+void history_trigger(uint8_t reason);
+
+/** Discard the frozen capture and resume recording. */
+void history_release(void);
+
+HistoryState history_state(void);
+
+/**
+ * Write the next download packet (HistoryInfoPacket or
+ * HistoryChunkPacket) into `buf`.
+ *
+ * @return Bytes written, or 0 if nothing is frozen or `len` is too small.
+ */
+uint16_t history_next_packet(uint8_t* buf, uint16_t len);
+
+/** Quantize one sample (exposed for host tests). */
+void history_quantize(const SensorState* state, const MotorSetpoints* sp,
+                      HistorySample* out);
+
+#endif /* SESHAT_SWARM_HISTORY_RING_H */
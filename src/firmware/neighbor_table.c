@@ -0,0 +1,249 @@
+/**
+ * Seshat Swarm — Peer-to-Peer Neighbor Table Implementation
+ *
+ * A flat array of NEIGHBOR_TABLE_SIZE entries searched linearly; at this
+ * size that beats any index. Ages are unsigned differences of the local
+ * µs clock, so they survive its 71-minute wrap.
+ *
+ * Target: STM32F405 (Crazyflie 2.1+), arm-none-eabi-gcc.
+ */
+
+#include "neighbor_table.h"
+#include <math.h>    /* sqrtf */
+#include <string.h>  /* memcpy, memset */
+
+/* -- Constants ---------------------------------------------------------- */
+
+#define GUARD_VEL_GAIN   8.0f   /* Velocity error -> attitude (deg), as the executor */
+#define GUARD_MAX_ANGLE  25.0f  /* Max commanded attitude angle (deg)                */
+#define MIN_RESOLVABLE   0.01f  /* meters, m/s                                       */
+
+/* -----------------------------------------------------------------------
+ * State
+ * ----------------------------------------------------------------------- */
+
+static const NeighborConfig DEFAULT_CONFIG = NEIGHBOR_DEFAULTS;
+
+static struct {
+    Neighbor entries[NEIGHBOR_TABLE_SIZE];
+    NeighborConfig cfg;
+    Vec3    self_pos;          /* Last known own position, for eviction  */
+    uint8_t self_id;
+    uint8_t next_seq;
+    uint8_t guard_active;
+} s_nt;
+
+/* -----------------------------------------------------------------------
+ * Internal helpers
+ * ----------------------------------------------------------------------- */
+
+static int is_fresh(const Neighbor* n, uint32_t now_us) {
+    return n->in_use && (uint32_t)(now_us - n->rx_us) <= s_nt.cfg.max_age_us;
+}
+
+static float dist_sq(const Vec3* a, const Vec3* b) {
+    float dx = a->x - b->x;
+    float dy = a->y - b->y;
+    float dz = a->z - b->z;
+    return dx * dx + dy * dy + dz * dz;
+}
+
+static float clampf(float v, float lo, float hi) {
+    if (v < lo) return lo;
+    if (v > hi) return hi;
+    return v;
+}
+
+/** Slot for `pkt`: its own entry, a free or aged-out one, or the farthest
+ *  neighbour if the sender is closer. NULL if the packet is to be dropped. */
+static Neighbor* slot_for(const PeerStatePacket* pkt, const Vec3* pos,
+                          uint32_t now_us) {
+    Neighbor* free_slot = NULL;
+    Neighbor* farthest = NULL;
+    float farthest_sq = -1.0f;
+    uint8_t i;
+
+    for (i = 0; i < NEIGHBOR_TABLE_SIZE; i++) {
+        Neighbor* n = &s_nt.entries[i];
+        if (!is_fresh(n, now_us)) {
+            if (n->in_use && n->drone_id == pkt->drone_id) return n;
+            if (!free_slot) free_slot = n;
+            continue;
+        }
+        if (n->drone_id == pkt->drone_id) {
+            /* Newer in serial-number order; stale or repeated seqs drop. */
+            return (int8_t)(uint8_t)(pkt->seq - n->seq) > 0 ? n : NULL;
+        }
+        if (dist_sq(&n->position, &s_nt.self_pos) > farthest_sq) {
+            farthest_sq = dist_sq(&n->position, &s_nt.self_pos);
+            farthest = n;
+        }
+    }
+    if (free_slot) return free_slot;
+    return dist_sq(pos, &s_nt.self_pos) < farthest_sq ? farthest : NULL;
+}
+
+/* -----------------------------------------------------------------------
+ * Public API
+ * ----------------------------------------------------------------------- */
+
+void neighbor_table_init(uint8_t self_id, const NeighborConfig* cfg) {
+    memset(&s_nt, 0, sizeof(s_nt));
+    s_nt.cfg = cfg ? *cfg : DEFAULT_CONFIG;
+    s_nt.self_id = self_id;
+}
+
+void neighbor_pack_state(uint8_t drone_id, uint8_t seq, uint8_t flags,
+                         const SensorState* state, PeerStatePacket* out) {
+    out->kind = P2P_PACKET_STATE;
+    out->drone_id = drone_id;
+    out->seq = seq;
+    out->flags = flags;
+    out->pos_x = float_to_mm(state->position.x);
+    out->pos_y = float_to_mm(state->position.y);
+    out->pos_z = float_to_mm(state->position.z);
+    out->vel_x = float_to_mm(state->velocity.x);
+    out->vel_y = float_to_mm(state->velocity.y);
+    out->vel_z = float_to_mm(state->velocity.z);
+}
+
+void neighbor_table_pack_self(const SensorState* state, uint8_t flags,
+                              PeerStatePacket* out) {
+    s_nt.self_pos = state->position;
+    neighbor_pack_state(s_nt.self_id, s_nt.next_seq++, flags, state, out);
+}
+
+int neighbor_table_receive(const uint8_t* buf, uint16_t len, uint32_t now_us) {
+    PeerStatePacket pkt;
+    Neighbor* n;
+    Vec3 pos;
+
+    if (buf == NULL || len < sizeof(PeerStatePacket)) return 0;
+    memcpy(&pkt, buf, sizeof(pkt));
+    if (pkt.kind != P2P_PACKET_STATE || pkt.drone_id == s_nt.self_id) return 0;
+
+    pos.x = mm_to_float(pkt.pos_x);
+    pos.y = mm_to_float(pkt.pos_y);
+    pos.z = mm_to_float(pkt.pos_z);
+    n = slot_for(&pkt, &pos, now_us);
+    if (!n) return 0;
+
+    n->drone_id = pkt.drone_id;
+    n->seq = pkt.seq;
+    n->flags = pkt.flags;
+    n->in_use = 1;
+    n->rx_us = now_us;
+    n->position = pos;
+    n->velocity.x = mm_to_float(pkt.vel_x);
+    n->velocity.y = mm_to_float(pkt.vel_y);
+    n->velocity.z = mm_to_float(pkt.vel_z);
+    return 1;
+}
+
+uint8_t neighbor_table_count(uint32_t now_us) {
+    uint8_t i, count = 0;
+    for (i = 0; i < NEIGHBOR_TABLE_SIZE; i++) {
+        if (is_fresh(&s_nt.entries[i], now_us)) count++;
+    }
+    return count;
+}
+
+int neighbor_table_find(uint8_t drone_id, uint32_t now_us, Neighbor* out) {
+    uint8_t i;
+    for (i = 0; i < NEIGHBOR_TABLE_SIZE; i++) {
+        const Neighbor* n = &s_nt.entries[i];
+        if (is_fresh(n, now_us) && n->drone_id == drone_id) {
+            if (out) *out = *n;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+int neighbor_table_predict(uint8_t drone_id, uint32_t now_us,
+                           Vec3* position, Vec3* velocity) {
+    Neighbor n;
+    float age_s;
+    if (!neighbor_table_find(drone_id, now_us, &n)) return 0;
+    age_s = (float)(uint32_t)(now_us - n.rx_us) * 1e-6f;
+    position->x = n.position.x + n.velocity.x * age_s;
+    position->y = n.position.y + n.velocity.y * age_s;
+    position->z = n.position.z + n.velocity.z * age_s;
+    *velocity = n.velocity;
+    return 1;
+}
+
+int neighbor_separation_guard(const SensorState* state, uint32_t now_us,
+                              MotorSetpoints* sp) {
+    const Vec3* p = &state->position;
+    const Vec3* v = &state->velocity;
+    float threshold = s_nt.cfg.min_separation_m
+                    + (s_nt.guard_active ? s_nt.cfg.release_margin_m : 0.0f);
+    float ax = 0.0f, ay = 0.0f;   /* Summed escape direction */
+    float a;
+    int threat = 0;
+    uint8_t i;
+
+    s_nt.self_pos = *p;
+    for (i = 0; i < NEIGHBOR_TABLE_SIZE; i++) {
+        const Neighbor* n = &s_nt.entries[i];
+        float age_s, dx, dy, dz, wx, wy, wz, ww, t, mx, my, mz, dist, h, weight;
+        if (!is_fresh(n, now_us)) continue;
+
+        /* Offset from the neighbour, dead-reckoned to now. */
+        age_s = (float)(uint32_t)(now_us - n->rx_us) * 1e-6f;
+        dx = p->x - (n->position.x + n->velocity.x * age_s);
+        dy = p->y - (n->position.y + n->velocity.y * age_s);
+        dz = p->z - (n->position.z + n->velocity.z * age_s);
+
+        /* Closest approach within the horizon at current velocities. */
+        wx = v->x - n->velocity.x;
+        wy = v->y - n->velocity.y;
+        wz = v->z - n->velocity.z;
+        ww = wx * wx + wy * wy + wz * wz;
+        t = (ww > MIN_RESOLVABLE * MIN_RESOLVABLE)
+          ? clampf(-(dx * wx + dy * wy + dz * wz) / ww, 0.0f, s_nt.cfg.horizon_s)
+          : 0.0f;
+        mx = dx + wx * t;
+        my = dy + wy * t;
+        mz = dz + wz * t;
+        dist = sqrtf(mx * mx + my * my + mz * mz);
+        if (dist >= threshold) continue;
+        threat = 1;
+
+        /* Escape horizontally: along the current offset, the predicted one
+         * if stacked, and by ID order if both are degenerate. */
+        h = sqrtf(dx * dx + dy * dy);
+        if (h < MIN_RESOLVABLE) {
+            dx = mx;
+            dy = my;
+            h = sqrtf(dx * dx + dy * dy);
+        }
+        if (h < MIN_RESOLVABLE) {
+            dx = (s_nt.self_id < n->drone_id) ? 1.0f : -1.0f;
+            dy = 0.0f;
+            h = 1.0f;
+        }
+        weight = (threshold - dist) / threshold;
+        ax += dx / h * weight;
+        ay += dy / h * weight;
+    }
+
+    s_nt.guard_active = (uint8_t)threat;
+    if (!threat) return 0;
+
+    /* Neighbours on opposite sides can cancel out; any direction beats none. */
+    a = sqrtf(ax * ax + ay * ay);
+    if (a < 1e-6f) {
+        ax = 1.0f;
+        ay = 0.0f;
+        a = 1.0f;
+    }
+    /* Convention: x -> pitch, y -> roll (see pattern_executor.c). */
+    sp->pitch = clampf(GUARD_VEL_GAIN * (ax / a * s_nt.cfg.escape_speed_ms - v->x),
+                       -GUARD_MAX_ANGLE, GUARD_MAX_ANGLE);
+    sp->roll  = clampf(GUARD_VEL_GAIN * (ay / a * s_nt.cfg.escape_speed_ms - v->y),
+                       -GUARD_MAX_ANGLE, GUARD_MAX_ANGLE);
+    sp->yaw   = 0.0f;
+    return 1;
+}
@@ -0,0 +1,124 @@
+/**
+ * Seshat Swarm — Peer-to-Peer Neighbor Table
+ *
+ * Every drone broadcasts its position and velocity on the P2P channel
+ * (PeerStatePacket) and keeps what it hears from others in a fixed-size
+ * table. The ground's neighbor graph (ε in WorldModel) still drives
+ * pattern selection; this table lets a drone react to a neighbour within
+ * one broadcast period instead of two radio hops and a coordinator tick.
+ *
+ * Entries carry the local receive time and age out after max_age_us. An
+ * entry that has aged out is simply ignored and its slot reused; there
+ * is no sweep. When the table is full a newcomer replaces the farthest
+ * neighbour, and only if it is closer.
+ *
+ * The separation guard runs after the pattern generator. For each fresh
+ * neighbour it dead-reckons the neighbour's position to now, then looks
+ * for the closest approach within horizon_s at current velocities. If
+ * that falls under min_separation_m, the generator's roll/pitch are
+ * replaced by a velocity command of escape_speed_ms directly away; thrust
+ * (altitude) is left to the generator. The guard releases once every
+ * predicted approach clears min_separation_m by release_margin.
+ *
+ * Usage:
+ *   neighbor_table_init(my_id, NULL);            // Defaults
+ *   // P2P receive callback:
+ *   neighbor_table_receive(data, len, now_us());
+ *   // Control loop:
+ *   sp = pattern_executor_step(&cmd, &sensor);
+ *   neighbor_separation_guard(&sensor, now_us(), &sp);
+ *   // At the broadcast rate (e.g. 50 Hz):
+ *   neighbor_table_pack_self(&sensor, flags, &pkt);
+ *   p2p_broadcast(&pkt, sizeof(pkt));
+ *
+ * Target: STM32F405 (Crazyflie 2.1+), arm-none-eabi-gcc.
+ */
+
+#ifndef SESHAT_SWARM_NEIGHBOR_TABLE_H
+#define SESHAT_SWARM_NEIGHBOR_TABLE_H
+
+#include "types.h"
+
+/** Neighbours tracked at once. */
+#ifndef NEIGHBOR_TABLE_SIZE
+#define NEIGHBOR_TABLE_SIZE 8u
+#endif
+
+typedef struct {
+    uint32_t max_age_us;       /* Entry lifetime without a fresh packet  */
+    float    min_separation_m; /* Centre-to-centre distance to keep      */
+    float    release_margin_m; /* Extra clearance before letting go      */
+    float    horizon_s;        /* Look-ahead for the closest approach    */
+    float    escape_speed_ms;  /* Speed of the evasive velocity command  */
+} NeighborConfig;
+
+/* 300 ms (15 broadcasts at 50 Hz); 0.35 m + 0.1 m; 0.5 s; 0.5 m/s */
+#define NEIGHBOR_DEFAULTS { 300000u, 0.35f, 0.1f, 0.5f, 0.5f }
+
+/** One neighbour as last heard, in the receiver's clock. */
+typedef struct {
+    uint8_t  drone_id;
+    uint8_t  seq;
+    uint8_t  flags;            /* Sender's TELEM_FLAG_* bitfield         */
+    uint8_t  in_use;
+    uint32_t rx_us;
+    Vec3     position;
+    Vec3     velocity;
+} Neighbor;
+
+/**
+ * Configure the table (NULL for NEIGHBOR_DEFAULTS) and forget every
+ * neighbour. `self_id` goes into this drone's broadcasts, and packets
+ * carrying it are ignored.
+ */
+void neighbor_table_init(uint8_t self_id, const NeighborConfig* cfg);
+
+/**
+ * Encode one PeerStatePacket. Stateless; neighbor_table_pack_self() is
+ * the usual entry point.
+ */
+void neighbor_pack_state(uint8_t drone_id, uint8_t seq, uint8_t flags,
+                         const SensorState* state, PeerStatePacket* out);
+
+/** Encode this drone's next broadcast (own ID, next seq). */
+void neighbor_table_pack_self(const SensorState* state, uint8_t flags,
+                              PeerStatePacket* out);
+
+/**
+ * Fold one received P2P packet in. Packets that are not PeerStatePackets,
+ * carry our own ID, or are not newer than the entry they would update
+ * are dropped.
+ *
+ * @return 1 if the table changed, 0 if the packet was dropped.
+ */
+int neighbor_table_receive(const uint8_t* buf, uint16_t len, uint32_t now_us);
+
+/** Neighbours heard within max_age_us. */
+uint8_t neighbor_table_count(uint32_t now_us);
+
+/**
+ * Copy out the fresh entry for `drone_id`.
+ *
+ * @return 1 if found, 0 if unknown or aged out.
+ */
+int neighbor_table_find(uint8_t drone_id, uint32_t now_us, Neighbor* out);
+
+/**
+ * Fresh entry for `drone_id` dead-reckoned to `now_us`: position advanced
+ * by velocity × age. Feeds pattern_executor_set_leader().
+ *
+ * @return 1 if found, 0 if unknown or aged out (outputs untouched).
+ */
+int neighbor_table_predict(uint8_t drone_id, uint32_t now_us,
+                           Vec3* position, Vec3* velocity);
+
+/**
+ * Pre-empt the generator if a neighbour is, or is about to be, closer
+ * than min_separation_m. Overwrites sp->roll, sp->pitch and sp->yaw.
+ *
+ * @return 1 if the setpoints were replaced this step, 0 otherwise.
+ */
+int neighbor_separation_guard(const SensorState* state, uint32_t now_us,
+                              MotorSetpoints* sp);
+
+#endif /* SESHAT_SWARM_NEIGHBOR_TABLE_H */
@@ -5,81 +5,236 @@
  * Looks up the commanded pattern in the onboard catalog, switches on the
  * generator type, and computes setpoints. Never generates novel behavior.
  *
+ * Generators that need memory across steps keep it in a single static
+ * state arena (no heap). When the commanded pattern_id changes, the old
+ * generator's on_exit hook runs, the arena is cleared, and the new
+ * generator's on_enter hook precomputes whatever it can up front.
+ *
  * Target: STM32F405 (Crazyflie 2.1+), arm-none-eabi-gcc.
  */
 
 #include "pattern_executor.h"
 #include "catalog_data.h"   /* CATALOG[], CATALOG_SIZE */
+#include "perf_probes.h"
+#include <string.h>         /* memset */
+
+/* -- Working precision ---------------------------------------------------
+ * Generator math is written once against real_t. The default build uses
+ * float; -DSESHAT_FIXED_POINT selects Q16.16 (fixed_point.h) for targets
+ * without a single-precision FPU. Commands, SensorState and
+ * MotorSetpoints keep their float/int16 layouts in both builds, so the
+ * radio wire format and the attitude-controller interface are shared.
+ *
+ * Thrust is carried in THRUST_SCALE units internally: Q16.16 tops out at
+ * 32767, below full-scale thrust, so the fixed build works in kilo-units. */
+
+#ifdef SESHAT_FIXED_POINT
+#include "fixed_point.h"
+typedef q16_t real_t;
+#define R(x)               Q16_CONST(x)
+#define R_MUL(a, b)        q16_mul((a), (b))
+#define R_DIV(a, b)        q16_div((a), (b))
+#define R_HYPOT(a, b)      q16_hypot((a), (b))
+#define R_FROM_FLOAT(f)    q16_from_float(f)
+#define R_TO_FLOAT(r)      q16_to_float(r)
+#define R_FROM_MM(mm)      q16_from_mm(mm)
+#define R_THRUST(x)        Q16_CONST((x) / 1000.0)
+#define THRUST_TO_FLOAT(r) ((float)(int32_t)(((int64_t)(r) * 1000 + 0x8000) >> 16))
+#else
 #include <math.h>
+typedef float real_t;
+#define R(x)               (x)
+#define R_MUL(a, b)        ((a) * (b))
+#define R_DIV(a, b)        ((a) / (b))
+#define R_HYPOT(a, b)      sqrtf((a) * (a) + (b) * (b))
+#define R_FROM_FLOAT(f)    (f)
+#define R_TO_FLOAT(r)      (r)
+#define R_FROM_MM(mm)      mm_to_float(mm)
+#define R_THRUST(x)        (x)
+#define THRUST_TO_FLOAT(r) (r)
+#endif
 
 /* -- Constants ---------------------------------------------------------- */
 
-#define HOVER_THRUST         37500.0f  /* Base hover thrust (of 65535)      */
-#define POS_P_GAIN           15.0f     /* Position error -> attitude (deg)  */
-#define VEL_P_GAIN           8.0f      /* Velocity error -> attitude (deg)  */
-#define ALT_P_GAIN           8000.0f   /* Altitude error -> thrust offset   */
-#define MAX_ANGLE_DEG        25.0f     /* Max commanded attitude angle      */
-#define THRUST_MIN           10000.0f
-#define THRUST_MAX           60000.0f
-#define DEFAULT_HOVER_ALT    0.5f      /* meters */
-#define DEFAULT_ORBIT_RADIUS 0.5f      /* meters */
-#define DEFAULT_ORBIT_OMEGA  0.5f      /* rad/s  */
-#define DEFAULT_WP_SPEED     0.3f      /* m/s    */
+#define HOVER_THRUST         R_THRUST(37500.0f) /* Base hover thrust (of 65535) */
+#define POS_P_GAIN           R(15.0f)     /* Position error -> attitude (deg)  */
+#define VEL_P_GAIN           R(8.0f)      /* Velocity error -> attitude (deg)  */
+#define ALT_P_GAIN           R_THRUST(8000.0f) /* Altitude error -> thrust offset */
+#define MAX_ANGLE_DEG        R(25.0f)     /* Max commanded attitude angle      */
+#define THRUST_MIN           R_THRUST(10000.0f)
+#define THRUST_MAX           R_THRUST(60000.0f)
+#define DEFAULT_HOVER_ALT    R(0.5f)      /* meters */
+#define DEFAULT_ORBIT_RADIUS R(0.5f)      /* meters */
+#define DEFAULT_ORBIT_OMEGA  R(0.5f)      /* rad/s  */
+#define DEFAULT_WP_SPEED     R(0.3f)      /* m/s    */
+#define WP_SLOWDOWN_DIST     R(0.3f)      /* meters */
+#define MIN_RESOLVABLE_DIST  R(0.01f)     /* meters */
+#define ORBIT_RADIAL_GAIN    R(15.0f * 0.3f) /* POS_P_GAIN, softened */
+#define SENSOR_LIMIT         R(32.767f)   /* Same range as float_to_mm */
+
+/* -- Generator selection -------------------------------------------------
+ * catalog_data.h defines GEN_USES_* for the generators its patterns
+ * reference; the rest are compiled out along with their dispatch cases.
+ * Catalogs compiled before GEN_USED_MASK existed keep every generator. */
+
+#ifndef GEN_USED_MASK
+#define GEN_USES_POSITION_HOLD     1
+#define GEN_USES_VELOCITY_TRACK    1
+#define GEN_USES_WAYPOINT_SEQUENCE 1
+#define GEN_USES_RELATIVE_OFFSET   1
+#define GEN_USES_ORBIT_CENTER      1
+#define GEN_USES_TRAJECTORY_SPLINE 1
+#define GEN_USES_EMERGENCY_STOP    1
+#define GEN_USES_IDLE              1
+#endif
+
+/* Generators that delegate to another keep their callee linked. */
+#define NEED_POSITION_HOLD  (GEN_USES_POSITION_HOLD || GEN_USES_RELATIVE_OFFSET \
+                             || GEN_USES_TRAJECTORY_SPLINE)
+#define NEED_VELOCITY_TRACK (GEN_USES_VELOCITY_TRACK || GEN_USES_WAYPOINT_SEQUENCE)
+
+/* -- Working state -----------------------------------------------------
+ * The sensor fields the generators read, converted to real_t once per
+ * step, and setpoints before the final conversion to MotorSetpoints. */
+
+typedef struct {
+    real_t px, py, pz;        /* Position, meters */
+    real_t vx, vy;            /* Velocity, m/s    */
+} StateR;
+
+typedef struct {
+    real_t roll, pitch, yaw;  /* Degrees, degrees, degrees/second */
+    real_t thrust;            /* THRUST_SCALE units */
+} SetpointsR;
+
+/* -- Generator state arena ----------------------------------------------
+ * One member per stateful generator. The union is sized by the largest,
+ * and only the active pattern's generator owns it. */
+
+/** GEN_WAYPOINT_SEQUENCE: approach speed resolved at entry. */
+typedef struct {
+    real_t speed;
+} WaypointState;
+
+/** GEN_ORBIT_CENTER: parameters resolved at entry, plus the last radial
+ *  direction so the tangent stays defined when crossing the centre. */
+typedef struct {
+    real_t radius;
+    real_t tangential_speed;  /* omega * radius */
+    real_t ux, uy;            /* Unit vector, centre -> drone */
+} OrbitState;
+
+/** GEN_RELATIVE_OFFSET under CMD_FLAG_LEADER_RELATIVE: the last target
+ *  resolved from the leader, held while the leader is not heard. */
+typedef struct {
+    real_t hold_x, hold_y, hold_z;
+} RelativeState;
+
+typedef union {
+    WaypointState waypoint;
+    OrbitState    orbit;
+    RelativeState relative;
+} GeneratorState;
+
+/** Lifecycle hooks, run when a generator's pattern becomes (in)active. */
+typedef struct {
+    void (*on_enter)(GeneratorState* gs, const StateR* st,
+                     real_t tgt_x, real_t tgt_y, const PatternEntry* pat);
+    void (*on_exit)(GeneratorState* gs);
+} GeneratorHooks;
+
+/** Sentinel for "no pattern active" (matches PATTERN_ID_INVALID). */
+#define NO_ACTIVE_PATTERN 0xFFFFu
 
 static uint8_t s_initialized = 0;
+static GeneratorState s_gen_state;
+static uint16_t s_active_id = NO_ACTIVE_PATTERN;
+static const PatternEntry* s_active_pat = (const PatternEntry*)0;
+
+/** Leader state from pattern_executor_set_leader(). */
+static struct {
+    uint8_t heard;
+    real_t px, py, pz;
+    real_t vx, vy;
+} s_leader;
 
 /* -- Helpers ------------------------------------------------------------ */
 
-static float clampf(float val, float lo, float hi) {
+static real_t clampr(real_t val, real_t lo, real_t hi) {
     if (val < lo) return lo;
     if (val > hi) return hi;
     return val;
 }
 
-/** Look up a pattern by ID. Returns NULL if not found. */
+/** Look up a pattern by ID. Returns NULL if not found.
+ *  The compiler numbers each target's catalog densely, so CATALOG[id].id == id. */
 static const PatternEntry* catalog_lookup(uint16_t pattern_id) {
-    uint16_t i;
-    for (i = 0; i < CATALOG_SIZE; i++) {
-        if (CATALOG[i].id == pattern_id) return &CATALOG[i];
-    }
-    return (const PatternEntry*)0;
+    if (pattern_id >= CATALOG_SIZE) return (const PatternEntry*)0;
+    return &CATALOG[pattern_id];
 }
 
 /** Read pattern parameter with fallback and bounds clamping.
  *  Bounds are active when bounds_max > bounds_min for the slot. */
-static float read_param(const PatternEntry* pat, uint8_t slot, float fallback) {
-    float val;
+static real_t read_param(const PatternEntry* pat, uint8_t slot, real_t fallback) {
+    real_t val, lo, hi;
     if (slot >= PATTERN_MAX_PARAMS) return fallback;
-    val = pat->defaults[slot];
-    if (val == 0.0f && fallback != 0.0f) val = fallback;
-    if (pat->bounds_max[slot] > pat->bounds_min[slot])
-        val = clampf(val, pat->bounds_min[slot], pat->bounds_max[slot]);
+    val = R_FROM_FLOAT(pat->defaults[slot]);
+    if (val == R(0.0f) && fallback != R(0.0f)) val = fallback;
+    lo = R_FROM_FLOAT(pat->bounds_min[slot]);
+    hi = R_FROM_FLOAT(pat->bounds_max[slot]);
+    if (hi > lo) val = clampr(val, lo, hi);
     return val;
 }
 
+/** SensorState ingestion. The fixed build also clamps position and
+ *  velocity to the radio range so differences cannot overflow Q16.16. */
+static void ingest_state(const SensorState* state, StateR* st) {
+    st->px = R_FROM_FLOAT(state->position.x);
+    st->py = R_FROM_FLOAT(state->position.y);
+    st->pz = R_FROM_FLOAT(state->position.z);
+    st->vx = R_FROM_FLOAT(state->velocity.x);
+    st->vy = R_FROM_FLOAT(state->velocity.y);
+#ifdef SESHAT_FIXED_POINT
+    st->px = clampr(st->px, -SENSOR_LIMIT, SENSOR_LIMIT);
+    st->py = clampr(st->py, -SENSOR_LIMIT, SENSOR_LIMIT);
+    st->pz = clampr(st->pz, -SENSOR_LIMIT, SENSOR_LIMIT);
+    st->vx = clampr(st->vx, -SENSOR_LIMIT, SENSOR_LIMIT);
+    st->vy = clampr(st->vy, -SENSOR_LIMIT, SENSOR_LIMIT);
+#endif
+}
+
+static MotorSetpoints to_motor_setpoints(SetpointsR sp) {
+    MotorSetpoints out;
+    out.roll   = R_TO_FLOAT(sp.roll);
+    out.pitch  = R_TO_FLOAT(sp.pitch);
+    out.yaw    = R_TO_FLOAT(sp.yaw);
+    out.thrust = THRUST_TO_FLOAT(sp.thrust);
+    return out;
+}
+
 /** Hover thrust +/- P-correction from altitude error. */
-static float compute_thrust(float current_z, float target_z) {
-    return clampf(HOVER_THRUST + ALT_P_GAIN * (target_z - current_z),
+static real_t compute_thrust(real_t current_z, real_t target_z) {
+    return clampr(HOVER_THRUST + R_MUL(ALT_P_GAIN, target_z - current_z),
                   THRUST_MIN, THRUST_MAX);
 }
 
 /** Clamp attitude and thrust to safe ranges. */
-static MotorSetpoints clamp_setpoints(MotorSetpoints sp) {
-    sp.roll   = clampf(sp.roll,   -MAX_ANGLE_DEG, MAX_ANGLE_DEG);
-    sp.pitch  = clampf(sp.pitch,  -MAX_ANGLE_DEG, MAX_ANGLE_DEG);
-    sp.thrust = clampf(sp.thrust, THRUST_MIN, THRUST_MAX);
+static SetpointsR clamp_setpoints(SetpointsR sp) {
+    sp.roll   = clampr(sp.roll,   -MAX_ANGLE_DEG, MAX_ANGLE_DEG);
+    sp.pitch  = clampr(sp.pitch,  -MAX_ANGLE_DEG, MAX_ANGLE_DEG);
+    sp.thrust = clampr(sp.thrust, THRUST_MIN, THRUST_MAX);
     return sp;
 }
 
 /** Emergency hover: level off and hold altitude. Fallback for all errors. */
-static MotorSetpoints emergency_hover(const SensorState* state) {
-    MotorSetpoints sp;
-    float target_z = state->position.z;
-    if (target_z < 0.1f) target_z = DEFAULT_HOVER_ALT;
-    sp.roll  = 0.0f;
-    sp.pitch = 0.0f;
-    sp.yaw   = 0.0f;
-    sp.thrust = compute_thrust(state->position.z, target_z);
+static SetpointsR emergency_hover(const StateR* st) {
+    SetpointsR sp;
+    real_t target_z = st->pz;
+    if (target_z < R(0.1f)) target_z = DEFAULT_HOVER_ALT;
+    sp.roll  = R(0.0f);
+    sp.pitch = R(0.0f);
+    sp.yaw   = R(0.0f);
+    sp.thrust = compute_thrust(st->pz, target_z);
     return sp;
 }
 
@@ -87,162 +242,339 @@ static MotorSetpoints emergency_hover(const SensorState* state) {
  * Convention: position error_x -> pitch, error_y -> roll.
  * Each generator produces attitude commands for the Crazyflie PID layer. */
 
+#if NEED_POSITION_HOLD
 /** GEN_POSITION_HOLD (0): Hold at target position. Slot 0 = altitude. */
-static MotorSetpoints gen_position_hold(const SensorState* state,
-        float tgt_x, float tgt_y, float tgt_z, const PatternEntry* pat) {
-    MotorSetpoints sp;
-    float alt = read_param(pat, 0, DEFAULT_HOVER_ALT);
-    if (alt > 0.0f) tgt_z = alt;
-    sp.pitch  = clampf(POS_P_GAIN * (tgt_x - state->position.x),
+static SetpointsR gen_position_hold(const StateR* st,
+        real_t tgt_x, real_t tgt_y, real_t tgt_z, const PatternEntry* pat) {
+    SetpointsR sp;
+    real_t alt = read_param(pat, 0, DEFAULT_HOVER_ALT);
+    if (alt > R(0.0f)) tgt_z = alt;
+    sp.pitch  = clampr(R_MUL(POS_P_GAIN, tgt_x - st->px),
                         -MAX_ANGLE_DEG, MAX_ANGLE_DEG);
-    sp.roll   = clampf(POS_P_GAIN * (tgt_y - state->position.y),
+    sp.roll   = clampr(R_MUL(POS_P_GAIN, tgt_y - st->py),
                         -MAX_ANGLE_DEG, MAX_ANGLE_DEG);
-    sp.yaw    = 0.0f;
-    sp.thrust = compute_thrust(state->position.z, tgt_z);
+    sp.yaw    = R(0.0f);
+    sp.thrust = compute_thrust(st->pz, tgt_z);
     return sp;
 }
+#endif
 
+#if NEED_VELOCITY_TRACK
 /** GEN_VELOCITY_TRACK (1): Track target velocity. Slot 0 = max speed. */
-static MotorSetpoints gen_velocity_track(const SensorState* state,
-        float tgt_vx, float tgt_vy, float tgt_z, const PatternEntry* pat) {
-    MotorSetpoints sp;
-    float max_speed = read_param(pat, 0, 1.0f);
-    float spd = sqrtf(tgt_vx * tgt_vx + tgt_vy * tgt_vy);
-    if (spd > max_speed && spd > 0.001f) {
-        float s = max_speed / spd;
-        tgt_vx *= s;
-        tgt_vy *= s;
+static SetpointsR gen_velocity_track(const StateR* st,
+        real_t tgt_vx, real_t tgt_vy, real_t tgt_z, const PatternEntry* pat) {
+    SetpointsR sp;
+    real_t max_speed = read_param(pat, 0, R(1.0f));
+    real_t spd = R_HYPOT(tgt_vx, tgt_vy);
+    if (spd > max_speed && spd > R(0.001f)) {
+        real_t s = R_DIV(max_speed, spd);
+        tgt_vx = R_MUL(tgt_vx, s);
+        tgt_vy = R_MUL(tgt_vy, s);
     }
-    sp.pitch  = clampf(VEL_P_GAIN * (tgt_vx - state->velocity.x),
+    sp.pitch  = clampr(R_MUL(VEL_P_GAIN, tgt_vx - st->vx),
                         -MAX_ANGLE_DEG, MAX_ANGLE_DEG);
-    sp.roll   = clampf(VEL_P_GAIN * (tgt_vy - state->velocity.y),
+    sp.roll   = clampr(R_MUL(VEL_P_GAIN, tgt_vy - st->vy),
                         -MAX_ANGLE_DEG, MAX_ANGLE_DEG);
-    sp.yaw    = 0.0f;
-    sp.thrust = compute_thrust(state->position.z, tgt_z);
+    sp.yaw    = R(0.0f);
+    sp.thrust = compute_thrust(st->pz, tgt_z);
     return sp;
 }
+#endif
 
+#if GEN_USES_WAYPOINT_SEQUENCE
 /** GEN_WAYPOINT_SEQUENCE (2): Fly toward target at configured speed.
- *  Slot 0 = approach speed. Slows linearly within 0.3 m. */
-static MotorSetpoints gen_waypoint_sequence(const SensorState* state,
-        float tgt_x, float tgt_y, float tgt_z, const PatternEntry* pat) {
-    float speed = read_param(pat, 0, DEFAULT_WP_SPEED);
-    float ex = tgt_x - state->position.x;
-    float ey = tgt_y - state->position.y;
-    float dist = sqrtf(ex * ex + ey * ey);
-    float dvx = 0.0f, dvy = 0.0f;
-    if (dist > 0.01f) {
-        float s = speed / dist;
-        if (dist < 0.3f) s = (speed * dist / 0.3f) / dist;
-        dvx = ex * s;
-        dvy = ey * s;
+ *  Slot 0 = approach speed. Slows linearly within WP_SLOWDOWN_DIST. */
+static void waypoint_enter(GeneratorState* gs, const StateR* st,
+        real_t tgt_x, real_t tgt_y, const PatternEntry* pat) {
+    (void)st; (void)tgt_x; (void)tgt_y;
+    gs->waypoint.speed = read_param(pat, 0, DEFAULT_WP_SPEED);
+}
+
+static SetpointsR gen_waypoint_sequence(GeneratorState* gs, const StateR* st,
+        real_t tgt_x, real_t tgt_y, real_t tgt_z, const PatternEntry* pat) {
+    real_t speed = gs->waypoint.speed;
+    real_t ex = tgt_x - st->px;
+    real_t ey = tgt_y - st->py;
+    real_t dist = R_HYPOT(ex, ey);
+    real_t dvx = R(0.0f), dvy = R(0.0f);
+    if (dist > MIN_RESOLVABLE_DIST) {
+        /* Inside the slowdown radius speed scales with dist, so the
+         * per-axis gain is constant: speed / WP_SLOWDOWN_DIST. */
+        real_t s = R_DIV(speed, dist < WP_SLOWDOWN_DIST ? WP_SLOWDOWN_DIST : dist);
+        dvx = R_MUL(ex, s);
+        dvy = R_MUL(ey, s);
     }
-    return gen_velocity_track(state, dvx, dvy, tgt_z, pat);
+    return gen_velocity_track(st, dvx, dvy, tgt_z, pat);
 }
+#endif
 
+#if GEN_USES_RELATIVE_OFFSET
 /** GEN_RELATIVE_OFFSET (3): Hold at target + offset.
  *  Slots 0,1,2 = offset_x, offset_y, offset_z. */
-static MotorSetpoints gen_relative_offset(const SensorState* state,
-        float tgt_x, float tgt_y, float tgt_z, const PatternEntry* pat) {
-    return gen_position_hold(state,
-        tgt_x + read_param(pat, 0, 0.0f),
-        tgt_y + read_param(pat, 1, 0.0f),
-        tgt_z + read_param(pat, 2, 0.0f), pat);
+static SetpointsR gen_relative_offset(const StateR* st,
+        real_t tgt_x, real_t tgt_y, real_t tgt_z, const PatternEntry* pat) {
+    return gen_position_hold(st,
+        tgt_x + read_param(pat, 0, R(0.0f)),
+        tgt_y + read_param(pat, 1, R(0.0f)),
+        tgt_z + read_param(pat, 2, R(0.0f)), pat);
 }
+#endif
 
+#if GEN_USES_RELATIVE_OFFSET
+/** GEN_RELATIVE_OFFSET (3) with CMD_FLAG_LEADER_RELATIVE: hold at
+ *  leader + (off_x, off_y, off_z) + catalog offset, with the leader's
+ *  velocity fed forward. Entry starts the hold at the current position. */
+static void relative_enter(GeneratorState* gs, const StateR* st,
+        real_t tgt_x, real_t tgt_y, const PatternEntry* pat) {
+    (void)tgt_x; (void)tgt_y; (void)pat;
+    gs->relative.hold_x = st->px;
+    gs->relative.hold_y = st->py;
+    gs->relative.hold_z = st->pz;
+}
+
+static SetpointsR gen_leader_offset(GeneratorState* gs, const StateR* st,
+        real_t off_x, real_t off_y, real_t off_z, const PatternEntry* pat) {
+    SetpointsR sp;
+    RelativeState* rs = &gs->relative;
+    real_t ff_vx = R(0.0f), ff_vy = R(0.0f);
+    if (s_leader.heard) {
+        rs->hold_x = s_leader.px + off_x + read_param(pat, 0, R(0.0f));
+        rs->hold_y = s_leader.py + off_y + read_param(pat, 1, R(0.0f));
+        rs->hold_z = s_leader.pz + off_z + read_param(pat, 2, R(0.0f));
+        ff_vx = s_leader.vx;
+        ff_vy = s_leader.vy;
+    }
+    sp.pitch  = clampr(R_MUL(POS_P_GAIN, rs->hold_x - st->px)
+                       + R_MUL(VEL_P_GAIN, ff_vx - st->vx),
+                       -MAX_ANGLE_DEG, MAX_ANGLE_DEG);
+    sp.roll   = clampr(R_MUL(POS_P_GAIN, rs->hold_y - st->py)
+                       + R_MUL(VEL_P_GAIN, ff_vy - st->vy),
+                       -MAX_ANGLE_DEG, MAX_ANGLE_DEG);
+    sp.yaw    = R(0.0f);
+    sp.thrust = compute_thrust(st->pz, rs->hold_z);
+    return sp;
+}
+#endif
+
+#if GEN_USES_ORBIT_CENTER
 /** GEN_ORBIT_CENTER (4): Orbit around target position.
- *  Slot 0 = radius, Slot 1 = angular velocity. */
-static MotorSetpoints gen_orbit_center(const SensorState* state,
-        float cx, float cy, float cz, const PatternEntry* pat) {
-    MotorSetpoints sp;
-    float radius = read_param(pat, 0, DEFAULT_ORBIT_RADIUS);
-    float omega  = read_param(pat, 1, DEFAULT_ORBIT_OMEGA);
-    float dx = state->position.x - cx;
-    float dy = state->position.y - cy;
-    float angle = atan2f(dy, dx);
-    float cur_r = sqrtf(dx * dx + dy * dy);
-    /* Tangential velocity (CCW). */
-    float dvx = -sinf(angle) * omega * radius;
-    float dvy =  cosf(angle) * omega * radius;
+ *  Slot 0 = radius, Slot 1 = angular velocity.
+ *  Entry resolves the parameters and the initial bearing; each step then
+ *  rotates the radial unit vector instead of re-deriving an angle. */
+static void orbit_enter(GeneratorState* gs, const StateR* st,
+        real_t cx, real_t cy, const PatternEntry* pat) {
+    OrbitState* os = &gs->orbit;
+    real_t dx = st->px - cx;
+    real_t dy = st->py - cy;
+    real_t r = R_HYPOT(dx, dy);
+    os->radius = read_param(pat, 0, DEFAULT_ORBIT_RADIUS);
+    os->tangential_speed = R_MUL(read_param(pat, 1, DEFAULT_ORBIT_OMEGA), os->radius);
+    /* At the centre the bearing is undefined; start along +x. */
+    os->ux = (r > MIN_RESOLVABLE_DIST) ? R_DIV(dx, r) : R(1.0f);
+    os->uy = (r > MIN_RESOLVABLE_DIST) ? R_DIV(dy, r) : R(0.0f);
+}
+
+static SetpointsR gen_orbit_center(GeneratorState* gs, const StateR* st,
+        real_t cx, real_t cy, real_t cz) {
+    SetpointsR sp;
+    OrbitState* os = &gs->orbit;
+    real_t dx = st->px - cx;
+    real_t dy = st->py - cy;
+    real_t cur_r = R_HYPOT(dx, dy);
+    real_t dvx, dvy;
+    /* Track the bearing; hold the last one while too close to resolve. */
+    if (cur_r > MIN_RESOLVABLE_DIST) {
+        os->ux = R_DIV(dx, cur_r);
+        os->uy = R_DIV(dy, cur_r);
+    }
+    /* Tangential velocity (CCW): radial unit vector rotated +90 deg. */
+    dvx = -R_MUL(os->uy, os->tangential_speed);
+    dvy =  R_MUL(os->ux, os->tangential_speed);
     /* Radial correction to maintain orbit radius. */
-    if (cur_r > 0.01f) {
-        float re = radius - cur_r;
-        dvx += (dx / cur_r) * re * POS_P_GAIN * 0.3f;
-        dvy += (dy / cur_r) * re * POS_P_GAIN * 0.3f;
+    if (cur_r > MIN_RESOLVABLE_DIST) {
+        real_t corr = R_MUL(os->radius - cur_r, ORBIT_RADIAL_GAIN);
+        dvx += R_MUL(os->ux, corr);
+        dvy += R_MUL(os->uy, corr);
     }
-    sp.pitch  = clampf(VEL_P_GAIN * (dvx - state->velocity.x),
+    sp.pitch  = clampr(R_MUL(VEL_P_GAIN, dvx - st->vx),
                         -MAX_ANGLE_DEG, MAX_ANGLE_DEG);
-    sp.roll   = clampf(VEL_P_GAIN * (dvy - state->velocity.y),
+    sp.roll   = clampr(R_MUL(VEL_P_GAIN, dvy - st->vy),
                         -MAX_ANGLE_DEG, MAX_ANGLE_DEG);
-    sp.yaw    = 0.0f;
-    sp.thrust = compute_thrust(state->position.z, cz);
+    sp.yaw    = R(0.0f);
+    sp.thrust = compute_thrust(st->pz, cz);
     return sp;
 }
+#endif
 
+#if GEN_USES_TRAJECTORY_SPLINE
 /** GEN_TRAJECTORY_SPLINE (5): Stub -- falls back to position hold. */
-static MotorSetpoints gen_trajectory_spline(const SensorState* state,
-        float tgt_x, float tgt_y, float tgt_z, const PatternEntry* pat) {
-    return gen_position_hold(state, tgt_x, tgt_y, tgt_z, pat);
+static SetpointsR gen_trajectory_spline(const StateR* st,
+        real_t tgt_x, real_t tgt_y, real_t tgt_z, const PatternEntry* pat) {
+    return gen_position_hold(st, tgt_x, tgt_y, tgt_z, pat);
 }
+#endif
 
+#if GEN_USES_EMERGENCY_STOP
 /** GEN_EMERGENCY_STOP (6): Kill velocity, hold current position. */
-static MotorSetpoints gen_emergency_stop(const SensorState* state,
-        const PatternEntry* pat) {
+static SetpointsR gen_emergency_stop(const StateR* st, const PatternEntry* pat) {
     (void)pat;
-    return emergency_hover(state);
+    return emergency_hover(st);
 }
+#endif
 
 /** GEN_IDLE (7): Zero setpoints (motors off). */
-static MotorSetpoints gen_idle(void) {
-    MotorSetpoints sp = {0.0f, 0.0f, 0.0f, 0.0f};
+static SetpointsR gen_idle(void) {
+    SetpointsR sp = {R(0.0f), R(0.0f), R(0.0f), R(0.0f)};
     return sp;
 }
 
+/* -- Pattern lifecycle ------------------------------------------------- */
+
+/** Hook table indexed by GeneratorType. Stateless generators have none. */
+static const GeneratorHooks GEN_HOOKS[GEN_COUNT] = {
+#if GEN_USES_WAYPOINT_SEQUENCE
+    [GEN_WAYPOINT_SEQUENCE] = { waypoint_enter, 0 },
+#endif
+#if GEN_USES_RELATIVE_OFFSET
+    [GEN_RELATIVE_OFFSET]   = { relative_enter, 0 },
+#endif
+#if GEN_USES_ORBIT_CENTER
+    [GEN_ORBIT_CENTER]      = { orbit_enter, 0 },
+#endif
+};
+
+/** Make `next` the active pattern (NULL = none): exit the old generator,
+ *  clear the arena, enter the new one. No-op if already active. */
+static void activate_pattern(uint16_t next_id, const PatternEntry* next,
+        const StateR* st, real_t tgt_x, real_t tgt_y) {
+    const GeneratorHooks* hooks;
+    if (next_id == s_active_id) return;
+
+    if (s_active_pat) {
+        hooks = &GEN_HOOKS[s_active_pat->generator_type % GEN_COUNT];
+        if (hooks->on_exit) hooks->on_exit(&s_gen_state);
+    }
+
+    memset(&s_gen_state, 0, sizeof(s_gen_state));
+    s_active_id  = next_id;
+    s_active_pat = next;
+
+    if (next) {
+        hooks = &GEN_HOOKS[next->generator_type % GEN_COUNT];
+        if (hooks->on_enter) hooks->on_enter(&s_gen_state, st, tgt_x, tgt_y, next);
+    }
+}
+
 /* -- Public API --------------------------------------------------------- */
 
 void pattern_executor_init(void) {
+    memset(&s_gen_state, 0, sizeof(s_gen_state));
+    s_active_id  = NO_ACTIVE_PATTERN;
+    s_active_pat = (const PatternEntry*)0;
+    memset(&s_leader, 0, sizeof(s_leader));
     s_initialized = 1;
 }
 
+void pattern_executor_set_leader(const Vec3* position, const Vec3* velocity) {
+    s_leader.heard = (position != (const Vec3*)0);
+    if (!s_leader.heard) return;
+    s_leader.px = R_FROM_FLOAT(position->x);
+    s_leader.py = R_FROM_FLOAT(position->y);
+    s_leader.pz = R_FROM_FLOAT(position->z);
+    s_leader.vx = velocity ? R_FROM_FLOAT(velocity->x) : R(0.0f);
+    s_leader.vy = velocity ? R_FROM_FLOAT(velocity->y) : R(0.0f);
+#ifdef SESHAT_FIXED_POINT
+    s_leader.px = clampr(s_leader.px, -SENSOR_LIMIT, SENSOR_LIMIT);
+    s_leader.py = clampr(s_leader.py, -SENSOR_LIMIT, SENSOR_LIMIT);
+    s_leader.pz = clampr(s_leader.pz, -SENSOR_LIMIT, SENSOR_LIMIT);
+    s_leader.vx = clampr(s_leader.vx, -SENSOR_LIMIT, SENSOR_LIMIT);
+    s_leader.vy = clampr(s_leader.vy, -SENSOR_LIMIT, SENSOR_LIMIT);
+#endif
+}
+
+uint16_t pattern_executor_active_pattern(void) {
+    return s_active_id;
+}
+
 MotorSetpoints pattern_executor_step(const GroundCommand* cmd,
                                      const SensorState* state) {
     const PatternEntry* pat;
-    MotorSetpoints sp;
-    float tgt_x, tgt_y, tgt_z, tgt_vx, tgt_vy;
+    StateR st;
+    SetpointsR sp;
+    real_t tgt_x, tgt_y, tgt_z;
+#if GEN_USES_VELOCITY_TRACK
+    real_t tgt_vx, tgt_vy;
+#endif
 
-    if (!s_initialized) return gen_idle();
-    if (cmd->flags & CMD_FLAG_EMERGENCY) return emergency_hover(state);
+    if (!s_initialized) return to_motor_setpoints(gen_idle());
+    ingest_state(state, &st);
+    if (cmd->flags & CMD_FLAG_EMERGENCY) {
+        activate_pattern(NO_ACTIVE_PATTERN, (const PatternEntry*)0, &st, R(0.0f), R(0.0f));
+        return to_motor_setpoints(emergency_hover(&st));
+    }
 
+    PERF_PROBE_BEGIN(t_lookup);
     pat = catalog_lookup(cmd->pattern_id);
-    if (!pat) return emergency_hover(state);
+    PERF_PROBE_END(PROBE_CATALOG_LOOKUP, t_lookup);
+    if (!pat) {
+        activate_pattern(NO_ACTIVE_PATTERN, (const PatternEntry*)0, &st, R(0.0f), R(0.0f));
+        return to_motor_setpoints(emergency_hover(&st));
+    }
 
     /* Decode float16 targets from ground command. */
-    tgt_x  = mm_to_float(cmd->target_pos_x);
-    tgt_y  = mm_to_float(cmd->target_pos_y);
-    tgt_z  = mm_to_float(cmd->target_pos_z);
-    tgt_vx = mm_to_float(cmd->target_vel_x);
-    tgt_vy = mm_to_float(cmd->target_vel_y);
+    tgt_x  = R_FROM_MM(cmd->target_pos_x);
+    tgt_y  = R_FROM_MM(cmd->target_pos_y);
+    tgt_z  = R_FROM_MM(cmd->target_pos_z);
+#if GEN_USES_VELOCITY_TRACK
+    tgt_vx = R_FROM_MM(cmd->target_vel_x);
+    tgt_vy = R_FROM_MM(cmd->target_vel_y);
+#endif
+
+    activate_pattern(cmd->pattern_id, pat, &st, tgt_x, tgt_y);
 
+    PERF_PROBE_BEGIN(t_gen);
+    /* Only generators the catalog references are dispatched; anything
+     * else falls through to emergency hover. */
     switch ((GeneratorType)pat->generator_type) {
+#if GEN_USES_POSITION_HOLD
     case GEN_POSITION_HOLD:
-        sp = gen_position_hold(state, tgt_x, tgt_y, tgt_z, pat);       break;
+        sp = gen_position_hold(&st, tgt_x, tgt_y, tgt_z, pat);         break;
+#endif
+#if GEN_USES_VELOCITY_TRACK
     case GEN_VELOCITY_TRACK:
-        sp = gen_velocity_track(state, tgt_vx, tgt_vy, tgt_z, pat);    break;
+        sp = gen_velocity_track(&st, tgt_vx, tgt_vy, tgt_z, pat);      break;
+#endif
+#if GEN_USES_WAYPOINT_SEQUENCE
     case GEN_WAYPOINT_SEQUENCE:
-        sp = gen_waypoint_sequence(state, tgt_x, tgt_y, tgt_z, pat);   break;
+        sp = gen_waypoint_sequence(&s_gen_state, &st,
+                                   tgt_x, tgt_y, tgt_z, pat);           break;
+#endif
+#if GEN_USES_RELATIVE_OFFSET
     case GEN_RELATIVE_OFFSET:
-        sp = gen_relative_offset(state, tgt_x, tgt_y, tgt_z, pat);     break;
+        sp = (cmd->flags & CMD_FLAG_LEADER_RELATIVE)
+           ? gen_leader_offset(&s_gen_state, &st, tgt_x, tgt_y, tgt_z, pat)
+           : gen_relative_offset(&st, tgt_x, tgt_y, tgt_z, pat);       break;
+#endif
+#if GEN_USES_ORBIT_CENTER
     case GEN_ORBIT_CENTER:
-        sp = gen_orbit_center(state, tgt_x, tgt_y, tgt_z, pat);        break;
+        sp = gen_orbit_center(&s_gen_state, &st, tgt_x, tgt_y, tgt_z); break;
+#endif
+#if GEN_USES_TRAJECTORY_SPLINE
     case GEN_TRAJECTORY_SPLINE:
-        sp = gen_trajectory_spline(state, tgt_x, tgt_y, tgt_z, pat);   break;
+        sp = gen_trajectory_spline(&st, tgt_x, tgt_y, tgt_z, pat);     break;
+#endif
+#if GEN_USES_EMERGENCY_STOP
     case GEN_EMERGENCY_STOP:
-        sp = gen_emergency_stop(state, pat);                            break;
+        sp = gen_emergency_stop(&st, pat);                              break;
+#endif
+#if GEN_USES_IDLE
     case GEN_IDLE:
         sp = gen_idle();                                                break;
+#endif
     default:
-        sp = emergency_hover(state);                                    break;
+        sp = emergency_hover(&st);                                      break;
     }
+    PERF_PROBE_END(PROBE_GENERATOR(pat->generator_type), t_gen);
 
-    return clamp_setpoints(sp);
+    return to_motor_setpoints(clamp_setpoints(sp));
 }
@@ -13,6 +13,10 @@
  *   // In the control loop (500 Hz on Crazyflie):
  *   MotorSetpoints sp = pattern_executor_step(&cmd, &sensor);
  *   // Feed sp.roll, sp.pitch, sp.yaw, sp.thrust to attitude controller
+ *
+ * Build with -DSESHAT_FIXED_POINT for targets without a single-precision
+ * FPU: generator math then runs in Q16.16 (fixed_point.h). The interface,
+ * the catalog and the radio wire format are identical in both builds.
  */
 
 #ifndef SESHAT_SWARM_PATTERN_EXECUTOR_H
@@ -26,6 +30,24 @@
  */
 void pattern_executor_init(void);
 
+/**
+ * Pattern currently owning the generator state arena, or 0xFFFF if none
+ * (before the first step, after an emergency command or an invalid ID).
+ */
+uint16_t pattern_executor_active_pattern(void);
+
+/**
+ * Supply the leader's state for CMD_FLAG_LEADER_RELATIVE commands, once
+ * per step before pattern_executor_step(). `position` NULL means the
+ * leader is not being heard; `velocity` NULL means unknown (zero).
+ *
+ * Typically from the P2P neighbor table, dead-reckoned to now:
+ *   Vec3 lp, lv;
+ *   int heard = neighbor_table_predict(cmd.leader_id, now_us(), &lp, &lv);
+ *   pattern_executor_set_leader(heard ? &lp : NULL, &lv);
+ */
+void pattern_executor_set_leader(const Vec3* position, const Vec3* velocity);
+
 /**
  * Execute one step of the behavioral pattern.
  *
@@ -36,6 +58,15 @@ void pattern_executor_init(void);
  *
  * If the pattern_id is invalid or the generator type is unknown, the executor
  * falls back to emergency hover at the drone's current position.
+ *
+ * A change of pattern_id re-initializes the generator state: the previous
+ * generator's exit hook runs, then the new generator's entry hook.
+ *
+ * With CMD_FLAG_LEADER_RELATIVE, GEN_RELATIVE_OFFSET holds at the leader's
+ * position + target_pos + the catalog offset and feeds the leader's
+ * velocity forward, so a formation follows its leader with no per-tick
+ * uplink. While the leader is not heard it holds the last such target
+ * (its own position if the leader was never heard).
  */
 MotorSetpoints pattern_executor_step(const GroundCommand* cmd,
                                      const SensorState* state);
@@ -0,0 +1,108 @@
+/**
+ * Seshat Swarm — Per-Pattern Usage Statistics Implementation
+ *
+ * Time and energy accumulate in 64-bit µs / µJ so a long flight neither
+ * overflows nor loses small steps to rounding; peaks keep the squared
+ * speed so the step needs no sqrt. Everything is scaled to the packet's
+ * units only when packed.
+ *
+ * Target: STM32F405 (Crazyflie 2.1+), arm-none-eabi-gcc.
+ */
+
+#include "pattern_stats.h"
+#include "telemetry_reporter.h"  /* PATTERN_ID_INVALID */
+#include <math.h>    /* sqrtf, fabsf */
+#include <string.h>  /* memset */
+
+/* -----------------------------------------------------------------------
+ * State
+ * ----------------------------------------------------------------------- */
+
+typedef struct {
+    uint64_t time_us;
+    uint64_t energy_uj;
+    float    peak_speed_sq;
+    float    peak_attitude;    /* Degrees */
+    uint16_t entries;
+} PatternStats;
+
+static PatternStats s_stats[PATTERN_STATS_CAPACITY];
+static uint16_t s_current = PATTERN_ID_INVALID;
+static uint16_t s_next = 0;
+
+/* -----------------------------------------------------------------------
+ * Internal helpers
+ * ----------------------------------------------------------------------- */
+
+static uint32_t saturate_u32(uint64_t v) {
+    return v > 0xFFFFFFFFu ? 0xFFFFFFFFu : (uint32_t)v;
+}
+
+static uint16_t saturate_u16(float v) {
+    if (!(v > 0.0f)) return 0;
+    return v >= 65535.0f ? 65535u : (uint16_t)(v + 0.5f);
+}
+
+/* -----------------------------------------------------------------------
+ * Public API
+ * ----------------------------------------------------------------------- */
+
+void pattern_stats_init(void) {
+    memset(s_stats, 0, sizeof(s_stats));
+    s_current = PATTERN_ID_INVALID;
+    s_next = 0;
+}
+
+void pattern_stats_step(uint16_t pattern_id, const SensorState* state,
+                        const MotorSetpoints* sp, uint32_t dt_us) {
+    PatternStats* st;
+    const Vec3* v = &state->velocity;
+    float speed_sq = v->x * v->x + v->y * v->y + v->z * v->z;
+    float roll = fabsf(sp->roll);
+    float pitch = fabsf(sp->pitch);
+    float attitude = roll > pitch ? roll : pitch;
+
+    if (pattern_id != s_current) {
+        s_current = pattern_id;
+        if (pattern_id < PATTERN_STATS_CAPACITY && s_stats[pattern_id].entries != 0xFFFFu) {
+            s_stats[pattern_id].entries++;
+        }
+    }
+    if (pattern_id >= PATTERN_STATS_CAPACITY) return;
+    st = &s_stats[pattern_id];
+
+    st->time_us += dt_us;
+    if (state->discharge_rate > 0.0f) {
+        st->energy_uj += (uint64_t)(state->discharge_rate * (float)dt_us);
+    }
+    if (speed_sq > st->peak_speed_sq) st->peak_speed_sq = speed_sq;
+    if (attitude > st->peak_attitude) st->peak_attitude = attitude;
+}
+
+int pattern_stats_pack(uint16_t pattern_id, PatternStatsPacket* out) {
+    const PatternStats* st;
+
+    if (pattern_id >= PATTERN_STATS_CAPACITY || out == NULL) return 0;
+    st = &s_stats[pattern_id];
+    if (st->time_us == 0) return 0;
+
+    out->kind = EXT_PACKET_PATTERN_STATS;
+    out->_pad = 0;
+    out->pattern_id = pattern_id;
+    out->entries = st->entries;
+    out->time_ms = saturate_u32(st->time_us / 1000u);
+    out->energy_mj = saturate_u32(st->energy_uj / 1000u);
+    out->peak_speed_mms = saturate_u16(sqrtf(st->peak_speed_sq) * 1000.0f);
+    out->peak_attitude_cdeg = saturate_u16(st->peak_attitude * 100.0f);
+    return 1;
+}
+
+int pattern_stats_next_packet(PatternStatsPacket* out) {
+    uint16_t tried;
+    for (tried = 0; tried < PATTERN_STATS_CAPACITY; tried++) {
+        uint16_t id = s_next;
+        s_next = (uint16_t)((s_next + 1u) % PATTERN_STATS_CAPACITY);
+        if (pattern_stats_pack(id, out)) return 1;
+    }
+    return 0;
+}
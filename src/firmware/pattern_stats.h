@@ -0,0 +1,62 @@
+/**
+ * Seshat Swarm — Per-Pattern Usage Statistics
+ *
+ * Measures, in flight, what each pattern's catalog verification block
+ * claims: how much power it draws (energy_rate_js), how fast it flies
+ * (max_velocity_ms) and how hard it tilts (max_acceleration_ms2, via
+ * g·tan θ). Per pattern ID it accumulates entries, time, energy, peak
+ * speed and peak roll/pitch command.
+ *
+ * One pattern_stats_step() per control-loop step: a table index, two
+ * adds and two compares, no history. pattern_stats_next_packet() dumps
+ * one pattern per call, round-robin, for a low-rate radio channel; the
+ * ground turns fleet dumps into catalog updates with
+ * scripts/merge-pattern-stats.ts.
+ *
+ * Usage:
+ *   pattern_stats_init();
+ *   // Control loop:
+ *   sp = pattern_executor_step(&cmd, &sensor, now);
+ *   pattern_stats_step(pattern_executor_active_pattern(), &sensor, &sp, LOOP_US);
+ *   // At the diagnostics rate:
+ *   PatternStatsPacket pkt;
+ *   if (pattern_stats_next_packet(&pkt)) radio_send_ext(&pkt, sizeof(pkt));
+ *
+ * Target: STM32F405 (Crazyflie 2.1+), arm-none-eabi-gcc.
+ */
+
+#ifndef SESHAT_SWARM_PATTERN_STATS_H
+#define SESHAT_SWARM_PATTERN_STATS_H
+
+#include "types.h"
+
+/** Pattern IDs tracked (0..N-1); higher IDs are not counted. */
+#ifndef PATTERN_STATS_CAPACITY
+#define PATTERN_STATS_CAPACITY 256u
+#endif
+
+/** Clear all statistics. */
+void pattern_stats_init(void);
+
+/**
+ * Account one control-loop step of `dt_us` spent in `pattern_id`.
+ * PATTERN_ID_INVALID (no pattern) is not counted.
+ */
+void pattern_stats_step(uint16_t pattern_id, const SensorState* state,
+                        const MotorSetpoints* sp, uint32_t dt_us);
+
+/**
+ * Pack the statistics for one pattern.
+ *
+ * @return 1 if the pattern has been flown and `out` was filled, 0 otherwise.
+ */
+int pattern_stats_pack(uint16_t pattern_id, PatternStatsPacket* out);
+
+/**
+ * Pack the next pattern that has been flown, round-robin across calls.
+ *
+ * @return 1 if `out` was filled, 0 if no pattern has been flown.
+ */
+int pattern_stats_next_packet(PatternStatsPacket* out);
+
+#endif /* SESHAT_SWARM_PATTERN_STATS_H */
@@ -0,0 +1,163 @@
+/**
+ * Seshat Swarm — Control-Path Performance Probes Implementation
+ *
+ * Statistics live in a static table (no heap): one ProbeStats per probe,
+ * updated in perf_probe_record() from the control loop. Recording is a
+ * handful of integer ops plus a short bit-length loop for the histogram
+ * bucket, so a probe costs tens of cycles.
+ *
+ * With SESHAT_PERF_PROBES undefined the file compiles to stubs, so the
+ * build does not need to drop it from the source list.
+ *
+ * Target: STM32F405 (Crazyflie 2.1+), arm-none-eabi-gcc; POSIX hosts.
+ */
+
+#include "perf_probes.h"
+#include <string.h>  /* memset */
+
+#ifdef SESHAT_PERF_PROBES
+
+/* -----------------------------------------------------------------------
+ * Tick source
+ * ----------------------------------------------------------------------- */
+
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__)
+
+#ifndef PERF_CORE_MHZ
+#define PERF_CORE_MHZ 168u            /* STM32F405 SYSCLK */
+#endif
+#define PERF_TICKS_PER_US PERF_CORE_MHZ
+
+#define DEMCR       (*(volatile uint32_t*)0xE000EDFCu)
+#define DWT_CTRL    (*(volatile uint32_t*)0xE0001000u)
+#define DWT_CYCCNT  (*(volatile uint32_t*)0xE0001004u)
+#define DEMCR_TRCENA       (1u << 24)
+#define DWT_CTRL_CYCCNTENA (1u << 0)
+
+static void tick_source_init(void) {
+    DEMCR |= DEMCR_TRCENA;
+    DWT_CYCCNT = 0;
+    DWT_CTRL |= DWT_CTRL_CYCCNTENA;
+}
+
+uint32_t perf_probe_now(void) {
+    return DWT_CYCCNT;
+}
+
+#elif defined(__unix__) || defined(__APPLE__)
+
+#include <time.h>
+
+#define PERF_TICKS_PER_US 1000u       /* Nanoseconds */
+
+static void tick_source_init(void) {
+}
+
+uint32_t perf_probe_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    /* Wraps every ~4.3 s; durations are taken modulo 2^32. */
+    return (uint32_t)ts.tv_sec * 1000000000u + (uint32_t)ts.tv_nsec;
+}
+
+#else
+#error "SESHAT_PERF_PROBES: no cycle counter for this target"
+#endif
+
+/* -----------------------------------------------------------------------
+ * Statistics
+ * ----------------------------------------------------------------------- */
+
+typedef struct {
+    uint32_t count;
+    uint32_t min_ticks;
+    uint32_t max_ticks;
+    uint64_t sum_ticks;
+    uint32_t histogram[DIAG_HIST_BUCKETS];
+} ProbeStats;
+
+static ProbeStats s_stats[PROBE_COUNT];
+static uint8_t s_next_probe = 0;
+
+/** Bucket i holds ticks < 256 << 2i: i = ceil((log2(ticks+1) - 8) / 2). */
+static uint8_t histogram_bucket(uint32_t ticks) {
+    uint8_t bits = 0;
+    uint8_t bucket;
+    while (bits < 32 && (ticks >> bits) != 0) bits++;
+    if (bits <= 8) return 0;
+    bucket = (uint8_t)((bits - 8 + 1) / 2);
+    return bucket < DIAG_HIST_BUCKETS ? bucket : DIAG_HIST_BUCKETS - 1;
+}
+
+void perf_probe_record(PerfProbeId id, uint32_t ticks) {
+    ProbeStats* st;
+    if ((unsigned)id >= PROBE_COUNT) return;
+    st = &s_stats[id];
+    if (st->count == 0 || ticks < st->min_ticks) st->min_ticks = ticks;
+    if (ticks > st->max_ticks) st->max_ticks = ticks;
+    if (st->count != UINT32_MAX) st->count++;
+    st->sum_ticks += ticks;
+    st->histogram[histogram_bucket(ticks)]++;
+}
+
+void perf_probes_init(void) {
+    tick_source_init();
+    perf_probes_reset();
+}
+
+void perf_probes_reset(void) {
+    memset(s_stats, 0, sizeof(s_stats));
+    s_next_probe = 0;
+}
+
+int perf_probes_pack(PerfProbeId id, DiagnosticsPacket* out) {
+    const ProbeStats* st;
+    uint8_t i;
+    if ((unsigned)id >= PROBE_COUNT || out == NULL) return 0;
+    st = &s_stats[id];
+    if (st->count == 0) return 0;
+
+    out->kind = EXT_PACKET_DIAGNOSTICS;
+    out->probe_id = (uint8_t)id;
+    out->ticks_per_us = (uint16_t)PERF_TICKS_PER_US;
+    out->count = st->count;
+    out->min_ticks = st->min_ticks;
+    out->max_ticks = st->max_ticks;
+    out->mean_ticks = (uint32_t)(st->sum_ticks / st->count);
+    for (i = 0; i < DIAG_HIST_BUCKETS; i++) {
+        out->histogram[i] = (uint8_t)(((uint64_t)st->histogram[i] * 255u
+                                       + st->count / 2u) / st->count);
+    }
+    return 1;
+}
+
+int perf_probes_next_packet(DiagnosticsPacket* out) {
+    uint8_t tried;
+    for (tried = 0; tried < PROBE_COUNT; tried++) {
+        PerfProbeId id = (PerfProbeId)s_next_probe;
+        s_next_probe = (uint8_t)((s_next_probe + 1u) % PROBE_COUNT);
+        if (perf_probes_pack(id, out)) return 1;
+    }
+    return 0;
+}
+
+#else /* !SESHAT_PERF_PROBES */
+
+void perf_probes_init(void) {
+}
+
+void perf_probes_reset(void) {
+}
+
+int perf_probes_pack(PerfProbeId id, DiagnosticsPacket* out) {
+    (void)id;
+    (void)out;
+    return 0;
+}
+
+int perf_probes_next_packet(DiagnosticsPacket* out) {
+    (void)out;
+    return 0;
+}
+
+#endif /* SESHAT_PERF_PROBES */
@@ -0,0 +1,86 @@
+/**
+ * Seshat Swarm — Control-Path Performance Probes
+ *
+ * Compile-time-optional timing probes around the behavioral layer's hot
+ * spots: command parse, catalog lookup, each generator, telemetry pack.
+ * Build with -DSESHAT_PERF_PROBES to enable; otherwise the probe macros
+ * expand to nothing and the query functions report no samples.
+ *
+ * Tick source:
+ *   Cortex-M3/M4/M33  DWT cycle counter (CYCCNT), PERF_CORE_MHZ ticks/µs
+ *   Host (POSIX)      clock_gettime(CLOCK_MONOTONIC), 1000 ticks/µs (ns)
+ *
+ * Each probe keeps min/max/mean and a coarse 4x-per-bucket histogram.
+ * perf_probes_next_packet() packs one probe per call, round-robin, into a
+ * DiagnosticsPacket for the periodic diagnostics channel.
+ *
+ * Usage:
+ *   perf_probes_init();
+ *   PERF_PROBE_BEGIN(t0);
+ *   ... work ...
+ *   PERF_PROBE_END(PROBE_CATALOG_LOOKUP, t0);
+ *   // At the diagnostics rate (e.g. 5 Hz):
+ *   DiagnosticsPacket pkt;
+ *   if (perf_probes_next_packet(&pkt)) radio_send_ext(&pkt, sizeof(pkt));
+ */
+
+#ifndef SESHAT_SWARM_PERF_PROBES_H
+#define SESHAT_SWARM_PERF_PROBES_H
+
+#include "types.h"
+
+/**
+ * Probe identifiers. Must stay in sync with PERF_PROBE_NAMES in
+ * src/coordinator/comms.ts.
+ */
+typedef enum {
+    PROBE_COMMAND_PARSE    = 0,
+    PROBE_CATALOG_LOOKUP   = 1,
+    PROBE_TELEMETRY_PACK   = 2,
+    PROBE_GENERATOR_BASE   = 3,   /* + GeneratorType, GEN_COUNT probes */
+    PROBE_COUNT            = PROBE_GENERATOR_BASE + GEN_COUNT
+} PerfProbeId;
+
+#define PROBE_GENERATOR(gen_type) \
+    ((PerfProbeId)(PROBE_GENERATOR_BASE + ((gen_type) % GEN_COUNT)))
+
+#ifdef SESHAT_PERF_PROBES
+
+uint32_t perf_probe_now(void);
+void perf_probe_record(PerfProbeId id, uint32_t ticks);
+
+#define PERF_PROBE_BEGIN(t)    uint32_t t = perf_probe_now()
+#define PERF_PROBE_END(id, t)  perf_probe_record((id), perf_probe_now() - (t))
+
+#else
+
+#define PERF_PROBE_BEGIN(t)    ((void)0)
+#define PERF_PROBE_END(id, t)  ((void)0)
+
+#endif /* SESHAT_PERF_PROBES */
+
+/**
+ * Start the tick source and clear all statistics. Call once at boot,
+ * before the first probe runs. No-op when probes are compiled out.
+ */
+void perf_probes_init(void);
+
+/** Clear all statistics (e.g. after the ground has read a full cycle). */
+void perf_probes_reset(void);
+
+/**
+ * Pack the statistics for one probe.
+ *
+ * @return 1 if the probe has samples and `out` was filled, 0 otherwise
+ *         (unknown probe, no samples, or probes compiled out).
+ */
+int perf_probes_pack(PerfProbeId id, DiagnosticsPacket* out);
+
+/**
+ * Pack the next probe with samples, round-robin across calls.
+ *
+ * @return 1 if `out` was filled, 0 if no probe has samples.
+ */
+int perf_probes_next_packet(DiagnosticsPacket* out);
+
+#endif /* SESHAT_SWARM_PERF_PROBES_H */
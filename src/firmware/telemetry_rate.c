@@ -0,0 +1,77 @@
+/**
+ * Seshat Swarm — Motion-Adaptive Telemetry Rate Implementation
+ *
+ * Keeps a copy of what the ground last received (position, flags,
+ * pattern) and compares squared distances against squared thresholds, so
+ * a poll is a few multiplies and no sqrt.
+ *
+ * Target: STM32F405 (Crazyflie 2.1+), arm-none-eabi-gcc.
+ */
+
+#include "telemetry_rate.h"
+#include "telemetry_reporter.h"
+
+/* -----------------------------------------------------------------------
+ * State
+ * ----------------------------------------------------------------------- */
+
+static const TelemetryRateConfig s_defaults = TELEMETRY_RATE_DEFAULTS;
+
+static struct {
+    TelemetryRateConfig cfg;
+    float    moving_speed_sq;
+    float    max_error_sq;
+    uint8_t  have_sent;
+    uint32_t last_sent_us;
+    Vec3     last_pos;
+    uint8_t  last_flags;
+    uint16_t last_pattern;
+} s_rate;
+
+/* -----------------------------------------------------------------------
+ * Public API
+ * ----------------------------------------------------------------------- */
+
+void telemetry_rate_init(const TelemetryRateConfig* cfg) {
+    uint32_t keepalive_ms;
+
+    s_rate.cfg = cfg ? *cfg : s_defaults;
+    s_rate.moving_speed_sq = s_rate.cfg.moving_speed * s_rate.cfg.moving_speed;
+    s_rate.max_error_sq = s_rate.cfg.max_position_error * s_rate.cfg.max_position_error;
+    s_rate.have_sent = 0;
+
+    keepalive_ms = s_rate.cfg.keepalive_us / 1000u;
+    telemetry_set_max_interval_ms(keepalive_ms > 0xFFFFu ? 0xFFFFu : (uint16_t)keepalive_ms);
+}
+
+int telemetry_rate_poll(uint32_t now_us, const SensorState* state,
+                        uint8_t status_flags, uint16_t pattern_id) {
+    uint32_t elapsed = now_us - s_rate.last_sent_us;
+    int send;
+
+    if (!s_rate.have_sent || elapsed >= s_rate.cfg.keepalive_us) {
+        send = 1;
+    } else if (elapsed < s_rate.cfg.min_interval_us) {
+        send = 0;
+    } else if (status_flags != s_rate.last_flags || pattern_id != s_rate.last_pattern) {
+        send = 1;
+    } else {
+        const Vec3* v = &state->velocity;
+        float dx = state->position.x - s_rate.last_pos.x;
+        float dy = state->position.y - s_rate.last_pos.y;
+        float dz = state->position.z - s_rate.last_pos.z;
+        float speed_sq = v->x * v->x + v->y * v->y + v->z * v->z;
+        float error_sq = dx * dx + dy * dy + dz * dz;
+        /* NaN compares false: a broken estimate falls to the keepalive. */
+        send = speed_sq > s_rate.moving_speed_sq || error_sq > s_rate.max_error_sq;
+    }
+
+    if (send) {
+        s_rate.have_sent = 1;
+        s_rate.last_sent_us = now_us;
+        s_rate.last_pos = state->position;
+        s_rate.last_flags = status_flags;
+        s_rate.last_pattern = pattern_id;
+    }
+    return send;
+}
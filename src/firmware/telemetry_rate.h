@@ -0,0 +1,59 @@
+/**
+ * Seshat Swarm — Motion-Adaptive Telemetry Rate
+ *
+ * Decides, each control-loop step, whether to send a TelemetryPacket.
+ * A drone that is moving, has drifted from the position the ground last
+ * saw, or has changed flags or pattern reports at the fast rate; one that
+ * sits still with stable flags falls back to a keepalive. Downlink load
+ * then scales with swarm activity rather than swarm size.
+ *
+ * Send now if at least min_interval has passed since the last packet and
+ *   - |velocity| > moving_speed, or
+ *   - |position − last sent position| > max_position_error, or
+ *   - status flags or pattern ID changed since the last packet,
+ * or if keepalive has passed regardless.
+ *
+ * The keepalive period is advertised to the ground in the
+ * TELEM_EXT_DISCHARGE slot, so the coordinator can size each drone's
+ * staleness timeout.
+ *
+ * Usage:
+ *   telemetry_rate_init(NULL);                   // Defaults
+ *   // Control loop:
+ *   flags = telemetry_build_flags(&sensor, id);
+ *   if (telemetry_rate_poll(now_us(), &sensor, flags, id)) {
+ *       telemetry_pack(&sensor, id, flags, &pkt);
+ *       radio_send(&pkt);
+ *   }
+ *
+ * Target: STM32F405 (Crazyflie 2.1+), arm-none-eabi-gcc.
+ */
+
+#ifndef SESHAT_SWARM_TELEMETRY_RATE_H
+#define SESHAT_SWARM_TELEMETRY_RATE_H
+
+#include "types.h"
+
+typedef struct {
+    uint32_t min_interval_us;     /* Fast rate; 10 000 = 100 Hz            */
+    uint32_t keepalive_us;        /* Idle rate; 500 000 = 2 Hz (≤ 65 s)    */
+    float    moving_speed;        /* m/s above which the drone is moving   */
+    float    max_position_error;  /* m the ground's view may lag by        */
+} TelemetryRateConfig;
+
+#define TELEMETRY_RATE_DEFAULTS { 10000u, 500000u, 0.05f, 0.02f }
+
+/**
+ * Configure the scheduler (NULL for TELEMETRY_RATE_DEFAULTS). The next
+ * poll always sends.
+ */
+void telemetry_rate_init(const TelemetryRateConfig* cfg);
+
+/**
+ * Whether to send a packet now. When it returns 1 the caller must send;
+ * the scheduler records the sent state as the ground's new view.
+ */
+int telemetry_rate_poll(uint32_t now_us, const SensorState* state,
+                        uint8_t status_flags, uint16_t pattern_id);
+
+#endif /* SESHAT_SWARM_TELEMETRY_RATE_H */
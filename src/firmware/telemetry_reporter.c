@@ -2,7 +2,7 @@
  * Seshat Swarm — Telemetry Reporter Implementation
  *
  * Packs the drone's current SensorState and active pattern into a
- * compact 18-byte TelemetryPacket for radio uplink to the ground
+ * compact 23-byte TelemetryPacket for radio uplink to the ground
  * station coordinator.
  *
  * The encoding trades precision for bandwidth:
@@ -10,6 +10,9 @@
  *   - Velocity : ±32.767 m/s at 1 mm/s resolution
  *   - Battery  : 0.0–1.0 at 0.5% resolution    (uint8 × 200)
  *   - Quality  : 0.0–1.0 at ~0.4% resolution    (uint8 × 255)
+ *   - Ext slot : orientation at 0.01°, battery at 1 mV, discharge at
+ *                0.01 W, sensor flags exact, flight time left at 1 s —
+ *                one slot per packet
  *
  * This is more than sufficient for indoor Crazyflie operations where
  * the Lighthouse system provides sub-mm positioning.
@@ -18,6 +21,8 @@
  */
 
 #include "telemetry_reporter.h"
+#include "perf_probes.h"
+#include "event_queue.h"
 #include <string.h>  /* memcpy */
 
 /* -----------------------------------------------------------------------
@@ -33,6 +38,40 @@ static inline float clampf(float val, float lo, float hi) {
     return val;
 }
 
+/** Scale and round to int16, clamping to ±32767; NaN maps to -32768. */
+static int16_t scale_i16(float val, float scale) {
+    float x = val * scale;
+    if (x != x) return INT16_MIN;
+    x = clampf(x, -32767.0f, 32767.0f);
+    return (int16_t)(x >= 0.0f ? x + 0.5f : x - 0.5f);
+}
+
+/** Scale and round to uint16, clamping to [0, 65535]; NaN maps to 0. */
+static uint16_t scale_u16(float val, float scale) {
+    float x = val * scale;
+    if (!(x > 0.0f)) return 0;
+    if (x >= 65535.0f) return 65535u;
+    return (uint16_t)(x + 0.5f);
+}
+
+static void put_u16(uint8_t* dst, uint16_t v) {
+    dst[0] = (uint8_t)(v & 0xFFu);
+    dst[1] = (uint8_t)(v >> 8);
+}
+
+#define RAD_TO_CDEG 5729.5779513f   /* 18000 / π */
+
+/** Next ext slot telemetry_pack fills. */
+static uint8_t s_next_ext_slot = 0;
+
+/** Advertised in TELEM_EXT_DISCHARGE (telemetry_rate.h). */
+static uint16_t s_max_interval_ms = 0;
+
+/** Reported in TELEM_EXT_FORECAST (battery_forecast.h). */
+static uint16_t s_forecast_s = 0xFFFFu;
+static uint8_t s_forecast_soc = 0;
+static uint8_t s_forecast_resistance = 0;
+
 /* -----------------------------------------------------------------------
  * telemetry_pack
  * ----------------------------------------------------------------------- */
@@ -43,6 +82,8 @@ void telemetry_pack(
     uint8_t status_flags,
     TelemetryPacket* out)
 {
+    PERF_PROBE_BEGIN(t0);
+
     /* Position: float meters -> int16 millimeters.
      * float_to_mm() (from types.h) clamps to ±32.767m and scales ×1000. */
     out->pos_x = float_to_mm(state->position.x);
@@ -71,8 +112,68 @@ void telemetry_pack(
     float qual_scaled = clampf(state->pos_quality * 255.0f, 0.0f, 255.0f);
     out->pos_quality = (uint8_t)qual_scaled;
 
-    /* Reserved byte — zero for forward compatibility. */
-    out->reserved = 0;
+    /* Health summary is filled in by the caller (health_monitor.h). */
+    out->health = 0;
+
+    /* Low-rate fields: one slot per packet, round-robin. */
+    telemetry_pack_ext(state, s_next_ext_slot, out);
+    s_next_ext_slot = (uint8_t)((s_next_ext_slot + 1u) % TELEM_EXT_SLOT_COUNT);
+
+    PERF_PROBE_END(PROBE_TELEMETRY_PACK, t0);
+}
+
+/* -----------------------------------------------------------------------
+ * telemetry_pack_ext
+ * ----------------------------------------------------------------------- */
+
+void telemetry_pack_ext(
+    const SensorState* state,
+    uint8_t slot,
+    TelemetryPacket* out)
+{
+    uint8_t* ext = out->ext;
+
+    out->ext_slot = slot;
+    switch (slot) {
+    case TELEM_EXT_ATTITUDE:
+        put_u16(&ext[0], (uint16_t)scale_i16(state->orientation.x, RAD_TO_CDEG));
+        put_u16(&ext[2], (uint16_t)scale_i16(state->orientation.y, RAD_TO_CDEG));
+        break;
+    case TELEM_EXT_YAW_POWER:
+        put_u16(&ext[0], (uint16_t)scale_i16(state->orientation.z, RAD_TO_CDEG));
+        put_u16(&ext[2], scale_u16(state->battery_voltage, 1000.0f));
+        break;
+    case TELEM_EXT_DISCHARGE:
+        put_u16(&ext[0], scale_u16(state->discharge_rate, 100.0f));
+        put_u16(&ext[2], s_max_interval_ms);
+        break;
+    case TELEM_EXT_FLAGS:
+        put_u16(&ext[0], (uint16_t)(state->flags & 0xFFFFu));
+        put_u16(&ext[2], (uint16_t)(state->flags >> 16));
+        break;
+    case TELEM_EXT_FORECAST:
+        put_u16(&ext[0], s_forecast_s);
+        ext[2] = s_forecast_soc;
+        ext[3] = s_forecast_resistance;
+        break;
+    default:
+        out->ext_slot = TELEM_EXT_NONE;
+        memset(ext, 0, sizeof(out->ext));
+        break;
+    }
+}
+
+void telemetry_set_max_interval_ms(uint16_t ms)
+{
+    s_max_interval_ms = ms;
+}
+
+void telemetry_set_forecast(uint16_t remaining_s, uint8_t soc_x200,
+                            uint8_t resistance_4mohm)
+{
+    s_forecast_s = remaining_s;
+    s_forecast_soc = soc_x200;
+    s_forecast_resistance = resistance_4mohm;
 }
 
 /* -----------------------------------------------------------------------
@@ -84,7 +185,7 @@ uint16_t telemetry_serialize(
     uint8_t* buf,
     uint16_t buf_len)
 {
-    /* Guard: caller must provide at least 18 bytes. */
+    /* Guard: caller must provide at least TELEMETRY_PACKET_SIZE bytes. */
     if (buf_len < TELEMETRY_PACKET_SIZE) {
         return 0;
     }
@@ -139,5 +240,9 @@ uint8_t telemetry_build_flags(
      * round-trip acknowledgments.  The radio layer ORs this flag in
      * before the packet is queued for transmission. */
 
+    /* EMERGENCY / LOW_BATTERY transitions go out as priority events
+     * rather than waiting for the next routine packet. */
+    event_queue_note_flags(flags, state, current_pattern_id);
+
     return flags;
 }
@@ -1,7 +1,7 @@
 /**
  * Seshat Swarm — Telemetry Reporter
  *
- * Serializes onboard SensorState + pattern info into an 18-byte
+ * Serializes onboard SensorState + pattern info into a 23-byte
  * TelemetryPacket for radio uplink to the ground station.
  *
  * Encoding summary (matches TelemetryPacket in types.h):
@@ -11,7 +11,11 @@
  *   pos_quality  : float 0.0-1.0 -> uint8 0-255        (x255)
  *   pattern_id   : uint16        -> direct copy
  *   status_flags : uint8         -> direct copy
- *   reserved     : uint8         -> 0
+ *   health       : uint8         -> 0 (caller sets it from
+ *                                    health_monitor_take_status())
+ *   ext_slot/ext : one rotating TELEM_EXT_* slot per packet carrying
+ *                  orientation, battery voltage, discharge rate and the
+ *                  full SensorState.flags (see types.h)
  *
  * Target: STM32F405 (Crazyflie 2.1+), arm-none-eabi-gcc.
  */
@@ -25,7 +29,7 @@
 #define PATTERN_ID_INVALID  0xFFFFu
 
 /** Size of a serialized TelemetryPacket in bytes. */
-#define TELEMETRY_PACKET_SIZE  18u
+#define TELEMETRY_PACKET_SIZE  23u
 
 /* -----------------------------------------------------------------------
  * Public API
@@ -40,6 +44,10 @@
  *   - Battery: float 0.0-1.0 -> uint8 0-200
  *   - Position quality: float 0.0-1.0 -> uint8 0-255
  *
+ * Each call also fills the next multiplexed ext slot, round-robin over
+ * TELEM_EXT_SLOT_COUNT, so every slot is refreshed at 1/5 of the packet
+ * rate.
+ *
  * @param state              Current sensor readings.
  * @param current_pattern_id Pattern currently being executed, or
  *                           PATTERN_ID_INVALID if none.
@@ -53,18 +61,43 @@ void telemetry_pack(
     TelemetryPacket* out
 );
 
+/**
+ * Fill one multiplexed ext slot (TELEM_EXT_*) of a packed TelemetryPacket,
+ * replacing the slot telemetry_pack chose. For callers that schedule the
+ * low-rate fields themselves.
+ */
+void telemetry_pack_ext(
+    const SensorState* state,
+    uint8_t slot,
+    TelemetryPacket* out
+);
+
+/**
+ * Advertise the longest gap between telemetry packets (ms) in the
+ * TELEM_EXT_DISCHARGE slot. Set by telemetry_rate_init(); 0 (the default)
+ * means a fixed rate.
+ */
+void telemetry_set_max_interval_ms(uint16_t ms);
+
+/**
+ * Set the TELEM_EXT_FORECAST slot. Called by battery_forecast_update();
+ * until then the slot reports 0xFFFF (unknown) seconds.
+ */
+void telemetry_set_forecast(uint16_t remaining_s, uint8_t soc_x200,
+                            uint8_t resistance_4mohm);
+
 /**
  * Serialize a TelemetryPacket into a raw byte buffer for radio
  * transmission.
  *
  * The packet is already packed (__attribute__((packed))), so this is
  * a straight memcpy.  Buffer must be at least TELEMETRY_PACKET_SIZE
- * (18) bytes.
+ * (23) bytes.
  *
  * @param packet   Packed telemetry data.
  * @param buf      Destination byte buffer (caller-allocated).
  * @param buf_len  Size of buf in bytes.
- * @return         Number of bytes written (18), or 0 if buf_len < 18.
+ * @return         Number of bytes written (23), or 0 if buf_len < 23.
  */
 uint16_t telemetry_serialize(
     const TelemetryPacket* packet,
@@ -84,6 +117,9 @@ uint16_t telemetry_serialize(
  * Note: TELEM_FLAG_COMM_LOST is NOT set here; it is managed by the
  * radio layer which has visibility into link quality.
  *
+ * Also reports the result to event_queue_note_flags(), which turns
+ * EMERGENCY / LOW_BATTERY transitions into priority EventPackets.
+ *
  * @param state              Current sensor readings.
  * @param current_pattern_id Pattern currently being executed.
  * @return                   Assembled TELEM_FLAG_* bitfield.
@@ -180,9 +180,9 @@ typedef struct {
 
 /**
  * Ground station → drone command packet.
- * sizeof: 20 bytes
+ * sizeof: 18 bytes
  *   pattern_id(2) + target_pos(6, float16×3) + target_vel(6, float16×3)
- *   + flags(1) + reserved(5)
+ *   + flags(1) + leader_id(1) + reserved(2)
  *
  * Note: target_pos and target_vel use float16 encoding for radio efficiency.
  * float16 gives ±65m range at ~1mm precision — sufficient for indoor flight.
@@ -196,20 +196,29 @@ typedef struct __attribute__((packed)) {
     int16_t target_vel_y;      /* float16: velocity y (mm/s)            */
     int16_t target_vel_z;      /* float16: velocity z (mm/s)            */
     uint8_t flags;             /* CMD_FLAG_* bitfield                   */
-    uint8_t reserved[3];       /* Pad to 20 bytes, future use           */
+    uint8_t leader_id;         /* P2P ID, with CMD_FLAG_LEADER_RELATIVE */
+    uint8_t reserved[2];       /* Future use                            */
 } GroundCommand;
-/* Static assert: sizeof(GroundCommand) == 20 */
+/* Static assert: sizeof(GroundCommand) == 18 */
 
 /** Command flag bits. */
 #define CMD_FLAG_EMERGENCY    (1u << 0)
 #define CMD_FLAG_STYLE_UPDATE (1u << 1)
 #define CMD_FLAG_FORCE_PATTERN (1u << 2)
+#define CMD_FLAG_HISTORY_FREEZE  (1u << 3)  /* Freeze the history ring  */
+#define CMD_FLAG_HISTORY_RELEASE (1u << 4)  /* Download done, resume    */
+/* target_pos is an offset from leader_id's broadcast position
+ * (GEN_RELATIVE_OFFSET only; see pattern_executor_set_leader). */
+#define CMD_FLAG_LEADER_RELATIVE (1u << 5)
 
 /**
  * Drone → ground station telemetry packet.
- * sizeof: 18 bytes
+ * sizeof: 23 bytes (one radio payload)
  *   pos(6, float16×3) + vel(6, float16×3) + battery(1) + pattern_id(2)
- *   + status(1) + pos_quality(1) + reserved(1)
+ *   + status(1) + pos_quality(1) + health(1) + ext_slot(1) + ext(4)
+ *
+ * ext carries one rotating TELEM_EXT_* slot of low-rate SensorState fields
+ * per packet; the ground reassembles the full state at rate / slot count.
  */
 typedef struct __attribute__((packed)) {
     int16_t pos_x;             /* float16: position x (mm)              */
@@ -222,9 +231,32 @@ typedef struct __attribute__((packed)) {
     uint16_t pattern_id;       /* Currently executing pattern           */
     uint8_t status_flags;      /* TELEM_FLAG_* bitfield                 */
     uint8_t pos_quality;       /* 0–255 → 0.0–1.0 (×255 encoding)      */
-    uint8_t reserved;          /* Pad to 18 bytes, future use           */
+    uint8_t health;            /* HEALTH_STATUS_* summary, 0 = none     */
+    uint8_t ext_slot;          /* TELEM_EXT_* carried in ext            */
+    uint8_t ext[4];            /* Multiplexed low-rate fields           */
 } TelemetryPacket;
-/* Static assert: sizeof(TelemetryPacket) == 18 */
+/* Static assert: sizeof(TelemetryPacket) == 23 */
+
+/**
+ * Multiplexed TelemetryPacket.ext slots (little-endian). int16 fields use
+ * -32768 for NaN and clamp to ±32767, as HistorySample.
+ *   TELEM_EXT_ATTITUDE   int16 roll, int16 pitch (centidegrees)
+ *   TELEM_EXT_YAW_POWER  int16 yaw (centidegrees), uint16 battery (mV)
+ *   TELEM_EXT_DISCHARGE  uint16 discharge rate (W × 100),
+ *                        uint16 max telemetry interval (ms, 0 = fixed rate)
+ *   TELEM_EXT_FLAGS      uint32 SensorState.flags
+ *   TELEM_EXT_FORECAST   uint16 flight seconds left at the current pattern
+ *                        (0xFFFF = not yet known), uint8 resting state of
+ *                        charge (×200), uint8 internal resistance (4 mΩ);
+ *                        see battery_forecast.h
+ */
+#define TELEM_EXT_ATTITUDE    0u
+#define TELEM_EXT_YAW_POWER   1u
+#define TELEM_EXT_DISCHARGE   2u
+#define TELEM_EXT_FLAGS       3u
+#define TELEM_EXT_FORECAST    4u
+#define TELEM_EXT_SLOT_COUNT  5u
+#define TELEM_EXT_NONE        0xFFu
 
 /** Telemetry status flag bits. */
 #define TELEM_FLAG_AIRBORNE      (1u << 0)
@@ -233,6 +265,226 @@ typedef struct __attribute__((packed)) {
 #define TELEM_FLAG_LOW_BATTERY   (1u << 3)
 #define TELEM_FLAG_COMM_LOST     (1u << 4)
 
+/**
+ * TelemetryPacket.health: control-loop health since the previous packet
+ * (see health_monitor.h). Zero means the sender has no health monitor.
+ *   bit 7     HEALTH_STATUS_VALID
+ *   bits 6:4  Command age at use, HEALTH_CMD_AGE_UNIT_MS units, 7 = ≥112 ms
+ *   bits 3:2  Worst inter-step jitter: 0 <1/16, 1 <1/8, 2 <1/4, 3 ≥1/4 period
+ *   bit 1     HEALTH_STATUS_CMD_GAP: a command gap exceeded the limit
+ *   bit 0     HEALTH_STATUS_OVERRUN: a step overran its deadline
+ */
+#define HEALTH_STATUS_OVERRUN    (1u << 0)
+#define HEALTH_STATUS_CMD_GAP    (1u << 1)
+#define HEALTH_JITTER_SHIFT      2
+#define HEALTH_JITTER_MASK       (3u << HEALTH_JITTER_SHIFT)
+#define HEALTH_CMD_AGE_SHIFT     4
+#define HEALTH_CMD_AGE_MASK      (7u << HEALTH_CMD_AGE_SHIFT)
+#define HEALTH_CMD_AGE_UNIT_MS   16u
+#define HEALTH_STATUS_VALID      (1u << 7)
+
+/**
+ * Extended drone → ground packets. Sent on a separate radio channel from
+ * TelemetryPacket, at a lower rate; the first byte tags the kind.
+ */
+#define EXT_PACKET_DIAGNOSTICS   0x01u
+#define EXT_PACKET_HEALTH        0x02u
+#define EXT_PACKET_HISTORY_INFO  0x03u
+#define EXT_PACKET_HISTORY_CHUNK 0x04u
+#define EXT_PACKET_EVENT         0x05u
+#define EXT_PACKET_PATTERN_STATS 0x06u
+
+/** Coarse timing histogram: bucket i counts durations below
+ *  256 << (2*i) ticks (4x per bucket); the last bucket is open-ended. */
+#define DIAG_HIST_BUCKETS 8
+
+/**
+ * Drone → ground timing diagnostics for one perf probe (see perf_probes.h).
+ * sizeof: 28 bytes (fits one 30-byte radio payload)
+ *   kind(1) + probe_id(1) + ticks_per_us(2) + count(4) + min(4) + max(4)
+ *   + mean(4) + histogram(8)
+ */
+typedef struct __attribute__((packed)) {
+    uint8_t kind;              /* EXT_PACKET_DIAGNOSTICS                */
+    uint8_t probe_id;          /* PerfProbeId                           */
+    uint16_t ticks_per_us;     /* Converts the tick fields to µs        */
+    uint32_t count;            /* Samples since the last reset          */
+    uint32_t min_ticks;
+    uint32_t max_ticks;
+    uint32_t mean_ticks;
+    uint8_t histogram[DIAG_HIST_BUCKETS]; /* Share of samples, ×255     */
+} DiagnosticsPacket;
+/* Static assert: sizeof(DiagnosticsPacket) == 28 */
+
+/**
+ * Drone → ground control-loop health report (see health_monitor.h).
+ * Counters are cumulative since boot, so a lost packet loses no events;
+ * the max/mean fields cover the window since the previous report.
+ * sizeof: 24 bytes
+ *   kind(1) + status(1) + period_us(2) + steps(4) + overruns(2)
+ *   + cmd_gaps(2) + 6 × window stats(2)
+ */
+typedef struct __attribute__((packed)) {
+    uint8_t kind;              /* EXT_PACKET_HEALTH                     */
+    uint8_t status;            /* HEALTH_STATUS_* over the window       */
+    uint16_t period_us;        /* Nominal control-loop period           */
+    uint32_t steps;            /* Steps since boot                      */
+    uint16_t overruns;         /* Deadline overruns since boot (sat.)   */
+    uint16_t cmd_gaps;         /* Command gaps since boot (sat.)        */
+    uint16_t jitter_max_us;    /* |interval − period|, window max       */
+    uint16_t jitter_mean_us;
+    uint16_t exec_max_us;      /* Step execution time, window max       */
+    uint16_t cmd_age_max_ms;   /* Command age at use, window max        */
+    uint16_t cmd_age_mean_ms;
+    uint16_t cmd_gap_max_ms;   /* Longest command gap, window           */
+} HealthPacket;
+/* Static assert: sizeof(HealthPacket) == 24 */
+
+/**
+ * One control-loop sample in the onboard history ring (see history_ring.h).
+ * SensorState + MotorSetpoints (72 bytes as floats) quantized to 28 bytes.
+ * Every int16 field uses -32768 for NaN; finite values clamp to ±32767.
+ *   pos(6, mm) + vel(6, mm/s) + orientation(6, centideg)
+ *   + sp roll/pitch(4, centideg) + sp yaw rate(2, decideg/s)
+ *   + sp thrust(2) + battery(1, ×200) + sensor flags(1, low byte)
+ */
+typedef struct __attribute__((packed)) {
+    int16_t pos_x, pos_y, pos_z;
+    int16_t vel_x, vel_y, vel_z;
+    int16_t roll_cdeg, pitch_cdeg, yaw_cdeg;
+    int16_t sp_roll_cdeg, sp_pitch_cdeg;
+    int16_t sp_yaw_rate_ddps;
+    uint16_t sp_thrust;
+    uint8_t battery_pct;       /* ×200, as TelemetryPacket              */
+    uint8_t sensor_flags;      /* SENSOR_FLAG_* low byte                */
+} HistorySample;
+/* Static assert: sizeof(HistorySample) == 28 */
+
+#define HISTORY_NAN_I16  INT16_MIN
+
+/** Why the history ring froze. */
+#define HISTORY_TRIGGER_NONE         0u
+#define HISTORY_TRIGGER_EMERGENCY    1u  /* CMD_FLAG_EMERGENCY rising edge    */
+#define HISTORY_TRIGGER_FORCED_EXIT  2u  /* CMD_FLAG_FORCE_PATTERN rising edge */
+#define HISTORY_TRIGGER_GROUND       3u  /* CMD_FLAG_HISTORY_FREEZE           */
+
+/**
+ * Describes a frozen capture. Interleaved with its chunks so a ground
+ * station that missed the start can still reassemble.
+ * sizeof: 12 bytes
+ */
+typedef struct __attribute__((packed)) {
+    uint8_t kind;              /* EXT_PACKET_HISTORY_INFO               */
+    uint8_t trigger;           /* HISTORY_TRIGGER_*                     */
+    uint8_t capture_id;        /* Increments per freeze                 */
+    uint8_t sample_size;       /* sizeof(HistorySample)                 */
+    uint16_t period_us;        /* Sample period                         */
+    uint16_t sample_count;     /* Samples in the capture, oldest first  */
+    uint16_t trigger_index;    /* Index of the trigger sample           */
+    uint16_t chunk_count;
+} HistoryInfoPacket;
+/* Static assert: sizeof(HistoryInfoPacket) == 12 */
+
+/** Capture bytes carried per chunk (samples are split across chunks). */
+#define HISTORY_CHUNK_BYTES 24u
+
+/**
+ * One slice of a frozen capture: bytes [chunk_index × 24, +24) of the
+ * oldest-first HistorySample stream, zero-padded at the end.
+ * sizeof: 28 bytes
+ */
+typedef struct __attribute__((packed)) {
+    uint8_t kind;              /* EXT_PACKET_HISTORY_CHUNK              */
+    uint8_t capture_id;
+    uint16_t chunk_index;
+    uint8_t data[HISTORY_CHUNK_BYTES];
+} HistoryChunkPacket;
+/* Static assert: sizeof(HistoryChunkPacket) == 28 */
+
+/** Status flags whose transitions are sent as priority EventPackets. */
+#define EVENT_FLAG_MASK  (TELEM_FLAG_EMERGENCY | TELEM_FLAG_LOW_BATTERY)
+
+/**
+ * Drone → ground priority event: a transition of an EVENT_FLAG_MASK flag
+ * (see event_queue.h). Sent ahead of routine telemetry and retransmitted
+ * until acknowledged.
+ * sizeof: 13 bytes
+ *   kind(1) + seq(1) + old_flags(1) + new_flags(1) + battery(1)
+ *   + pattern_id(2) + pos(6, float16×3)
+ */
+typedef struct __attribute__((packed)) {
+    uint8_t kind;              /* EXT_PACKET_EVENT                      */
+    uint8_t seq;               /* Increments per event                  */
+    uint8_t old_flags;         /* TELEM_FLAG_* before the transition    */
+    uint8_t new_flags;         /* TELEM_FLAG_* after                    */
+    uint8_t battery_pct;       /* ×200, as TelemetryPacket              */
+    uint16_t pattern_id;
+    int16_t pos_x;             /* mm                                    */
+    int16_t pos_y;
+    int16_t pos_z;
+} EventPacket;
+/* Static assert: sizeof(EventPacket) == 13 */
+
+/** Ground → drone packet kinds that are not GroundCommands. */
+#define UPLINK_EVENT_ACK  0xE1u
+
+/**
+ * Ground → drone acknowledgement of the EventPacket with this seq. Told
+ * apart from a GroundCommand by length.
+ * sizeof: 2 bytes
+ */
+typedef struct __attribute__((packed)) {
+    uint8_t kind;              /* UPLINK_EVENT_ACK                      */
+    uint8_t seq;
+} EventAckPacket;
+/* Static assert: sizeof(EventAckPacket) == 2 */
+
+/**
+ * Drone → ground per-pattern usage since boot (see pattern_stats.h).
+ * Cumulative, so the ground keeps only the latest packet per pattern.
+ * sizeof: 18 bytes
+ *   kind(1) + pad(1) + pattern_id(2) + entries(2) + time(4) + energy(4)
+ *   + peak_speed(2) + peak_attitude(2)
+ */
+typedef struct __attribute__((packed)) {
+    uint8_t kind;              /* EXT_PACKET_PATTERN_STATS              */
+    uint8_t _pad;
+    uint16_t pattern_id;
+    uint16_t entries;          /* Times the pattern was entered (sat.)  */
+    uint32_t time_ms;          /* Total time in the pattern             */
+    uint32_t energy_mj;        /* Energy drawn while in it (mJ)         */
+    uint16_t peak_speed_mms;   /* Peak |velocity| (mm/s)                */
+    uint16_t peak_attitude_cdeg; /* Peak roll/pitch command (0.01°)     */
+} PatternStatsPacket;
+/* Static assert: sizeof(PatternStatsPacket) == 18 */
+
+/* -----------------------------------------------------------------------
+ * Peer-to-Peer Broadcast (drone → drones, no ground hop)
+ * ----------------------------------------------------------------------- */
+
+/** P2P packet kinds (first byte). */
+#define P2P_PACKET_STATE  0x01u
+
+/**
+ * Drone → neighbours: own position and velocity, broadcast on the P2P
+ * channel and kept in each receiver's neighbor table (neighbor_table.h).
+ * sizeof: 16 bytes
+ *   kind(1) + drone_id(1) + seq(1) + flags(1) + pos(6) + vel(6)
+ */
+typedef struct __attribute__((packed)) {
+    uint8_t kind;              /* P2P_PACKET_STATE                      */
+    uint8_t drone_id;          /* Sender's swarm-unique ID              */
+    uint8_t seq;               /* Increments per broadcast              */
+    uint8_t flags;             /* Sender's TELEM_FLAG_* bitfield        */
+    int16_t pos_x;             /* float16: position (mm)                */
+    int16_t pos_y;
+    int16_t pos_z;
+    int16_t vel_x;             /* float16: velocity (mm/s)              */
+    int16_t vel_y;
+    int16_t vel_z;
+} PeerStatePacket;
+/* Static assert: sizeof(PeerStatePacket) == 16 */
+
 /* -----------------------------------------------------------------------
  * Catalog Entry (compiled into flash)
  * ----------------------------------------------------------------------- */
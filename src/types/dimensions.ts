@@ -341,7 +341,7 @@ export const GENERATOR_TYPES: readonly GeneratorType[] = [
 
 /**
  * Ground station → drone command packet.
- * Target size: 20 bytes over radio.
+ * Size: 18 bytes over radio (GroundCommand in firmware/types.h).
  */
 export interface GroundCommand {
   /** Index into the onboard catalog (uint16) */
@@ -0,0 +1,81 @@
+/**
+ * Battery forecast: battery_forecast.c flown through a simulated pack,
+ * forecast checked against the pack's true time to cutoff.
+ */
+
+import { describe, it, expect, beforeAll } from 'vitest';
+import { execFileSync } from 'node:child_process';
+import {
+  findHostCompiler,
+  stageFirmware,
+  compileObject,
+  linkProgram,
+} from './host-cc.js';
+
+interface Sample {
+  t: number;
+  gen: number;
+  forecast_s: number;
+  true_s: number;
+  hold_s: number;
+  resting_soc: number;
+  soc: number;
+  resistance: number;
+  loaded_soc: number;
+}
+
+interface ForecastReport {
+  resistance: number;
+  samples: Sample[];
+  flight_s: number;
+}
+
+const GEN_TRAJECTORY_SPLINE = 5;
+
+const cc = findHostCompiler();
+
+describe.skipIf(!cc)('battery forecast (host)', () => {
+  let report: ForecastReport;
+
+  beforeAll(() => {
+    const dir = stageFirmware();
+    const exe = linkProgram(cc!, dir, 'battery_forecast_harness.c', [
+      compileObject(cc!, dir, 'battery_forecast.c'),
+      compileObject(cc!, dir, 'telemetry_reporter.c'),
+      compileObject(cc!, dir, 'event_queue.c'),
+    ]);
+    report = JSON.parse(execFileSync(exe, { encoding: 'utf-8' }));
+  }, 60_000);
+
+  it('learns the pack resistance from voltage sag', () => {
+    for (const s of report.samples) {
+      expect(Math.abs(s.resistance - report.resistance)).toBeLessThan(report.resistance * 0.05);
+    }
+  });
+
+  it('tracks resting state of charge where the loaded voltage does not', () => {
+    const s = report.samples.find((x) => x.t === 30)!;
+    expect(Math.abs(s.resting_soc - s.soc)).toBeLessThan(0.03);
+    expect(s.soc - s.loaded_soc).toBeGreaterThan(0.3);
+  });
+
+  it('forecasts time to cutoff at the current pattern within 10%', () => {
+    for (const s of report.samples) {
+      expect(Math.abs(s.forecast_s - s.true_s)).toBeLessThanOrEqual(s.true_s * 0.1 + 2);
+    }
+    // Runs down to the end of the flight rather than stopping at a floor.
+    const last = report.samples[report.samples.length - 1]!;
+    expect(report.flight_s - last.t).toBeLessThan(10);
+    expect(last.forecast_s).toBeLessThan(15);
+  });
+
+  it('switches to the learned rate of the new pattern', () => {
+    const spline = report.samples.filter((s) => s.gen === GEN_TRAJECTORY_SPLINE);
+    expect(spline.length).toBeGreaterThan(0);
+    for (const s of spline) expect(s.hold_s).toBeGreaterThan(s.forecast_s * 1.35);
+
+    // Back on position hold: the hold rate learned before the spline applies at once.
+    const back = report.samples.find((s) => s.t === 120)!;
+    expect(Math.abs(back.forecast_s - back.true_s)).toBeLessThan(back.true_s * 0.05);
+  });
+});
@@ -0,0 +1,108 @@
+/**
+ * Battery forecast harness: flies a simulated 1S pack through
+ * battery_forecast.c at 100 Hz and prints forecast against truth.
+ *
+ * Pack model: 3330 J at rest, resting voltage from the firmware's LiPo
+ * curve, 0.15 Ω internal resistance, loaded voltage solved from P = V·I.
+ * Flight, starting at 90%:
+ *   0–60 s     position hold, 7/9 W alternating every 0.5 s (8 W mean)
+ *   60–120 s   trajectory spline, 11/13 W (12 W mean)
+ *   120 s on   position hold until the loaded voltage hits 3.0 V
+ *
+ * Prints one JSON object: the pack resistance, and every 10 s the
+ * forecast (s), the true time to cutoff at the current pattern's mean
+ * power (s), the forecast for position hold, resting and true state of
+ * charge, the estimated resistance, and the state of charge a loaded-
+ * voltage reading would give.
+ */
+
+#include "types.h"
+#include "battery_forecast.h"
+#include <math.h>
+#include <stdio.h>
+
+#define STEP_US     10000u
+#define CAPACITY_J  3330.0f
+#define R_OHM       0.15f
+#define V_CUTOFF    3.0f
+
+static const float k_curve[11] = {
+    3.30f, 3.65f, 3.70f, 3.73f, 3.77f, 3.80f, 3.84f, 3.88f, 3.95f, 4.05f, 4.20f,
+};
+
+static float resting_v(float soc) {
+    float x = soc * 10.0f;
+    int i = (int)x;
+    if (soc <= 0.0f) return k_curve[0];
+    if (i >= 10) return k_curve[10];
+    return k_curve[i] + (x - (float)i) * (k_curve[i + 1] - k_curve[i]);
+}
+
+static float soc_of(float v) {
+    int i;
+    if (v <= k_curve[0]) return 0.0f;
+    for (i = 1; i < 11; i++) {
+        if (v < k_curve[i]) return ((float)(i - 1) + (v - k_curve[i - 1]) / (k_curve[i] - k_curve[i - 1])) * 0.1f;
+    }
+    return 1.0f;
+}
+
+/** Loaded voltage at power p; 0 if the pack cannot deliver it. */
+static float loaded_v(float soc, float p) {
+    float vr = resting_v(soc);
+    float disc = vr * vr - 4.0f * p * R_OHM;
+    return disc < 0.0f ? 0.0f : 0.5f * (vr + sqrtf(disc));
+}
+
+/** Seconds until the loaded voltage at steady power p reaches cutoff. */
+static float true_remaining(float soc, float p) {
+    float t = 0.0f;
+    while (loaded_v(soc, p) > V_CUTOFF && t < 4000.0f) {
+        soc -= p * 0.1f / CAPACITY_J;
+        t += 0.1f;
+    }
+    return t;
+}
+
+int main(void) {
+    SensorState st;
+    float soc = 0.9f;
+    uint32_t i;
+    int first = 1;
+
+    battery_forecast_init(NULL);
+    printf("{\"resistance\":%.3f,\"samples\":[", R_OHM);
+
+    for (i = 0; ; i++) {
+        float t = (float)i * (float)STEP_US * 1e-6f;
+        int spline = t >= 60.0f && t < 120.0f;
+        int high = ((i / 50u) % 2u) == 1u;
+        float mean = spline ? 12.0f : 8.0f;
+        float p = mean + (high ? 1.0f : -1.0f);
+        uint8_t gen = spline ? GEN_TRAJECTORY_SPLINE : GEN_POSITION_HOLD;
+        float v = loaded_v(soc, p);
+
+        if (v <= V_CUTOFF) break;
+
+        st.battery_voltage = v;
+        st.discharge_rate = p;
+        st.battery_pct = soc_of(v);
+        battery_forecast_update(&st, gen, 1000u + i * STEP_US);
+
+        if (i % 1000u == 0u && i > 0) {
+            const BatteryForecast* fc = battery_forecast_get();
+            if (!first) putchar(',');
+            first = 0;
+            printf("{\"t\":%.0f,\"gen\":%u,\"forecast_s\":%u,\"true_s\":%.1f,"
+                   "\"hold_s\":%u,\"resting_soc\":%.4f,\"soc\":%.4f,"
+                   "\"resistance\":%.4f,\"loaded_soc\":%.4f}",
+                   t, gen, fc->remaining_s, true_remaining(soc, mean),
+                   battery_forecast_remaining_for(GEN_POSITION_HOLD),
+                   fc->resting_soc, soc, fc->resistance_ohm, soc_of(v));
+        }
+        soc -= p * (float)STEP_US * 1e-6f / CAPACITY_J;
+    }
+
+    printf("],\"flight_s\":%.1f}\n", (float)i * (float)STEP_US * 1e-6f);
+    return 0;
+}
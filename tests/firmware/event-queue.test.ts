@@ -0,0 +1,101 @@
+/**
+ * Priority events: flag transitions from telemetry_build_flags() through
+ * event_queue.c over a scripted link, decoded with the coordinator's
+ * event decoder.
+ */
+
+import { describe, it, expect, beforeAll } from 'vitest';
+import { execFileSync } from 'node:child_process';
+import {
+  findHostCompiler,
+  stageFirmware,
+  compileObject,
+  linkProgram,
+} from './host-cc.js';
+import { decodeEventPacket, TelemFlags, type DroneEvent } from '../../src/coordinator/comms.js';
+
+interface ReceivedOutput {
+  packet: string;
+  raised_ms: number;
+  received_ms: number;
+}
+
+interface ScenarioOutput {
+  received: ReceivedOutput[];
+  tx: number;
+  pending: number;
+  raised?: number;
+  down_depth?: number;
+}
+
+interface Received {
+  event: DroneEvent;
+  latencyMs: number;
+}
+
+const TX_SLOT_MS = 10;
+const RETRANSMIT_MS = 20;
+const QUEUE_DEPTH = 4;
+const FLYING = TelemFlags.AIRBORNE | TelemFlags.PATTERN_ACTIVE;
+
+const cc = findHostCompiler();
+
+describe.skipIf(!cc)('event queue (host)', () => {
+  let out: Record<string, ScenarioOutput>;
+  const received = new Map<string, Received[]>();
+
+  beforeAll(() => {
+    const dir = stageFirmware();
+    const exe = linkProgram(cc!, dir, 'event_queue_harness.c', [
+      compileObject(cc!, dir, 'event_queue.c'),
+      compileObject(cc!, dir, 'telemetry_reporter.c'),
+    ]);
+    out = JSON.parse(execFileSync(exe, { encoding: 'utf-8' }));
+    for (const [name, o] of Object.entries(out)) {
+      received.set(name, o.received.map((r) => {
+        const event = decodeEventPacket('d1', Uint8Array.from(Buffer.from(r.packet, 'hex')));
+        expect(event).not.toBeNull();
+        return { event: event!, latencyMs: r.received_ms - r.raised_ms };
+      }));
+    }
+  }, 60_000);
+
+  it('raises one event per EMERGENCY / LOW_BATTERY transition', () => {
+    const events = received.get('clean')!.map((r) => r.event);
+    expect(events.map((e) => e.seq)).toEqual([0, 1]);
+    expect(events[0]!.oldFlags).toBe(FLYING);
+    expect(events[0]!.newFlags).toBe(FLYING | TelemFlags.LOW_BATTERY);
+    expect(events[0]!.battery).toBeLessThan(0.15);
+    expect(events[1]!.newFlags).toBe(FLYING | TelemFlags.LOW_BATTERY | TelemFlags.EMERGENCY);
+    expect(events[1]!.patternId).toBe(3);
+    expect(events[1]!.position).toEqual({ x: 0.5, y: 0, z: 1 });
+  });
+
+  it('goes out in the next TX slot, once, on a clean link', () => {
+    for (const r of received.get('clean')!) expect(r.latencyMs).toBeLessThanOrEqual(TX_SLOT_MS);
+    expect(out.clean!.tx).toBe(2);
+    expect(out.clean!.pending).toBe(0);
+  });
+
+  it('retransmits until acked on a lossy link', () => {
+    const lossy = received.get('lossy')!;
+    expect(lossy.map((r) => r.event.seq)).toEqual([0, 1]);
+    for (const r of lossy) expect(r.latencyMs).toBeLessThanOrEqual(TX_SLOT_MS + RETRANSMIT_MS);
+    // Lost copy, delivered copy whose ack is lost, acked retransmit.
+    expect(out.lossy!.tx).toBe(6);
+    expect(out.lossy!.pending).toBe(0);
+  });
+
+  it('coalesces a flapping flag into a bounded queue', () => {
+    const flap = out.flap!;
+    expect(flap.raised).toBeGreaterThan(QUEUE_DEPTH);
+    expect(flap.down_depth).toBe(QUEUE_DEPTH);
+    expect(flap.pending).toBe(0);
+
+    // The coalesced entry carries the final flags and goes out first.
+    const events = received.get('flap')!.map((r) => r.event);
+    expect(events).toHaveLength(QUEUE_DEPTH);
+    expect(events[0]!.newFlags).toBe(FLYING);
+    expect(events[0]!.oldFlags & TelemFlags.LOW_BATTERY).toBe(TelemFlags.LOW_BATTERY);
+  });
+});
@@ -0,0 +1,128 @@
+/**
+ * Event queue harness: drives telemetry_build_flags() at 500 Hz with a
+ * draining or flapping battery, takes event_queue_next() at the start of
+ * every 100 Hz TX slot, and plays the ground over a scripted link.
+ *
+ * Scenarios (20 ms retransmit):
+ *   clean   Battery 20% → 5% over 10 s, no loss
+ *   lossy   Same drain; the first copy of each event and the first ack
+ *           for it are lost
+ *   flap    Battery hovers at 15% so LOW_BATTERY toggles every 100 ms for
+ *           1 s with the ground unreachable, then the link returns
+ *
+ * Prints one JSON object: per scenario, each event the ground received
+ * (hex EventPacket, time the flags changed and time of first reception,
+ * ms), the event transmissions, and the events still queued at the end.
+ * flap also reports the queue depth while the link was down.
+ */
+
+#include "types.h"
+#include "event_queue.h"
+#include "telemetry_reporter.h"
+#include <stdio.h>
+#include <string.h>
+
+#define LOOP_US        2000u
+#define TX_EVERY       5        /* 100 Hz TX slots */
+#define RETRANSMIT_US  20000u
+#define STEPS          5000     /* 10 s */
+#define MAX_EVENTS     32
+
+typedef enum { SC_CLEAN, SC_LOSSY, SC_FLAP, SC_COUNT } Scenario;
+
+static const char* const NAMES[SC_COUNT] = { "clean", "lossy", "flap" };
+
+static void run(Scenario sc) {
+    SensorState st;
+    uint8_t prev_flags = 0;
+    uint32_t raised_ms[256];
+    uint8_t received[256];
+    uint8_t dropped_tx[256];
+    uint8_t dropped_ack[256];
+    uint8_t pending_ack = 0;
+    int have_ack = 0;
+    uint32_t tx = 0;
+    uint8_t down_depth = 0;
+    uint8_t seq = 0;
+    int n_out = 0;
+    int i;
+
+    memset(received, 0, sizeof(received));
+    memset(dropped_tx, 0, sizeof(dropped_tx));
+    memset(dropped_ack, 0, sizeof(dropped_ack));
+    event_queue_init(RETRANSMIT_US);
+    printf("\"%s\":{\"received\":[", NAMES[sc]);
+
+    for (i = 0; i < STEPS; i++) {
+        uint32_t now = 1000000u + (uint32_t)i * LOOP_US;
+        uint32_t ms = (uint32_t)i * LOOP_US / 1000u;
+        int link_up = !(sc == SC_FLAP && ms < 1000u);
+        uint8_t flags;
+
+        memset(&st, 0, sizeof(st));
+        st.position.x = 0.5f;
+        st.position.z = 1.0f;
+        if (sc == SC_FLAP) {
+            st.battery_pct = (ms < 1000u && (ms / 100u) % 2u == 1u) ? 0.149f : 0.151f;
+        } else {
+            st.battery_pct = 0.20f - 0.15f * (float)i / (float)STEPS;
+        }
+        if (st.battery_pct < 0.12f) st.flags |= SENSOR_FLAG_LOW_BATTERY;
+
+        /* Ack from the previous TX slot arrives before this step. */
+        if (have_ack) {
+            EventAckPacket ack;
+            ack.kind = UPLINK_EVENT_ACK;
+            ack.seq = pending_ack;
+            event_queue_ack((const uint8_t*)&ack, sizeof(ack));
+            have_ack = 0;
+        }
+
+        flags = telemetry_build_flags(&st, 3u);
+        if (i > 0 && ((flags ^ prev_flags) & EVENT_FLAG_MASK)) raised_ms[seq++] = ms;
+        prev_flags = flags;
+
+        if (i % TX_EVERY == 0) {
+            EventPacket pkt;
+            uint16_t n = event_queue_next(now, (uint8_t*)&pkt, sizeof(pkt));
+            if (n > 0) {
+                tx++;
+                if (!link_up) continue;
+                if (sc == SC_LOSSY && !dropped_tx[pkt.seq]) {
+                    dropped_tx[pkt.seq] = 1;
+                    continue;
+                }
+                if (!received[pkt.seq] && n_out < MAX_EVENTS) {
+                    size_t b;
+                    received[pkt.seq] = 1;
+                    if (n_out++ > 0) putchar(',');
+                    printf("{\"packet\":\"");
+                    for (b = 0; b < sizeof(pkt); b++) printf("%02x", ((uint8_t*)&pkt)[b]);
+                    printf("\",\"raised_ms\":%u,\"received_ms\":%u}", raised_ms[pkt.seq], ms);
+                }
+                if (sc == SC_LOSSY && !dropped_ack[pkt.seq]) {
+                    dropped_ack[pkt.seq] = 1;
+                    continue;
+                }
+                pending_ack = pkt.seq;
+                have_ack = 1;
+            }
+        }
+        if (ms == 998u) down_depth = event_queue_pending();
+    }
+
+    printf("],\"tx\":%u,\"pending\":%u", tx, event_queue_pending());
+    if (sc == SC_FLAP) printf(",\"raised\":%u,\"down_depth\":%u", seq, down_depth);
+    printf("}");
+}
+
+int main(void) {
+    int sc;
+    putchar('{');
+    for (sc = 0; sc < SC_COUNT; sc++) {
+        if (sc > 0) putchar(',');
+        run((Scenario)sc);
+    }
+    printf("}\n");
+    return 0;
+}
@@ -0,0 +1,87 @@
+/**
+ * Q16.16 fixed-point executor: host equivalence against the float build.
+ *
+ * Builds pattern_executor.c twice (default and -DSESHAT_FIXED_POINT) with
+ * a fixture catalog covering every generator, links both into
+ * q16_equivalence.c, and checks the setpoints agree to within Q16.16
+ * resolution on a seeded command/sensor stream.
+ */
+
+import { describe, it, expect, beforeAll } from 'vitest';
+import { execFileSync } from 'node:child_process';
+import {
+  findHostCompiler,
+  stageFirmware,
+  compileRenamed,
+  linkProgram,
+} from './host-cc.js';
+
+interface EquivalenceReport {
+  steps: number;
+  max_diff: { roll: number; pitch: number; yaw: number; thrust: number };
+  per_generator: { generator: number; attitude: number; thrust: number }[];
+  mm_roundtrip_failures: number;
+  mm_encode_max_diff: number;
+  conversion_error_lsb: number;
+  nonfinite_violations: number;
+  ns_per_step: { float: number; q16: number };
+}
+
+const cc = findHostCompiler();
+
+describe.skipIf(!cc)('fixed-point executor (host)', () => {
+  let report: EquivalenceReport;
+
+  beforeAll(() => {
+    const dir = stageFirmware('catalog_data.h');
+    const objects = [
+      compileRenamed(cc!, dir, 'pattern_executor.c', 'pe_float'),
+      compileRenamed(cc!, dir, 'pattern_executor.c', 'pe_q16', ['SESHAT_FIXED_POINT']),
+    ];
+    const exe = linkProgram(cc!, dir, 'q16_equivalence.c', objects);
+    report = JSON.parse(execFileSync(exe, ['100000'], { encoding: 'utf-8' }));
+  }, 60_000);
+
+  it('matches float attitude setpoints to within 0.05 deg', () => {
+    expect(report.max_diff.roll).toBeLessThan(0.05);
+    expect(report.max_diff.pitch).toBeLessThan(0.05);
+    expect(report.max_diff.yaw).toBe(0);
+  });
+
+  it('matches float thrust to within one thrust unit', () => {
+    expect(report.max_diff.thrust).toBeLessThanOrEqual(1);
+  });
+
+  it('exercises every generator with active outputs', () => {
+    expect(report.per_generator).toHaveLength(8);
+    for (const g of report.per_generator) {
+      // Orbit normalises the centre->drone vector, which near the centre
+      // (r ~ 0.01 m) amplifies 1 LSB to a few thousandths of a degree.
+      expect(g.attitude).toBeLessThan(g.generator === 4 ? 0.05 : 0.001);
+      expect(g.thrust).toBeLessThanOrEqual(1);
+    }
+    // Any generator that moves the drone picks up some Q16 rounding; an
+    // exact zero would mean it was never dispatched.
+    for (const gen of [0, 1, 2, 3, 4, 5]) {
+      expect(report.per_generator[gen]!.thrust).toBeGreaterThan(0);
+    }
+  });
+
+  it('round-trips every int16 wire value', () => {
+    expect(report.mm_roundtrip_failures).toBe(0);
+    expect(report.mm_encode_max_diff).toBeLessThanOrEqual(1);
+  });
+
+  it('converts floats to within one LSB', () => {
+    expect(report.conversion_error_lsb).toBeLessThanOrEqual(1);
+  });
+
+  it('keeps setpoints finite and clamped on NaN/Inf/denormal sensor input', () => {
+    expect(report.nonfinite_violations).toBe(0);
+  });
+
+  it('reports per-step timing for both builds', () => {
+    expect(report.ns_per_step.float).toBeGreaterThan(0);
+    expect(report.ns_per_step.q16).toBeGreaterThan(0);
+  });
+});
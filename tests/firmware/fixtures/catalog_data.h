@@ -0,0 +1,107 @@
+/**
+ * Test fixture: one catalog entry per GeneratorType, so host tests
+ * exercise every generator regardless of what the shipped catalog uses.
+ * Staged over src/firmware/catalog_data.h by tests/firmware/host-cc.ts.
+ * GEN_USED_MASK is left undefined, so the executor keeps every generator.
+ */
+
+#ifndef SESHAT_CATALOG_DATA_H
+#define SESHAT_CATALOG_DATA_H
+
+#include "types.h"
+
+#define CATALOG_SIZE 8
+
+/* Entries are stored in ID order: CATALOG[i].id == i. */
+static const PatternEntry CATALOG[CATALOG_SIZE] = {
+    /* [0] position-hold */
+    {
+        .id = 0,
+        .generator_type = 0,
+        ._pad = 0,
+        .defaults = { 0.8f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
+        .bounds_min = { 0.2f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
+        .bounds_max = { 2.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
+        .battery_floor = 0.15f,
+        .pos_quality_floor = 0.5f,
+    },
+    /* [1] velocity-track */
+    {
+        .id = 1,
+        .generator_type = 1,
+        ._pad = 0,
+        .defaults = { 0.5f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
+        .bounds_min = { 0.1f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
+        .bounds_max = { 1.5f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
+        .battery_floor = 0.15f,
+        .pos_quality_floor = 0.5f,
+    },
+    /* [2] waypoint-sequence */
+    {
+        .id = 2,
+        .generator_type = 2,
+        ._pad = 0,
+        .defaults = { 0.4f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
+        .bounds_min = { 0.1f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
+        .bounds_max = { 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
+        .battery_floor = 0.15f,
+        .pos_quality_floor = 0.5f,
+    },
+    /* [3] relative-offset */
+    {
+        .id = 3,
+        .generator_type = 3,
+        ._pad = 0,
+        .defaults = { 0.5f, -0.5f, 0.2f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
+        .bounds_min = { -2.0f, -2.0f, -1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
+        .bounds_max = { 2.0f, 2.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
+        .battery_floor = 0.15f,
+        .pos_quality_floor = 0.5f,
+    },
+    /* [4] orbit-center */
+    {
+        .id = 4,
+        .generator_type = 4,
+        ._pad = 0,
+        .defaults = { 0.6f, 0.8f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
+        .bounds_min = { 0.2f, 0.1f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
+        .bounds_max = { 2.0f, 2.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
+        .battery_floor = 0.15f,
+        .pos_quality_floor = 0.5f,
+    },
+    /* [5] trajectory-spline */
+    {
+        .id = 5,
+        .generator_type = 5,
+        ._pad = 0,
+        .defaults = { 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
+        .bounds_min = { 0.2f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
+        .bounds_max = { 2.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
+        .battery_floor = 0.15f,
+        .pos_quality_floor = 0.5f,
+    },
+    /* [6] emergency-stop */
+    {
+        .id = 6,
+        .generator_type = 6,
+        ._pad = 0,
+        .defaults = { 0.5f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
+        .bounds_min = { 0.2f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
+        .bounds_max = { 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
+        .battery_floor = 0.15f,
+        .pos_quality_floor = 0.5f,
+    },
+    /* [7] idle */
+    {
+        .id = 7,
+        .generator_type = 7,
+        ._pad = 0,
+        .defaults = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
+        .bounds_min = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
+        .bounds_max = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
+        .battery_floor = 0.15f,
+        .pos_quality_floor = 0.5f,
+    },
+};
+
+#endif /* SESHAT_CATALOG_DATA_H */
@@ -0,0 +1,55 @@
+/**
+ * Leader-relative formation: followers fly GEN_RELATIVE_OFFSET from the
+ * leader's P2P broadcasts under one CMD_FLAG_LEADER_RELATIVE command each.
+ */
+
+import { describe, it, expect, beforeAll } from 'vitest';
+import { execFileSync } from 'node:child_process';
+import {
+  findHostCompiler,
+  stageFirmware,
+  compileRenamed,
+  linkProgram,
+} from './host-cc.js';
+
+interface FormationReport {
+  commands: number[];
+  never_heard_m: number;
+  settle_err_m: number;
+  moving_err_m: { max: number; rms: number };
+  lost_drift_m: number;
+}
+
+const cc = findHostCompiler();
+
+describe.skipIf(!cc)('leader-relative formation (host)', () => {
+  let report: FormationReport;
+
+  beforeAll(() => {
+    const dir = stageFirmware('catalog_data.h');
+    const objects = [
+      ...['n0', 'n1', 'n2'].map((p) => compileRenamed(cc!, dir, 'neighbor_table.c', p)),
+      ...['pe1', 'pe2'].map((p) => compileRenamed(cc!, dir, 'pattern_executor.c', p)),
+    ];
+    const exe = linkProgram(cc!, dir, 'formation_harness.c', objects);
+    report = JSON.parse(execFileSync(exe, { encoding: 'utf-8' }));
+  }, 60_000);
+
+  it('moves the whole formation with one command per follower', () => {
+    expect(report.commands).toEqual([1, 1]);
+  });
+
+  it('settles on the slot: leader + command offset + catalog offset', () => {
+    expect(report.settle_err_m).toBeLessThan(0.1);
+  });
+
+  it('tracks a moving leader over a lossy P2P link', () => {
+    expect(report.moving_err_m.rms).toBeLessThan(0.2);
+    expect(report.moving_err_m.max).toBeLessThan(0.35);
+  });
+
+  it('holds position instead of chasing a leader it cannot hear', () => {
+    expect(report.never_heard_m).toBeLessThan(0.05);
+    expect(report.lost_drift_m).toBeLessThan(0.25);
+  });
+});
@@ -0,0 +1,210 @@
+/**
+ * Formation harness: a leader flies a scripted path and broadcasts its
+ * state over p2p_medium.h; two followers, each with its own build of
+ * pattern_executor.c (pe1_*, pe2_*) and neighbor_table.c (n1_*, n2_*),
+ * fly the fixture's GEN_RELATIVE_OFFSET pattern under a single
+ * CMD_FLAG_LEADER_RELATIVE command apiece, point-mass dynamics at 500 Hz.
+ *
+ * Timeline (20 ms latency, 10 % loss once the channel is up):
+ *   0–1 s    channel silent: followers have never heard the leader
+ *   1–3 s    leader hovers at (0, 0, 1)
+ *   3–9 s    leader flies +x at 0.5 m/s
+ *   9–13 s   leader flies +y at 0.5 m/s
+ *   13–14 s  leader hovers
+ *   14–16 s  channel silent again, leader keeps flying +x
+ *
+ * Prints one JSON object:
+ *   commands        GroundCommands sent per follower over the whole run
+ *   never_heard_m   Follower drift from its start while never hearing the leader
+ *   settle_err_m    Max follower error from its slot at the end of the hover
+ *   moving_err_m    Max / RMS error from slot while the leader moves (after 1 s
+ *                   of each leg, to skip the turn transient)
+ *   lost_drift_m    Max follower drift from its last slot while the leader is silent
+ */
+
+#include "types.h"
+#include "pattern_executor.h"
+#include "neighbor_table.h"
+#include "p2p_medium.h"
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#define FOLLOWERS     2
+#define STEP_US       2000u
+#define BROADCAST_US  20000u
+#define LEADER_ID     1u
+#define GRAVITY       9.81f
+#define DRAG          0.5f     /* 1/s, horizontal */
+#define DRAG_Z        2.0f     /* 1/s, vertical (stands in for the altitude loop) */
+#define HOVER_THRUST  37500.0f
+#define DEG2RAD       0.017453292f
+#define RELATIVE_PATTERN 3u   /* fixtures/catalog_data.h: offset (0.5, -0.5, 0.2) */
+
+/* -- Per-drone builds --------------------------------------------------- */
+
+void n0_table_init(uint8_t self_id, const NeighborConfig* cfg);
+void n0_table_pack_self(const SensorState* s, uint8_t f, PeerStatePacket* o);
+
+#define DECLARE_FOLLOWER(n, pe)                                                    \
+    void n##_table_init(uint8_t self_id, const NeighborConfig* cfg);               \
+    int n##_table_receive(const uint8_t* buf, uint16_t len, uint32_t now_us);      \
+    int n##_table_predict(uint8_t id, uint32_t now_us, Vec3* pos, Vec3* vel);      \
+    void pe##_init(void);                                                          \
+    void pe##_set_leader(const Vec3* position, const Vec3* velocity);              \
+    MotorSetpoints pe##_step(const GroundCommand* cmd, const SensorState* state);
+DECLARE_FOLLOWER(n1, pe1)
+DECLARE_FOLLOWER(n2, pe2)
+
+typedef struct {
+    void (*table_init)(uint8_t, const NeighborConfig*);
+    int (*receive)(const uint8_t*, uint16_t, uint32_t);
+    int (*predict)(uint8_t, uint32_t, Vec3*, Vec3*);
+    void (*init)(void);
+    void (*set_leader)(const Vec3*, const Vec3*);
+    MotorSetpoints (*step)(const GroundCommand*, const SensorState*);
+} FollowerApi;
+
+#define FOLLOWER_API(n, pe) { n##_table_init, n##_table_receive, n##_table_predict, \
+                              pe##_init, pe##_set_leader, pe##_step }
+static const FollowerApi API[FOLLOWERS] = { FOLLOWER_API(n1, pe1), FOLLOWER_API(n2, pe2) };
+
+/* -- Simulation --------------------------------------------------------- */
+
+/** Follower slots from the ground (target_pos, mm) and the catalog offset. */
+static const int16_t SLOT_MM[FOLLOWERS][3] = { { -1000, 0, 0 }, { -1000, 1000, 0 } };
+static const float CATALOG_OFFSET[3] = { 0.5f, -0.5f, 0.2f };
+
+typedef struct {
+    SensorState s;
+    GroundCommand cmd;
+    uint32_t commands;
+} Follower;
+
+static Follower s_f[FOLLOWERS];
+static SensorState s_leader;
+static P2pMedium s_medium;
+
+static void leader_at(uint32_t now_us) {
+    float t = (float)now_us * 1e-6f;
+    float vx = (t >= 3.0f && t < 9.0f) || t >= 14.0f ? 0.5f : 0.0f;
+    float vy = (t >= 9.0f && t < 13.0f) ? 0.5f : 0.0f;
+    float dt = (float)STEP_US * 1e-6f;
+    s_leader.velocity.x = vx;
+    s_leader.velocity.y = vy;
+    s_leader.position.x += vx * dt;
+    s_leader.position.y += vy * dt;
+}
+
+static void slot_of(int i, Vec3* out) {
+    out->x = s_leader.position.x + mm_to_float(SLOT_MM[i][0]) + CATALOG_OFFSET[0];
+    out->y = s_leader.position.y + mm_to_float(SLOT_MM[i][1]) + CATALOG_OFFSET[1];
+    out->z = s_leader.position.z + mm_to_float(SLOT_MM[i][2]) + CATALOG_OFFSET[2];
+}
+
+static float dist(const Vec3* a, const Vec3* b) {
+    float dx = a->x - b->x, dy = a->y - b->y, dz = a->z - b->z;
+    return sqrtf(dx * dx + dy * dy + dz * dz);
+}
+
+static void integrate(SensorState* s, const MotorSetpoints* sp) {
+    float dt = (float)STEP_US * 1e-6f;
+    float ax = GRAVITY * tanf(sp->pitch * DEG2RAD) - DRAG * s->velocity.x;
+    float ay = GRAVITY * tanf(sp->roll * DEG2RAD) - DRAG * s->velocity.y;
+    float az = GRAVITY * (sp->thrust / HOVER_THRUST - 1.0f) - DRAG_Z * s->velocity.z;
+    s->velocity.x += ax * dt;
+    s->velocity.y += ay * dt;
+    s->velocity.z += az * dt;
+    s->position.x += s->velocity.x * dt;
+    s->position.y += s->velocity.y * dt;
+    s->position.z += s->velocity.z * dt;
+}
+
+int main(void) {
+    uint32_t now;
+    uint8_t buf[P2P_MEDIUM_MAX_PAYLOAD];
+    Vec3 start[FOLLOWERS], last_slot[FOLLOWERS];
+    float never_heard = 0.0f, settle = 0.0f, moving_max = 0.0f, lost = 0.0f;
+    double moving_sq = 0.0;
+    uint32_t moving_n = 0;
+    int i;
+
+    memset(&s_leader, 0, sizeof(s_leader));
+    s_leader.position.z = 1.0f;
+    n0_table_init(LEADER_ID, NULL);
+    p2p_medium_init(&s_medium, FOLLOWERS + 1, 20000u, 1000, 5);
+
+    for (i = 0; i < FOLLOWERS; i++) {
+        Follower* f = &s_f[i];
+        memset(f, 0, sizeof(*f));
+        f->s.position.x = -0.8f + 0.3f * (float)i;
+        f->s.position.y = 0.4f * (float)i;
+        f->s.position.z = 1.1f;
+        start[i] = f->s.position;
+        API[i].table_init((uint8_t)(LEADER_ID + 1 + i), NULL);
+        API[i].init();
+
+        /* The only uplink each follower gets. */
+        f->cmd.pattern_id = RELATIVE_PATTERN;
+        f->cmd.target_pos_x = SLOT_MM[i][0];
+        f->cmd.target_pos_y = SLOT_MM[i][1];
+        f->cmd.target_pos_z = SLOT_MM[i][2];
+        f->cmd.flags = CMD_FLAG_LEADER_RELATIVE;
+        f->cmd.leader_id = LEADER_ID;
+        f->commands = 1;
+    }
+
+    for (now = 0; now < 16000000u; now += STEP_US) {
+        float t = (float)now * 1e-6f;
+        if (now == 1000000u) p2p_medium_set_loss(&s_medium, 100);
+        if (now == 14000000u) {
+            p2p_medium_set_loss(&s_medium, 1000);
+            for (i = 0; i < FOLLOWERS; i++) slot_of(i, &last_slot[i]);
+        }
+
+        leader_at(now);
+        if (now % BROADCAST_US == 0) {
+            PeerStatePacket pkt;
+            n0_table_pack_self(&s_leader, TELEM_FLAG_AIRBORNE, &pkt);
+            p2p_medium_broadcast(&s_medium, 0, &pkt, sizeof(pkt), now);
+        }
+
+        for (i = 0; i < FOLLOWERS; i++) {
+            Follower* f = &s_f[i];
+            Vec3 lp, lv, slot;
+            uint8_t len;
+            int heard;
+            MotorSetpoints sp;
+            float err;
+
+            while ((len = p2p_medium_poll(&s_medium, (uint8_t)(i + 1), now, buf)) > 0) {
+                API[i].receive(buf, len, now);
+            }
+            heard = API[i].predict(LEADER_ID, now, &lp, &lv);
+            API[i].set_leader(heard ? &lp : NULL, &lv);
+            sp = API[i].step(&f->cmd, &f->s);
+            integrate(&f->s, &sp);
+
+            slot_of(i, &slot);
+            err = dist(&f->s.position, &slot);
+            if (t < 1.0f && dist(&f->s.position, &start[i]) > never_heard) {
+                never_heard = dist(&f->s.position, &start[i]);
+            }
+            if (t >= 2.9f && t < 3.0f && err > settle) settle = err;
+            if ((t >= 4.0f && t < 9.0f) || (t >= 10.0f && t < 13.0f)) {
+                if (err > moving_max) moving_max = err;
+                moving_sq += (double)err * err;
+                moving_n++;
+            }
+            if (t >= 14.0f && dist(&f->s.position, &last_slot[i]) > lost) {
+                lost = dist(&f->s.position, &last_slot[i]);
+            }
+        }
+    }
+
+    printf("{\"commands\":[%u,%u],\"never_heard_m\":%.4f,\"settle_err_m\":%.4f,"
+           "\"moving_err_m\":{\"max\":%.4f,\"rms\":%.4f},\"lost_drift_m\":%.4f}\n",
+           s_f[0].commands, s_f[1].commands, never_heard, settle,
+           moving_max, sqrt(moving_sq / (double)moving_n), lost);
+    return 0;
+}
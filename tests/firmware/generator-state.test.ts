@@ -0,0 +1,105 @@
+/**
+ * Pattern executor generator state: host checks of the state arena and
+ * the on_enter/on_exit lifecycle.
+ *
+ * Builds pattern_executor.c twice under different prefixes, one driven
+ * through a pattern history and one freshly initialised, links both into
+ * generator_state_harness.c with the fixture catalog, and checks that a
+ * generator re-entered after a switch, emergency or invalid ID runs from
+ * the same state as a fresh executor, that a repeated ID keeps its state,
+ * and that the arena generators match the pre-arena float ones.
+ */
+
+import { describe, it, expect, beforeAll } from 'vitest';
+import { execFileSync } from 'node:child_process';
+import {
+  findHostCompiler,
+  stageFirmware,
+  compileRenamed,
+  linkProgram,
+} from './host-cc.js';
+
+interface Setpoints { roll: number; pitch: number; thrust: number }
+
+interface GeneratorStateReport {
+  orbit: Record<
+    'fresh_near_centre' | 'repeat_near_centre' | 'after_hover'
+    | 'after_waypoint' | 'after_emergency' | 'after_invalid',
+    Setpoints
+  >;
+  active: { orbit: number; after_hover: number; after_emergency: number; after_invalid: number };
+  relative: { repeat_after_moving: Setpoints; reentered_after_moving: Setpoints };
+  equivalence: {
+    steps: number;
+    waypoint: { steps: number; attitude: number; thrust: number };
+    orbit: { steps: number; attitude: number; thrust: number };
+    orbit_near_centre_skipped: number;
+  };
+}
+
+const NO_ACTIVE_PATTERN = 0xffff;
+const cc = findHostCompiler();
+
+describe.skipIf(!cc)('pattern executor generator state (host)', () => {
+  let report: GeneratorStateReport;
+
+  beforeAll(() => {
+    const dir = stageFirmware('catalog_data.h');
+    const objects = [
+      compileRenamed(cc!, dir, 'pattern_executor.c', 'pe_run'),
+      compileRenamed(cc!, dir, 'pattern_executor.c', 'pe_fresh'),
+    ];
+    const exe = linkProgram(cc!, dir, 'generator_state_harness.c', objects);
+    report = JSON.parse(execFileSync(exe, ['200000'], { encoding: 'utf-8' }));
+  }, 60_000);
+
+  it('reports the active pattern and deactivates on emergency or invalid IDs', () => {
+    expect(report.active.orbit).toBe(4);
+    expect(report.active.after_hover).toBe(0);
+    expect(report.active.after_emergency).toBe(NO_ACTIVE_PATTERN);
+    expect(report.active.after_invalid).toBe(NO_ACTIVE_PATTERN);
+  });
+
+  it('keeps the last orbit bearing near the centre on a repeated ID', () => {
+    // Fixture orbit: 0.6 m at 0.8 rad/s, so 0.48 m/s tangential. A fresh
+    // entry at the centre takes bearing +x (fly +y); held from due north
+    // it flies -x.
+    const { fresh_near_centre: fresh, repeat_near_centre: held } = report.orbit;
+    expect(fresh.roll).toBeCloseTo(3.84, 4);
+    expect(fresh.pitch).toBeCloseTo(0, 4);
+    expect(held.pitch).toBeCloseTo(-3.84, 4);
+    expect(held.roll).toBeCloseTo(0, 4);
+  });
+
+  it('does not re-run on_enter while the pattern ID repeats', () => {
+    // Leader unheard: the hold stays where the pattern was entered (x = 0).
+    expect(report.relative.repeat_after_moving.pitch).toBeCloseTo(15 * -0.5, 4);
+  });
+
+  it('re-runs on_enter when the pattern ID changes back', () => {
+    expect(report.relative.reentered_after_moving.pitch).toBeCloseTo(0, 4);
+  });
+
+  it('clears the arena between patterns', () => {
+    expect(report.orbit.after_hover).toEqual(report.orbit.fresh_near_centre);
+    expect(report.orbit.after_waypoint).toEqual(report.orbit.fresh_near_centre);
+  });
+
+  it('re-enters with fresh state after an emergency or invalid ID', () => {
+    expect(report.orbit.after_emergency).toEqual(report.orbit.fresh_near_centre);
+    expect(report.orbit.after_invalid).toEqual(report.orbit.fresh_near_centre);
+  });
+
+  it('matches the pre-arena waypoint and orbit generators', () => {
+    const { equivalence: eq } = report;
+    expect(eq.steps).toBe(200_000);
+    expect(eq.waypoint.steps).toBeGreaterThan(50_000);
+    expect(eq.orbit.steps).toBeGreaterThan(50_000);
+    // Bearing from the normalised centre vector rather than atan2f/sinf/cosf,
+    // and the waypoint slowdown folded into one division: float rounding only.
+    expect(eq.waypoint.attitude).toBeLessThan(1e-4);
+    expect(eq.orbit.attitude).toBeLessThan(1e-4);
+    expect(eq.waypoint.thrust).toBe(0);
+    expect(eq.orbit.thrust).toBe(0);
+  });
+});
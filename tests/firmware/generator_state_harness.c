@@ -0,0 +1,316 @@
+/**
+ * Host harness: pattern executor generator state arena and lifecycle hooks.
+ *
+ * Links two copies of pattern_executor.c, renamed at compile time:
+ *   pe_run_*    driven through a pattern history
+ *   pe_fresh_*  freshly initialised before each probe
+ * so "re-entered with fresh state" is checked as "same setpoints as an
+ * executor that never ran the earlier patterns". Also replays a seeded
+ * command/sensor stream against the pre-arena waypoint and orbit
+ * generators (per-step read_param, atan2f/sinf/cosf bearing), reproduced
+ * below, and reports the largest setpoint difference.
+ *
+ * Prints one JSON object. Driven by generator-state.test.ts.
+ *
+ * Usage: generator_state_harness [steps]
+ */
+
+#include "types.h"
+#include "catalog_data.h"   /* Fixture: CATALOG[i].generator_type == i */
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+void pe_run_init(void);
+uint16_t pe_run_active_pattern(void);
+void pe_run_set_leader(const Vec3* position, const Vec3* velocity);
+MotorSetpoints pe_run_step(const GroundCommand* cmd, const SensorState* state);
+void pe_fresh_init(void);
+MotorSetpoints pe_fresh_step(const GroundCommand* cmd, const SensorState* state);
+
+#define ID_HOVER     0        /* GEN_POSITION_HOLD     */
+#define ID_WAYPOINT  2        /* GEN_WAYPOINT_SEQUENCE */
+#define ID_RELATIVE  3        /* GEN_RELATIVE_OFFSET   */
+#define ID_ORBIT     4        /* GEN_ORBIT_CENTER      */
+#define ID_INVALID   200
+#define HOLD_STEPS   50       /* Steps per commanded pattern */
+
+/* -- Probes ---------------------------------------------------------------- */
+
+static GroundCommand command(uint16_t pattern_id, uint8_t flags) {
+    GroundCommand cmd = {0};
+    cmd.pattern_id = pattern_id;
+    cmd.target_pos_z = float_to_mm(1.0f);
+    cmd.flags = flags;
+    return cmd;
+}
+
+static SensorState at(float x, float y) {
+    SensorState s = {0};
+    s.position.x = x;
+    s.position.y = y;
+    s.position.z = 1.0f;
+    s.battery_pct = 0.8f;
+    s.pos_quality = 0.9f;
+    s.flags = SENSOR_FLAG_POS_VALID;
+    return s;
+}
+
+static void print_sp(const char* name, MotorSetpoints sp, int last) {
+    printf("    \"%s\": {\"roll\": %.9g, \"pitch\": %.9g, \"thrust\": %.9g}%s\n",
+           name, sp.roll, sp.pitch, sp.thrust, last ? "" : ",");
+}
+
+/** Orbit the centre (0, 0) from due north, so the held bearing is +y. */
+static void orbit_from_north(void) {
+    GroundCommand orbit = command(ID_ORBIT, 0);
+    SensorState north = at(0.0f, 0.6f);
+    pe_run_init();
+    pe_run_step(&orbit, &north);
+}
+
+/** Orbit step 0.005 m from the centre: too close to resolve a bearing. */
+static MotorSetpoints orbit_near_centre(MotorSetpoints (*step)(const GroundCommand*, const SensorState*)) {
+    GroundCommand orbit = command(ID_ORBIT, 0);
+    SensorState centre = at(0.003f, 0.004f);
+    return step(&orbit, &centre);
+}
+
+static void lifecycle_probes(void) {
+    GroundCommand hover = command(ID_HOVER, 0);
+    GroundCommand waypoint = command(ID_WAYPOINT, 0);
+    GroundCommand emergency = command(ID_ORBIT, CMD_FLAG_EMERGENCY);
+    GroundCommand invalid = command(ID_INVALID, 0);
+    GroundCommand relative = command(ID_RELATIVE, CMD_FLAG_LEADER_RELATIVE);
+    SensorState here = at(0.0f, 0.0f), moved = at(0.5f, 0.0f);
+    MotorSetpoints fresh, held;
+    uint16_t active[4];
+
+    pe_fresh_init();
+    fresh = orbit_near_centre(pe_fresh_step);
+
+    printf("  \"orbit\": {\n");
+    print_sp("fresh_near_centre", fresh, 0);
+
+    orbit_from_north();
+    active[0] = pe_run_active_pattern();
+    held = orbit_near_centre(pe_run_step);
+    print_sp("repeat_near_centre", held, 0);
+
+    orbit_from_north();
+    pe_run_step(&hover, &here);
+    active[1] = pe_run_active_pattern();
+    print_sp("after_hover", orbit_near_centre(pe_run_step), 0);
+
+    orbit_from_north();
+    pe_run_step(&waypoint, &here);
+    print_sp("after_waypoint", orbit_near_centre(pe_run_step), 0);
+
+    orbit_from_north();
+    pe_run_step(&emergency, &here);
+    active[2] = pe_run_active_pattern();
+    print_sp("after_emergency", orbit_near_centre(pe_run_step), 0);
+
+    orbit_from_north();
+    pe_run_step(&invalid, &here);
+    active[3] = pe_run_active_pattern();
+    print_sp("after_invalid", orbit_near_centre(pe_run_step), 1);
+    printf("  },\n");
+    printf("  \"active\": {\"orbit\": %u, \"after_hover\": %u, \"after_emergency\": %u, \"after_invalid\": %u},\n",
+           active[0], active[1], active[2], active[3]);
+
+    /* Leader-relative with the leader unheard holds where it was entered:
+     * a repeat must keep that hold, a re-entry takes the new position. */
+    printf("  \"relative\": {\n");
+    pe_run_init();
+    pe_run_set_leader((const Vec3*)0, (const Vec3*)0);
+    pe_run_step(&relative, &here);
+    print_sp("repeat_after_moving", pe_run_step(&relative, &moved), 0);
+    pe_run_step(&hover, &moved);
+    print_sp("reentered_after_moving", pe_run_step(&relative, &moved), 1);
+    printf("  },\n");
+}
+
+/* -- Pre-arena generators ---------------------------------------------------
+ * As they were before the state arena: parameters read every step, orbit
+ * bearing from atan2f. Same gains as pattern_executor.c. */
+
+#define HOVER_THRUST  37500.0f
+#define POS_P_GAIN    15.0f
+#define VEL_P_GAIN    8.0f
+#define ALT_P_GAIN    8000.0f
+#define MAX_ANGLE_DEG 25.0f
+#define THRUST_MIN    10000.0f
+#define THRUST_MAX    60000.0f
+
+static float clampf(float val, float lo, float hi) {
+    if (val < lo) return lo;
+    if (val > hi) return hi;
+    return val;
+}
+
+static float read_param(const PatternEntry* pat, uint8_t slot, float fallback) {
+    float val = pat->defaults[slot];
+    if (val == 0.0f && fallback != 0.0f) val = fallback;
+    if (pat->bounds_max[slot] > pat->bounds_min[slot])
+        val = clampf(val, pat->bounds_min[slot], pat->bounds_max[slot]);
+    return val;
+}
+
+static float compute_thrust(float current_z, float target_z) {
+    return clampf(HOVER_THRUST + ALT_P_GAIN * (target_z - current_z),
+                  THRUST_MIN, THRUST_MAX);
+}
+
+static MotorSetpoints ref_velocity_track(const SensorState* state,
+        float tgt_vx, float tgt_vy, float tgt_z, const PatternEntry* pat) {
+    MotorSetpoints sp;
+    float max_speed = read_param(pat, 0, 1.0f);
+    float spd = sqrtf(tgt_vx * tgt_vx + tgt_vy * tgt_vy);
+    if (spd > max_speed && spd > 0.001f) {
+        float s = max_speed / spd;
+        tgt_vx *= s;
+        tgt_vy *= s;
+    }
+    sp.pitch  = clampf(VEL_P_GAIN * (tgt_vx - state->velocity.x), -MAX_ANGLE_DEG, MAX_ANGLE_DEG);
+    sp.roll   = clampf(VEL_P_GAIN * (tgt_vy - state->velocity.y), -MAX_ANGLE_DEG, MAX_ANGLE_DEG);
+    sp.yaw    = 0.0f;
+    sp.thrust = compute_thrust(state->position.z, tgt_z);
+    return sp;
+}
+
+static MotorSetpoints ref_waypoint_sequence(const SensorState* state,
+        float tgt_x, float tgt_y, float tgt_z, const PatternEntry* pat) {
+    float speed = read_param(pat, 0, 0.3f);
+    float ex = tgt_x - state->position.x;
+    float ey = tgt_y - state->position.y;
+    float dist = sqrtf(ex * ex + ey * ey);
+    float dvx = 0.0f, dvy = 0.0f;
+    if (dist > 0.01f) {
+        float s = speed / dist;
+        if (dist < 0.3f) s = (speed * dist / 0.3f) / dist;
+        dvx = ex * s;
+        dvy = ey * s;
+    }
+    return ref_velocity_track(state, dvx, dvy, tgt_z, pat);
+}
+
+static MotorSetpoints ref_orbit_center(const SensorState* state,
+        float cx, float cy, float cz, const PatternEntry* pat) {
+    MotorSetpoints sp;
+    float radius = read_param(pat, 0, 0.5f);
+    float omega  = read_param(pat, 1, 0.5f);
+    float dx = state->position.x - cx;
+    float dy = state->position.y - cy;
+    float angle = atan2f(dy, dx);
+    float cur_r = sqrtf(dx * dx + dy * dy);
+    float dvx = -sinf(angle) * omega * radius;
+    float dvy =  cosf(angle) * omega * radius;
+    if (cur_r > 0.01f) {
+        float re = radius - cur_r;
+        dvx += (dx / cur_r) * re * POS_P_GAIN * 0.3f;
+        dvy += (dy / cur_r) * re * POS_P_GAIN * 0.3f;
+    }
+    sp.pitch  = clampf(VEL_P_GAIN * (dvx - state->velocity.x), -MAX_ANGLE_DEG, MAX_ANGLE_DEG);
+    sp.roll   = clampf(VEL_P_GAIN * (dvy - state->velocity.y), -MAX_ANGLE_DEG, MAX_ANGLE_DEG);
+    sp.yaw    = 0.0f;
+    sp.thrust = compute_thrust(state->position.z, cz);
+    return sp;
+}
+
+/* -- Equivalence stream ------------------------------------------------------ */
+
+static uint32_t s_rng = 0xA12E4Au;
+
+static uint32_t rng_next(void) {
+    s_rng ^= s_rng << 13;
+    s_rng ^= s_rng >> 17;
+    s_rng ^= s_rng << 5;
+    return s_rng;
+}
+
+static float rng_range(float lo, float hi) {
+    return lo + (hi - lo) * (float)(rng_next() & 0xFFFFFFu) / (float)0xFFFFFFu;
+}
+
+typedef struct {
+    int steps;
+    double attitude, thrust;
+} GenDiff;
+
+static void track(GenDiff* d, MotorSetpoints a, MotorSetpoints b) {
+    double e;
+    d->steps++;
+    e = fabs((double)a.roll - b.roll);     if (e > d->attitude) d->attitude = e;
+    e = fabs((double)a.pitch - b.pitch);   if (e > d->attitude) d->attitude = e;
+    e = fabs((double)a.thrust - b.thrust); if (e > d->thrust)   d->thrust = e;
+}
+
+static void equivalence(int steps) {
+    GenDiff waypoint = {0}, orbit = {0};
+    int near_centre = 0, i;
+    GroundCommand cmd = {0};
+    SensorState s = at(0.0f, 0.0f);
+
+    pe_run_init();
+    for (i = 0; i < steps; i++) {
+        MotorSetpoints got, want;
+        float tx, ty, tz;
+        if (i % HOLD_STEPS == 0) {
+            uint32_t pick = rng_next() % 8u;
+            /* Mostly the stateful generators, with switches through the rest */
+            cmd = command(pick < 3u ? ID_WAYPOINT : pick < 6u ? ID_ORBIT : (uint16_t)(rng_next() % 8u), 0);
+            cmd.target_pos_x = float_to_mm(rng_range(-3.0f, 3.0f));
+            cmd.target_pos_y = float_to_mm(rng_range(-3.0f, 3.0f));
+            cmd.target_pos_z = float_to_mm(rng_range(0.0f, 2.5f));
+            s.position.x = mm_to_float(cmd.target_pos_x) + rng_range(-2.0f, 2.0f);
+            s.position.y = mm_to_float(cmd.target_pos_y) + rng_range(-2.0f, 2.0f);
+            s.position.z = rng_range(0.0f, 2.5f);
+            s.velocity.x = rng_range(-2.0f, 2.0f);
+            s.velocity.y = rng_range(-2.0f, 2.0f);
+        } else {
+            s.position.x += s.velocity.x * 0.002f;
+            s.position.y += s.velocity.y * 0.002f;
+            s.velocity.x += rng_range(-0.05f, 0.05f);
+            s.velocity.y += rng_range(-0.05f, 0.05f);
+        }
+        /* Occasional emergencies deactivate and re-enter the pattern */
+        cmd.flags = (rng_next() % 100u == 0u) ? CMD_FLAG_EMERGENCY : 0u;
+
+        got = pe_run_step(&cmd, &s);
+        if (cmd.flags & CMD_FLAG_EMERGENCY) continue;
+        tx = mm_to_float(cmd.target_pos_x);
+        ty = mm_to_float(cmd.target_pos_y);
+        tz = mm_to_float(cmd.target_pos_z);
+        if (cmd.pattern_id == ID_WAYPOINT) {
+            want = ref_waypoint_sequence(&s, tx, ty, tz, &CATALOG[ID_WAYPOINT]);
+            track(&waypoint, got, want);
+        } else if (cmd.pattern_id == ID_ORBIT) {
+            float dx = s.position.x - tx, dy = s.position.y - ty;
+            /* Inside 0.01 m the arena orbit holds its last bearing by design */
+            if (sqrtf(dx * dx + dy * dy) <= 0.01f) { near_centre++; continue; }
+            want = ref_orbit_center(&s, tx, ty, tz, &CATALOG[ID_ORBIT]);
+            track(&orbit, got, want);
+        }
+    }
+
+    printf("  \"equivalence\": {\n");
+    printf("    \"steps\": %d,\n", steps);
+    printf("    \"waypoint\": {\"steps\": %d, \"attitude\": %.6g, \"thrust\": %.6g},\n",
+           waypoint.steps, waypoint.attitude, waypoint.thrust);
+    printf("    \"orbit\": {\"steps\": %d, \"attitude\": %.6g, \"thrust\": %.6g},\n",
+           orbit.steps, orbit.attitude, orbit.thrust);
+    printf("    \"orbit_near_centre_skipped\": %d\n", near_centre);
+    printf("  }\n");
+}
+
+/* -- Main ------------------------------------------------------------------- */
+
+int main(int argc, char** argv) {
+    int steps = (argc > 1) ? atoi(argv[1]) : 200000;
+    printf("{\n");
+    lifecycle_probes();
+    equivalence(steps);
+    printf("}\n");
+    return 0;
+}
@@ -0,0 +1,109 @@
+/**
+ * Health monitor: scripted control-loop timelines through health_monitor.c,
+ * decoded with the coordinator's health decoders.
+ */
+
+import { describe, it, expect, beforeAll } from 'vitest';
+import { execFileSync } from 'node:child_process';
+import {
+  findHostCompiler,
+  stageFirmware,
+  compileObject,
+  linkProgram,
+} from './host-cc.js';
+import {
+  decodeHealthPacket,
+  decodeHealthStatus,
+  type HealthReport,
+  type HealthStatus,
+} from '../../src/coordinator/comms.js';
+
+interface ScenarioOutput {
+  status: number[];
+  packet: string;
+}
+
+interface Scenario {
+  status: HealthStatus[];
+  report: HealthReport;
+}
+
+const cc = findHostCompiler();
+
+describe.skipIf(!cc)('health monitor (host)', () => {
+  const scenarios = new Map<string, Scenario>();
+
+  beforeAll(() => {
+    const dir = stageFirmware();
+    const exe = linkProgram(cc!, dir, 'health_monitor_harness.c', [
+      compileObject(cc!, dir, 'health_monitor.c'),
+    ]);
+    const out: Record<string, ScenarioOutput> = JSON.parse(
+      execFileSync(exe, { encoding: 'utf-8' }),
+    );
+    for (const [name, o] of Object.entries(out)) {
+      const report = decodeHealthPacket(Uint8Array.from(Buffer.from(o.packet, 'hex')));
+      expect(report).not.toBeNull();
+      scenarios.set(name, {
+        status: o.status.map((b) => decodeHealthStatus(b)!),
+        report: report!,
+      });
+    }
+  }, 60_000);
+
+  function quiet(s: HealthStatus): boolean {
+    return !s.overrun && !s.commandGap && s.jitterLevel === 0;
+  }
+
+  it('reports a steady loop as healthy', () => {
+    const { status, report } = scenarios.get('steady')!;
+    expect(status.every(quiet)).toBe(true);
+    expect(report.periodUs).toBe(2000);
+    expect(report.steps).toBe(200);
+    expect(report.overruns).toBe(0);
+    expect(report.commandGaps).toBe(0);
+    expect(report.jitterMaxUs).toBe(0);
+    expect(report.execMaxUs).toBe(400);
+    expect(report.commandAgeMaxMs).toBeLessThan(10);
+  });
+
+  it('latches a single overrun into exactly one telemetry byte', () => {
+    const { status, report } = scenarios.get('overrun')!;
+    expect(status.filter((s) => s.overrun)).toHaveLength(1);
+    expect(report.overruns).toBe(1);
+    expect(report.execMaxUs).toBe(3000);
+    expect(report.status.overrun).toBe(true);
+  });
+
+  it('grades late step starts as jitter', () => {
+    const { status, report } = scenarios.get('jitter')!;
+    expect(status.every((s) => s.jitterLevel === 3)).toBe(true);
+    expect(report.jitterMaxUs).toBe(700);
+    expect(report.jitterMeanUs).toBeGreaterThan(0);
+    expect(report.overruns).toBe(0);
+  });
+
+  it('separates a command gap from loop problems', () => {
+    const { status, report } = scenarios.get('cmd-gap')!;
+    expect(status.filter((s) => s.commandGap)).toHaveLength(1);
+    expect(status.some((s) => s.commandAgeMs >= 64)).toBe(true);
+    expect(status.every((s) => !s.overrun && s.jitterLevel === 0)).toBe(true);
+    expect(report.commandGaps).toBe(1);
+    expect(report.commandGapMaxMs).toBe(90);
+    expect(report.commandAgeMaxMs).toBeGreaterThanOrEqual(80);
+  });
+
+  it('saturates command age when no command has arrived', () => {
+    const { status, report } = scenarios.get('no-cmd')!;
+    expect(status.every((s) => s.commandAgeMs === 112)).toBe(true);
+    expect(report.commandAgeMaxMs).toBe(0xffff);
+    expect(report.commandGaps).toBe(0);
+  });
+
+  it('is unaffected by the µs clock wrapping', () => {
+    const steady = scenarios.get('steady')!;
+    const wrap = scenarios.get('wrap')!;
+    expect(wrap.status).toEqual(steady.status);
+    expect(wrap.report).toEqual(steady.report);
+  });
+});
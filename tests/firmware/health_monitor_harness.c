@@ -0,0 +1,85 @@
+/**
+ * Health monitor harness: replays scripted control-loop timelines through
+ * health_monitor.c and prints what the ground would receive.
+ *
+ * Scenarios (500 Hz loop, 2 ms period; 100 Hz commands, 50 ms gap limit):
+ *   steady     On-time steps, fresh commands every 10 ms
+ *   overrun    One step takes 3 ms
+ *   jitter     Every fifth step starts 700 µs late
+ *   cmd-gap    Commands stop for 80 ms, then resume
+ *   no-cmd     Steps run but no command ever arrives
+ *   wrap       Steady, with the µs clock wrapping past 2^32
+ *
+ * Prints one JSON object: per scenario, the health byte taken every 10
+ * steps (the telemetry rate) and the hex-encoded HealthPacket at the end.
+ */
+
+#include "types.h"
+#include "health_monitor.h"
+#include <stdio.h>
+#include <string.h>
+
+#define PERIOD_US    2000u
+#define CMD_EVERY_US 10000u
+#define GAP_LIMIT_US 50000u
+#define STEPS        200
+#define TELEM_EVERY  10
+
+typedef enum { SC_STEADY, SC_OVERRUN, SC_JITTER, SC_CMD_GAP, SC_NO_CMD, SC_WRAP, SC_COUNT } Scenario;
+
+static const char* const SCENARIO_NAMES[SC_COUNT] = {
+    "steady", "overrun", "jitter", "cmd-gap", "no-cmd", "wrap",
+};
+
+static void run(Scenario sc) {
+    uint32_t t0 = sc == SC_WRAP ? 0xFFFFFFFFu - 150000u : 1000000u;
+    uint32_t next_cmd = t0;
+    HealthPacket pkt;
+    const uint8_t* p = (const uint8_t*)&pkt;
+    int i;
+    size_t b;
+
+    health_monitor_init(PERIOD_US, GAP_LIMIT_US);
+    printf("\"%s\":{\"status\":[", SCENARIO_NAMES[sc]);
+
+    for (i = 0; i < STEPS; i++) {
+        uint32_t start = t0 + (uint32_t)i * PERIOD_US;
+        uint32_t exec = 400u;
+
+        if (sc == SC_JITTER && i % 5 == 4) start += 700u;
+        if (sc == SC_OVERRUN && i == 100) exec = 3000u;
+
+        /* Commands due before this step arrive first. Modular compare so
+         * the wrap scenario works. */
+        while (sc != SC_NO_CMD && (int32_t)(start - next_cmd) >= 0) {
+            int in_gap = sc == SC_CMD_GAP
+                && (int32_t)(next_cmd - (t0 + 100000u)) >= 0
+                && (int32_t)(next_cmd - (t0 + 180000u)) < 0;
+            if (!in_gap) health_monitor_command_received(next_cmd);
+            next_cmd += CMD_EVERY_US;
+        }
+
+        health_monitor_step(start, start + exec);
+
+        if (i % TELEM_EVERY == TELEM_EVERY - 1) {
+            if (i >= TELEM_EVERY) putchar(',');
+            printf("%u", health_monitor_take_status());
+        }
+    }
+
+    health_monitor_pack(&pkt);
+    printf("],\"packet\":\"");
+    for (b = 0; b < sizeof(pkt); b++) printf("%02x", p[b]);
+    printf("\"}");
+}
+
+int main(void) {
+    int sc;
+    putchar('{');
+    for (sc = 0; sc < SC_COUNT; sc++) {
+        if (sc > 0) putchar(',');
+        run((Scenario)sc);
+    }
+    printf("}\n");
+    return 0;
+}
@@ -0,0 +1,111 @@
+/**
+ * History ring: a synthetic 500 Hz flight recorded by history_ring.c,
+ * frozen by an emergency trigger and downloaded over a lossy link into
+ * the coordinator's HistoryDownload reassembler.
+ */
+
+import { describe, it, expect, beforeAll } from 'vitest';
+import { execFileSync } from 'node:child_process';
+import {
+  findHostCompiler,
+  stageFirmware,
+  compileObject,
+  linkProgram,
+} from './host-cc.js';
+import { HistoryDownload, type HistorySample } from '../../src/coordinator/comms.js';
+
+interface HistoryReport {
+  idle_packets: number;
+  trigger_seq: number;
+  frozen_after: number;
+  packets: string[];
+  dropped: number;
+  frozen_ignores: boolean;
+  after_release: number;
+  ground_trigger: number;
+}
+
+const CAPACITY = 1024;
+const POST_TRIGGER = 256;
+
+const cc = findHostCompiler();
+
+describe.skipIf(!cc)('history ring (host)', () => {
+  let report: HistoryReport;
+  let download: HistoryDownload;
+  let samples: HistorySample[];
+
+  beforeAll(() => {
+    const dir = stageFirmware();
+    const exe = linkProgram(cc!, dir, 'history_ring_harness.c', [
+      compileObject(cc!, dir, 'history_ring.c'),
+    ]);
+    report = JSON.parse(execFileSync(exe, { encoding: 'utf-8', maxBuffer: 1 << 24 }));
+    download = new HistoryDownload();
+    for (const hex of report.packets) {
+      expect(download.accept(Uint8Array.from(Buffer.from(hex, 'hex')))).toBe(true);
+    }
+    samples = download.complete ? download.samples() : [];
+  }, 60_000);
+
+  it('sends nothing while recording', () => {
+    expect(report.idle_packets).toBe(0);
+  });
+
+  it('freezes after the post-trigger tail', () => {
+    expect(report.frozen_after).toBe(POST_TRIGGER + 1);
+    const info = download.info!;
+    expect(info.trigger).toBe('emergency');
+    expect(info.periodUs).toBe(2000);
+    expect(info.sampleCount).toBe(CAPACITY);
+    expect(info.triggerIndex).toBe(CAPACITY - POST_TRIGGER - 1);
+  });
+
+  it('reassembles the full capture despite packet loss', () => {
+    expect(report.dropped).toBeGreaterThan(0);
+    expect(download.complete).toBe(true);
+    expect(download.missingChunks()).toEqual([]);
+    expect(samples).toHaveLength(CAPACITY);
+  });
+
+  it('returns samples oldest first at the recording rate', () => {
+    const firstSeq = report.trigger_seq + POST_TRIGGER + 1 - CAPACITY;
+    samples.forEach((s, i) => {
+      expect(s.setpoint.thrust).toBe(firstSeq + i);
+      expect(s.position.x).toBeCloseTo((firstSeq + i) / 1000, 3);
+    });
+    const trigger = samples[download.info!.triggerIndex]!;
+    expect(trigger.tMs).toBe(0);
+    expect(samples[0]!.tMs).toBe(-(CAPACITY - POST_TRIGGER - 1) * 2);
+  });
+
+  it('keeps quantized fields and marks NaN', () => {
+    const s = samples[0]!;
+    expect(s.position.z).toBeCloseTo(1, 3);
+    expect(s.velocity.x).toBeCloseTo(0.5, 3);
+    expect(s.orientation.x).toBeCloseTo(0.1, 3);
+    expect(s.setpoint.roll).toBeCloseTo(2.5, 2);
+    expect(s.setpoint.pitch).toBeCloseTo(-1.25, 2);
+    expect(s.setpoint.yawRate).toBeCloseTo(30, 1);
+    expect(s.battery).toBeCloseTo(0.75, 2);
+    expect(s.sensorFlags).toBe(0b11);
+    expect(samples[download.info!.triggerIndex]!.orientation.x).toBeNaN();
+  });
+
+  it('holds the capture while frozen and resumes on release', () => {
+    expect(report.frozen_ignores).toBe(true);
+    expect(report.after_release).toBe(0);
+    expect(report.ground_trigger).toBe(3);
+  });
+
+  it('starts over when a new capture ID arrives', () => {
+    const d = new HistoryDownload();
+    d.accept(Uint8Array.from(Buffer.from(report.packets[0]!, 'hex')));
+    expect(d.info).not.toBeNull();
+    const other = Uint8Array.from(Buffer.from(report.packets[1]!, 'hex'));
+    other[1] = (other[1]! + 1) & 0xff;  // chunk from a later capture
+    d.accept(other);
+    expect(d.info).toBeNull();
+    expect(d.accept(new Uint8Array([0x02, 0x80]))).toBe(false);
+  });
+});
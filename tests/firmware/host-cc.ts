@@ -0,0 +1,129 @@
+/**
+ * Host C toolchain helpers for firmware tests.
+ *
+ * The firmware targets arm-none-eabi-gcc, but everything under src/firmware
+ * is plain C99 and builds with the host compiler too. These helpers stage
+ * the firmware sources into a scratch directory (optionally swapping in a
+ * fixture catalog_data.h — quoted includes resolve next to the including
+ * file, so -I cannot override it) and compile host test programs.
+ *
+ * Tests skip when no host compiler is available ($CC, default `cc`).
+ */
+
+import { execFileSync, spawnSync } from 'node:child_process';
+import { copyFileSync, mkdtempSync, readdirSync } from 'node:fs';
+import { tmpdir } from 'node:os';
+import { join, resolve } from 'node:path';
+
+export const REPO_ROOT = resolve(import.meta.dirname ?? '.', '../..');
+export const FIRMWARE_DIR = join(REPO_ROOT, 'src/firmware');
+export const FIRMWARE_TESTS_DIR = join(REPO_ROOT, 'tests/firmware');
+
+const HOST_CFLAGS = ['-std=c99', '-O2', '-Wall', '-Wextra', '-Werror'];
+
+/** Host C compiler, or null if none is installed. */
+export function findHostCompiler(): string | null {
+  const cc = process.env['CC'] ?? 'cc';
+  const probe = spawnSync(cc, ['--version'], { stdio: 'ignore' });
+  return probe.status === 0 ? cc : null;
+}
+
+/**
+ * Copy src/firmware into a fresh scratch directory and return its path.
+ * `catalogFixture` (a file under tests/firmware/fixtures) replaces the
+ * shipped catalog_data.h.
+ */
+export function stageFirmware(catalogFixture?: string): string {
+  const dir = mkdtempSync(join(tmpdir(), 'seshat-fw-'));
+  for (const f of readdirSync(FIRMWARE_DIR)) {
+    if (f.endsWith('.c') || f.endsWith('.h')) {
+      copyFileSync(join(FIRMWARE_DIR, f), join(dir, f));
+    }
+  }
+  if (catalogFixture) {
+    copyFileSync(
+      join(FIRMWARE_TESTS_DIR, 'fixtures', catalogFixture),
+      join(dir, 'catalog_data.h'),
+    );
+  }
+  return dir;
+}
+
+/** Public symbols of the sources compileRenamed can build more than once. */
+const RENAMABLE: Record<string, { stem: string; fns: string[] }> = {
+  'pattern_executor.c': {
+    stem: 'pattern_executor_',
+    fns: ['init', 'step', 'active_pattern', 'set_leader'],
+  },
+  'neighbor_table.c': {
+    stem: 'neighbor_',
+    fns: ['table_init', 'pack_state', 'table_pack_self', 'table_receive',
+          'table_count', 'table_find', 'table_predict', 'separation_guard'],
+  },
+};
+
+/**
+ * Compile one firmware translation unit to an object with its public
+ * symbols renamed from `<stem>*` to `<prefix>_*` (`pattern_executor_step`
+ * → `pe_float_step`, `neighbor_table_init` → `n0_table_init`), so several
+ * builds or instances of the same file can be linked into one program.
+ */
+export function compileRenamed(
+  cc: string,
+  stageDir: string,
+  source: string,
+  prefix: string,
+  defines: string[] = [],
+): string {
+  const obj = join(stageDir, `${prefix}.o`);
+  const { stem, fns } = RENAMABLE[source]!;
+  const renames = fns.map((fn) => `-D${stem}${fn}=${prefix}_${fn}`);
+  execFileSync(cc, [
+    ...HOST_CFLAGS,
+    ...renames,
+    ...defines.map((d) => `-D${d}`),
+    '-c', join(stageDir, source),
+    '-o', obj,
+  ]);
+  return obj;
+}
+
+/** Compile one staged firmware translation unit to an object. */
+export function compileObject(
+  cc: string,
+  stageDir: string,
+  source: string,
+  defines: string[] = [],
+): string {
+  const obj = join(stageDir, source.replace(/\.c$/, '.o'));
+  execFileSync(cc, [
+    ...HOST_CFLAGS,
+    '-D_POSIX_C_SOURCE=199309L',
+    ...defines.map((d) => `-D${d}`),
+    '-c', join(stageDir, source),
+    '-o', obj,
+  ]);
+  return obj;
+}
+
+/** Link a host test program from tests/firmware against staged objects. */
+export function linkProgram(
+  cc: string,
+  stageDir: string,
+  harness: string,
+  objects: string[],
+  defines: string[] = [],
+): string {
+  const exe = join(stageDir, harness.replace(/\.c$/, ''));
+  execFileSync(cc, [
+    ...HOST_CFLAGS,
+    '-D_POSIX_C_SOURCE=199309L',
+    ...defines.map((d) => `-D${d}`),
+    `-I${stageDir}`,
+    join(FIRMWARE_TESTS_DIR, harness),
+    ...objects,
+    '-lm',
+    '-o', exe,
+  ]);
+  return exe;
+}
@@ -0,0 +1,87 @@
+/**
+ * Peer-to-peer neighbor table: three drones, each with its own build of
+ * neighbor_table.c, broadcasting over a lossy simulated P2P channel
+ * (p2p_medium.h) while the separation guard pre-empts their generators.
+ */
+
+import { describe, it, expect, beforeAll } from 'vitest';
+import { execFileSync } from 'node:child_process';
+import {
+  findHostCompiler,
+  stageFirmware,
+  compileRenamed,
+  linkProgram,
+} from './host-cc.js';
+
+interface FlightOutput {
+  min_dist: number;
+  guard_steps: number[];
+}
+
+interface SimReport {
+  head_on: FlightOutput & { lost: number; sent: number };
+  unguarded: FlightOutput;
+  converge: FlightOutput;
+  age_out: { heard: number; silent_ms: number };
+  table: Record<string, number>;
+}
+
+/** NEIGHBOR_DEFAULTS */
+const MIN_SEPARATION_M = 0.35;
+const MAX_AGE_MS = 300;
+/** Broadcast period plus channel latency in the age_out scenario. */
+const AGE_OUT_SLACK_MS = 20 + 20;
+
+const cc = findHostCompiler();
+
+describe.skipIf(!cc)('P2P neighbor table (host)', () => {
+  let report: SimReport;
+
+  beforeAll(() => {
+    const dir = stageFirmware();
+    const objects = ['n0', 'n1', 'n2'].map((p) => compileRenamed(cc!, dir, 'neighbor_table.c', p));
+    const exe = linkProgram(cc!, dir, 'p2p_sim_harness.c', objects);
+    report = JSON.parse(execFileSync(exe, { encoding: 'utf-8' }));
+  }, 60_000);
+
+  it('keeps two drones on a head-on course apart over a lossy link', () => {
+    expect(report.unguarded.min_dist).toBeLessThan(0.1);
+    expect(report.head_on.lost).toBeGreaterThan(0);
+    expect(report.head_on.min_dist).toBeGreaterThan(MIN_SEPARATION_M);
+    for (const steps of report.head_on.guard_steps) expect(steps).toBeGreaterThan(0);
+  });
+
+  it('keeps three converging drones apart at 30 % loss and 40 ms latency', () => {
+    expect(report.converge.min_dist).toBeGreaterThan(MIN_SEPARATION_M * 0.9);
+    for (const steps of report.converge.guard_steps) expect(steps).toBeGreaterThan(0);
+  });
+
+  it('ages out a neighbour that goes silent', () => {
+    expect(report.age_out.heard).toBe(1);
+    expect(report.age_out.silent_ms).toBeGreaterThan(MAX_AGE_MS);
+    expect(report.age_out.silent_ms).toBeLessThanOrEqual(MAX_AGE_MS + AGE_OUT_SLACK_MS);
+  });
+
+  it('ignores its own ID, stale sequence numbers and foreign packets', () => {
+    const t = report.table;
+    expect(t['packet']).toBe(16);
+    expect(t['own']).toBe(0);
+    expect(t['fresh']).toBe(1);
+    expect(t['stale']).toBe(0);
+    expect(t['repeat']).toBe(0);
+    expect(t['wrapped']).toBe(1);
+    expect(t['bad_kind']).toBe(0);
+    expect(t['short']).toBe(0);
+  });
+
+  it('keeps the nearest neighbours when full', () => {
+    const t = report.table;
+    expect(t['full']).toBe(t['size']);
+    expect(t['nearer']).toBe(1);
+    expect(t['farther']).toBe(0);
+    expect(t['has_50']).toBe(1);
+    expect(t['has_9']).toBe(1);
+    expect(t['has_25']).toBe(1);
+    expect(t['has_26']).toBe(0);
+  });
+});
@@ -0,0 +1,105 @@
+/**
+ * Host stand-in for the Crazyflie P2P broadcast channel.
+ *
+ * Every broadcast is copied to each other node with its own loss draw
+ * and delivered after a fixed latency, so receivers see independent
+ * gaps as they would on the air. Header-only; include from a harness.
+ *
+ * Usage:
+ *   P2pMedium m;
+ *   p2p_medium_init(&m, 3, 20000, 200, 1);       // 3 nodes, 20 ms, 20 % loss
+ *   p2p_medium_broadcast(&m, 0, &pkt, sizeof(pkt), now_us);
+ *   while ((len = p2p_medium_poll(&m, 1, now_us, buf)) > 0) ...
+ */
+
+#ifndef SESHAT_SWARM_P2P_MEDIUM_H
+#define SESHAT_SWARM_P2P_MEDIUM_H
+
+#include <stdint.h>
+#include <string.h>
+
+#define P2P_MEDIUM_MAX_FRAMES  256u
+#define P2P_MEDIUM_MAX_PAYLOAD 60u   /* Crazyflie P2P payload limit */
+
+typedef struct {
+    uint8_t  to;
+    uint8_t  len;
+    uint32_t deliver_us;
+    uint8_t  data[P2P_MEDIUM_MAX_PAYLOAD];
+} P2pFrame;
+
+typedef struct {
+    uint8_t  nodes;
+    uint32_t latency_us;
+    uint16_t loss_permille;
+    uint32_t rng;
+    uint16_t count;
+    P2pFrame frames[P2P_MEDIUM_MAX_FRAMES];
+    uint32_t sent;             /* Frames offered to receivers           */
+    uint32_t lost;             /* ... of which dropped                  */
+} P2pMedium;
+
+static inline void p2p_medium_init(P2pMedium* m, uint8_t nodes, uint32_t latency_us,
+                                   uint16_t loss_permille, uint32_t seed) {
+    memset(m, 0, sizeof(*m));
+    m->nodes = nodes;
+    m->latency_us = latency_us;
+    m->loss_permille = loss_permille;
+    m->rng = seed ? seed : 1u;
+}
+
+/** Change loss mid-run, e.g. 1000 to silence the channel. */
+static inline void p2p_medium_set_loss(P2pMedium* m, uint16_t loss_permille) {
+    m->loss_permille = loss_permille;
+}
+
+static inline uint32_t p2p_medium_rand(P2pMedium* m) {
+    /* xorshift32 */
+    m->rng ^= m->rng << 13;
+    m->rng ^= m->rng >> 17;
+    m->rng ^= m->rng << 5;
+    return m->rng;
+}
+
+/** Broadcast from `from` to every other node. Frames beyond the queue are lost. */
+static inline void p2p_medium_broadcast(P2pMedium* m, uint8_t from, const void* data,
+                                        uint8_t len, uint32_t now_us) {
+    uint8_t to;
+    if (len > P2P_MEDIUM_MAX_PAYLOAD) return;
+    for (to = 0; to < m->nodes; to++) {
+        P2pFrame* f;
+        if (to == from) continue;
+        m->sent++;
+        if (p2p_medium_rand(m) % 1000u < m->loss_permille || m->count >= P2P_MEDIUM_MAX_FRAMES) {
+            m->lost++;
+            continue;
+        }
+        f = &m->frames[m->count++];
+        f->to = to;
+        f->len = len;
+        f->deliver_us = now_us + m->latency_us;
+        memcpy(f->data, data, len);
+    }
+}
+
+/**
+ * Take the oldest frame due for `to` by `now_us` into `buf` (at least
+ * P2P_MEDIUM_MAX_PAYLOAD bytes). Returns its length, or 0 if none is due.
+ */
+static inline uint8_t p2p_medium_poll(P2pMedium* m, uint8_t to, uint32_t now_us,
+                                      uint8_t* buf) {
+    uint16_t i;
+    for (i = 0; i < m->count; i++) {
+        P2pFrame* f = &m->frames[i];
+        uint8_t len;
+        if (f->to != to || (int32_t)(now_us - f->deliver_us) < 0) continue;
+        len = f->len;
+        memcpy(buf, f->data, len);
+        memmove(f, f + 1, (size_t)(m->count - i - 1) * sizeof(*f));
+        m->count--;
+        return len;
+    }
+    return 0;
+}
+
+#endif /* SESHAT_SWARM_P2P_MEDIUM_H */
@@ -0,0 +1,283 @@
+/**
+ * P2P simulation harness: three drones, each with its own build of
+ * neighbor_table.c (n0_*, n1_*, n2_*), fly point-mass dynamics at 500 Hz
+ * and broadcast PeerStatePackets at 50 Hz over p2p_medium.h.
+ *
+ * Each drone's nominal generator flies at up to 0.8 m/s toward a goal,
+ * with the executor's velocity-to-attitude gain; the separation guard
+ * runs after it, as in the firmware control loop.
+ *
+ * Scenarios:
+ *   head_on     Drones 0 and 1 swap places along x; 20 ms, 10 % loss
+ *   unguarded   The same without the guard
+ *   converge    All three head for one point from 120° apart; 40 ms, 30 % loss
+ *   age_out     Drone 1 hovers beside drone 0, then the channel goes silent
+ *   table       Direct table checks on drone 0 (own ID, seq order, capacity)
+ *
+ * Prints one JSON object with one member per scenario.
+ */
+
+#include "types.h"
+#include "neighbor_table.h"
+#include "p2p_medium.h"
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#define DRONES        3
+#define STEP_US       2000u
+#define BROADCAST_US  20000u
+#define GRAVITY       9.81f
+#define DRAG          0.5f    /* 1/s */
+#define CRUISE        0.8f    /* m/s */
+#define VEL_GAIN      8.0f    /* deg per m/s, as pattern_executor.c */
+#define MAX_ANGLE     25.0f
+#define DEG2RAD       0.017453292f
+
+/* -- Per-drone builds --------------------------------------------------- */
+
+#define DECLARE_NEIGHBOR_API(p)                                                     \
+    void p##_table_init(uint8_t self_id, const NeighborConfig* cfg);                \
+    void p##_table_pack_self(const SensorState* s, uint8_t f, PeerStatePacket* o);  \
+    int p##_table_receive(const uint8_t* buf, uint16_t len, uint32_t now_us);       \
+    uint8_t p##_table_count(uint32_t now_us);                                       \
+    int p##_table_find(uint8_t id, uint32_t now_us, Neighbor* out);                 \
+    int p##_separation_guard(const SensorState* s, uint32_t now_us, MotorSetpoints* sp);
+DECLARE_NEIGHBOR_API(n0)
+DECLARE_NEIGHBOR_API(n1)
+DECLARE_NEIGHBOR_API(n2)
+void n0_pack_state(uint8_t id, uint8_t seq, uint8_t flags,
+                   const SensorState* s, PeerStatePacket* out);
+
+typedef struct {
+    void (*init)(uint8_t, const NeighborConfig*);
+    void (*pack_self)(const SensorState*, uint8_t, PeerStatePacket*);
+    int (*receive)(const uint8_t*, uint16_t, uint32_t);
+    uint8_t (*count)(uint32_t);
+    int (*find)(uint8_t, uint32_t, Neighbor*);
+    int (*guard)(const SensorState*, uint32_t, MotorSetpoints*);
+} NeighborApi;
+
+#define NEIGHBOR_API(p) { p##_table_init, p##_table_pack_self, p##_table_receive, \
+                          p##_table_count, p##_table_find, p##_separation_guard }
+static const NeighborApi API[DRONES] = { NEIGHBOR_API(n0), NEIGHBOR_API(n1), NEIGHBOR_API(n2) };
+
+/* -- Simulation --------------------------------------------------------- */
+
+typedef struct {
+    SensorState s;
+    Vec3 goal;
+    int active;
+    uint32_t guard_steps;
+} Drone;
+
+static Drone s_drones[DRONES];
+static P2pMedium s_medium;
+
+static float clampf(float v, float lo, float hi) {
+    return v < lo ? lo : (v > hi ? hi : v);
+}
+
+static void place(int i, float x, float y, float gx, float gy) {
+    Drone* d = &s_drones[i];
+    memset(d, 0, sizeof(*d));
+    d->s.position.x = x;
+    d->s.position.y = y;
+    d->s.position.z = 1.0f;
+    d->goal.x = gx;
+    d->goal.y = gy;
+    d->goal.z = 1.0f;
+    d->active = 1;
+    API[i].init((uint8_t)(i + 1), NULL);
+}
+
+/** Velocity track toward the goal, slowing inside 0.3 m. */
+static MotorSetpoints nominal(const Drone* d) {
+    MotorSetpoints sp;
+    float ex = d->goal.x - d->s.position.x;
+    float ey = d->goal.y - d->s.position.y;
+    float dist = sqrtf(ex * ex + ey * ey);
+    float speed = dist < 0.3f ? CRUISE * dist / 0.3f : CRUISE;
+    float vx = dist > 0.01f ? ex / dist * speed : 0.0f;
+    float vy = dist > 0.01f ? ey / dist * speed : 0.0f;
+    sp.pitch = clampf(VEL_GAIN * (vx - d->s.velocity.x), -MAX_ANGLE, MAX_ANGLE);
+    sp.roll  = clampf(VEL_GAIN * (vy - d->s.velocity.y), -MAX_ANGLE, MAX_ANGLE);
+    sp.yaw = 0.0f;
+    sp.thrust = 37500.0f;
+    return sp;
+}
+
+static void integrate(Drone* d, const MotorSetpoints* sp) {
+    float dt = (float)STEP_US * 1e-6f;
+    float ax = GRAVITY * tanf(sp->pitch * DEG2RAD) - DRAG * d->s.velocity.x;
+    float ay = GRAVITY * tanf(sp->roll * DEG2RAD) - DRAG * d->s.velocity.y;
+    d->s.velocity.x += ax * dt;
+    d->s.velocity.y += ay * dt;
+    d->s.position.x += d->s.velocity.x * dt;
+    d->s.position.y += d->s.velocity.y * dt;
+}
+
+static float separation(int a, int b) {
+    float dx = s_drones[a].s.position.x - s_drones[b].s.position.x;
+    float dy = s_drones[a].s.position.y - s_drones[b].s.position.y;
+    return sqrtf(dx * dx + dy * dy);
+}
+
+/** Run `steps` control steps from `*now`; returns the minimum pairwise distance. */
+static float run(uint32_t* now, int steps, int guarded) {
+    float min_dist = 1e9f;
+    uint8_t buf[P2P_MEDIUM_MAX_PAYLOAD];
+    int k, i, j;
+
+    for (k = 0; k < steps; k++) {
+        for (i = 0; i < DRONES; i++) {
+            Drone* d = &s_drones[i];
+            MotorSetpoints sp;
+            uint8_t len;
+            if (!d->active) continue;
+
+            while ((len = p2p_medium_poll(&s_medium, (uint8_t)i, *now, buf)) > 0) {
+                API[i].receive(buf, len, *now);
+            }
+            /* Stagger the broadcasts so drones do not transmit in lockstep. */
+            if ((*now + (uint32_t)i * 6000u) % BROADCAST_US == 0) {
+                PeerStatePacket pkt;
+                API[i].pack_self(&d->s, TELEM_FLAG_AIRBORNE, &pkt);
+                p2p_medium_broadcast(&s_medium, (uint8_t)i, &pkt, sizeof(pkt), *now);
+            }
+
+            sp = nominal(d);
+            if (guarded && API[i].guard(&d->s, *now, &sp)) d->guard_steps++;
+            integrate(d, &sp);
+        }
+        for (i = 0; i < DRONES; i++) {
+            for (j = i + 1; j < DRONES; j++) {
+                if (s_drones[i].active && s_drones[j].active && separation(i, j) < min_dist) {
+                    min_dist = separation(i, j);
+                }
+            }
+        }
+        *now += STEP_US;
+    }
+    return min_dist;
+}
+
+/* -- Scenarios ---------------------------------------------------------- */
+
+static void head_on(int guarded) {
+    uint32_t now = 0;
+    float min_dist;
+    p2p_medium_init(&s_medium, 2, 20000u, 100, 7);
+    place(0, -1.5f, 0.02f, 1.5f, 0.02f);
+    place(1, 1.5f, -0.02f, -1.5f, -0.02f);
+    s_drones[2].active = 0;
+    min_dist = run(&now, 3000, guarded);
+    printf("{\"min_dist\":%.4f,\"guard_steps\":[%u,%u],\"lost\":%u,\"sent\":%u}",
+           min_dist, s_drones[0].guard_steps, s_drones[1].guard_steps,
+           s_medium.lost, s_medium.sent);
+}
+
+static void converge(void) {
+    uint32_t now = 0;
+    float min_dist;
+    int i;
+    p2p_medium_init(&s_medium, DRONES, 40000u, 300, 11);
+    for (i = 0; i < DRONES; i++) {
+        float a = (float)i * 2.0943951f;
+        place(i, 1.5f * cosf(a), 1.5f * sinf(a), 0.0f, 0.0f);
+    }
+    min_dist = run(&now, 4000, 1);
+    printf("{\"min_dist\":%.4f,\"guard_steps\":[%u,%u,%u]}", min_dist,
+           s_drones[0].guard_steps, s_drones[1].guard_steps, s_drones[2].guard_steps);
+}
+
+static void age_out(void) {
+    uint32_t now = 0;
+    uint32_t silent_at, gone_at = 0;
+    uint8_t heard;
+    p2p_medium_init(&s_medium, 2, 20000u, 0, 3);
+    place(0, 0.0f, 0.0f, 0.0f, 0.0f);
+    place(1, 1.0f, 0.0f, 1.0f, 0.0f);
+    s_drones[2].active = 0;
+    run(&now, 500, 1);
+    heard = API[0].count(now);
+
+    p2p_medium_set_loss(&s_medium, 1000);
+    silent_at = now;
+    while (now - silent_at < 1000000u) {
+        run(&now, 1, 1);
+        if (!gone_at && API[0].count(now) == 0) gone_at = now;
+    }
+    printf("{\"heard\":%u,\"silent_ms\":%u}", heard,
+           gone_at ? (gone_at - silent_at) / 1000u : 0u);
+}
+
+static void table(void) {
+    SensorState s;
+    PeerStatePacket pkt;
+    Neighbor n;
+    int own, fresh, stale, repeat, wrapped, nearer, farther, bad_kind, short_len;
+    uint8_t full;
+    int i;
+
+    memset(&s, 0, sizeof(s));
+    n0_table_init(1, NULL);
+    n0_table_pack_self(&s, 0, &pkt);           /* Own position at the origin */
+
+    own = n0_table_receive((const uint8_t*)&pkt, sizeof(pkt), 0);
+    s.position.x = 2.0f;
+    n0_pack_state(9, 10, 0, &s, &pkt);
+    fresh = n0_table_receive((const uint8_t*)&pkt, sizeof(pkt), 0);
+    n0_pack_state(9, 9, 0, &s, &pkt);
+    stale = n0_table_receive((const uint8_t*)&pkt, sizeof(pkt), 0);
+    n0_pack_state(9, 10, 0, &s, &pkt);
+    repeat = n0_table_receive((const uint8_t*)&pkt, sizeof(pkt), 0);
+    n0_pack_state(9, 130, 0, &s, &pkt);
+    n0_table_receive((const uint8_t*)&pkt, sizeof(pkt), 0);
+    n0_pack_state(9, 250, 0, &s, &pkt);
+    n0_table_receive((const uint8_t*)&pkt, sizeof(pkt), 0);
+    n0_pack_state(9, 0, 0, &s, &pkt);
+    wrapped = n0_table_receive((const uint8_t*)&pkt, sizeof(pkt), 0);
+    pkt.kind = 0x7F;
+    bad_kind = n0_table_receive((const uint8_t*)&pkt, sizeof(pkt), 0);
+    pkt.kind = P2P_PACKET_STATE;
+    short_len = n0_table_receive((const uint8_t*)&pkt, sizeof(pkt) - 1, 0);
+
+    /* Peer 9 sits at 2 m; peers 20.. at 1 m, 2 m, ... fill the rest, so
+     * with 8 slots peer 26 (7 m) is the farthest kept. */
+    for (i = 0; i < (int)NEIGHBOR_TABLE_SIZE + 2; i++) {
+        s.position.x = 1.0f + (float)i;
+        n0_pack_state((uint8_t)(20 + i), 0, 0, &s, &pkt);
+        n0_table_receive((const uint8_t*)&pkt, sizeof(pkt), 0);
+    }
+    full = n0_table_count(0);
+    s.position.x = 0.5f;
+    n0_pack_state(50, 0, 0, &s, &pkt);
+    nearer = n0_table_receive((const uint8_t*)&pkt, sizeof(pkt), 0);
+    s.position.x = 30.0f;
+    n0_pack_state(51, 0, 0, &s, &pkt);
+    farther = n0_table_receive((const uint8_t*)&pkt, sizeof(pkt), 0);
+
+    printf("{\"own\":%d,\"fresh\":%d,\"stale\":%d,\"repeat\":%d,\"wrapped\":%d,"
+           "\"bad_kind\":%d,\"short\":%d,\"full\":%u,\"nearer\":%d,\"farther\":%d,"
+           "\"has_50\":%d,\"has_9\":%d,\"has_25\":%d,\"has_26\":%d,\"size\":%u,\"packet\":%u}",
+           own, fresh, stale, repeat, wrapped, bad_kind, short_len, full,
+           nearer, farther, n0_table_find(50, 0, &n), n0_table_find(9, 0, &n),
+           n0_table_find(25, 0, &n), n0_table_find(26, 0, &n),
+           NEIGHBOR_TABLE_SIZE, (unsigned)sizeof(PeerStatePacket));
+}
+
+int main(void) {
+    printf("{\"head_on\":");
+    head_on(1);
+    printf(",\"unguarded\":");
+    head_on(0);
+    printf(",\"converge\":");
+    converge();
+    printf(",\"age_out\":");
+    age_out();
+    printf(",\"table\":");
+    table();
+    printf("}\n");
+    return 0;
+}
@@ -0,0 +1,81 @@
+/**
+ * Per-pattern usage: a scripted flight through pattern_stats.c, dumped
+ * round-robin and collected by the coordinator's PatternUsageCollector.
+ */
+
+import { describe, it, expect, beforeAll } from 'vitest';
+import { execFileSync } from 'node:child_process';
+import {
+  findHostCompiler,
+  stageFirmware,
+  compileObject,
+  linkProgram,
+} from './host-cc.js';
+import {
+  PatternUsageCollector,
+  decodePatternStatsPacket,
+  PATTERN_STATS_PACKET_SIZE,
+} from '../../src/coordinator/comms.js';
+
+interface StatsReport {
+  size: number;
+  packets: (string | null)[];
+  empty: number;
+}
+
+const hex = (s: string): Uint8Array => Uint8Array.from(Buffer.from(s, 'hex'));
+
+const cc = findHostCompiler();
+
+describe.skipIf(!cc)('per-pattern usage statistics (host)', () => {
+  let report: StatsReport;
+
+  beforeAll(() => {
+    const dir = stageFirmware();
+    const exe = linkProgram(cc!, dir, 'pattern_stats_harness.c', [
+      compileObject(cc!, dir, 'pattern_stats.c'),
+    ]);
+    report = JSON.parse(execFileSync(exe, { encoding: 'utf-8' }));
+  }, 60_000);
+
+  it('agrees with the firmware on the packet size', () => {
+    expect(report.size).toBe(PATTERN_STATS_PACKET_SIZE);
+  });
+
+  it('dumps only flown, tracked patterns, round-robin', () => {
+    const ids = report.packets.map((p) => decodePatternStatsPacket(hex(p!))!.patternId);
+    expect(ids).toEqual([3, 7, 3]);
+    expect(report.empty).toBe(0);
+  });
+
+  it('accumulates time, energy and entries per pattern', () => {
+    const [hover, cruise] = report.packets.map((p) => decodePatternStatsPacket(hex(p!))!);
+    expect(hover!.entries).toBe(2);
+    expect(hover!.timeS).toBeCloseTo(2.5, 3);
+    expect(hover!.energyJ).toBeCloseTo(15, 2);
+    expect(cruise!.entries).toBe(1);
+    expect(cruise!.timeS).toBeCloseTo(1.0, 3);
+    expect(cruise!.energyJ).toBeCloseTo(9, 2);
+  });
+
+  it('keeps peak speed and peak roll/pitch command', () => {
+    const [hover, cruise] = report.packets.map((p) => decodePatternStatsPacket(hex(p!))!);
+    expect(hover!.peakSpeed).toBeCloseTo(0.05, 3);
+    expect(hover!.peakAttitudeDeg).toBeCloseTo(15, 2);
+    expect(cruise!.peakSpeed).toBeCloseTo(2.0, 3);
+    expect(cruise!.peakAttitudeDeg).toBeCloseTo(12, 2);
+  });
+
+  it('builds a dump keyed by string pattern ID', () => {
+    const c = new PatternUsageCollector();
+    for (const p of report.packets) expect(c.accept('cf-1', hex(p!))).toBe(true);
+    expect(c.accept('cf-1', new Uint8Array(PATTERN_STATS_PACKET_SIZE))).toBe(false);
+    expect(c.usageFor('cf-1')).toHaveLength(2);
+
+    const dump = c.dump('cf-1', new Map([['hover-stable', 3]]));
+    expect(dump.droneId).toBe('cf-1');
+    expect(Object.keys(dump.patterns)).toEqual(['hover-stable']);
+    expect(dump.patterns['hover-stable']!.time_s).toBeCloseTo(2.5, 3);
+    expect(dump.patterns['hover-stable']!.peak_attitude_deg).toBeCloseTo(15, 2);
+  });
+});
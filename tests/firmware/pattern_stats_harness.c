@@ -0,0 +1,71 @@
+/**
+ * Pattern stats harness: flies a scripted sequence through
+ * pattern_stats.c at 500 Hz and dumps every packet the round-robin
+ * emits, so the ground-side decoder can be checked against known totals.
+ *
+ * Script (2 ms steps):
+ *   pattern 3  2.0 s  hover, 6 W, |v| = 0.05 m/s, 2° tilt
+ *   pattern 7  1.0 s  cruise, 9 W, v = (1.2, -1.6, 0) → 2.0 m/s, 12° pitch
+ *   none       0.5 s  (PATTERN_ID_INVALID, not counted)
+ *   pattern 3  0.5 s  hover again, -15° roll spike on one step
+ *   pattern 300      (beyond capacity, not counted)
+ *
+ * Prints one JSON object:
+ *   packets   Hex-encoded packets from 3 consecutive next_packet calls
+ *   empty     next_packet result after pattern_stats_init()
+ */
+
+#include "types.h"
+#include "pattern_stats.h"
+#include "telemetry_reporter.h"
+#include <stdio.h>
+#include <string.h>
+
+#define STEP_US 2000u
+
+static void fly(uint16_t id, float watts, float vx, float vy,
+                float roll, float pitch, int steps) {
+    SensorState st;
+    MotorSetpoints sp;
+    int i;
+
+    memset(&st, 0, sizeof(st));
+    memset(&sp, 0, sizeof(sp));
+    st.discharge_rate = watts;
+    st.velocity.x = vx;
+    st.velocity.y = vy;
+    sp.roll = roll;
+    sp.pitch = pitch;
+    for (i = 0; i < steps; i++) pattern_stats_step(id, &st, &sp, STEP_US);
+}
+
+static void print_packet(const PatternStatsPacket* pkt) {
+    const uint8_t* b = (const uint8_t*)pkt;
+    size_t i;
+    putchar('"');
+    for (i = 0; i < sizeof(*pkt); i++) printf("%02x", b[i]);
+    putchar('"');
+}
+
+int main(void) {
+    PatternStatsPacket pkt;
+    int i;
+
+    pattern_stats_init();
+    fly(3, 6.0f, 0.03f, 0.04f, 1.0f, -2.0f, 1000);
+    fly(7, 9.0f, 1.2f, -1.6f, 0.0f, 12.0f, 500);
+    fly(PATTERN_ID_INVALID, 5.0f, 0.0f, 0.0f, 0.0f, 0.0f, 250);
+    fly(3, 6.0f, 0.03f, 0.04f, -15.0f, 0.0f, 1);
+    fly(3, 6.0f, 0.03f, 0.04f, 1.0f, -2.0f, 249);
+    fly(300, 50.0f, 9.0f, 0.0f, 45.0f, 0.0f, 100);
+
+    printf("{\"size\":%u,\"packets\":[", (unsigned)sizeof(pkt));
+    for (i = 0; i < 3; i++) {
+        if (i > 0) putchar(',');
+        if (pattern_stats_next_packet(&pkt)) print_packet(&pkt);
+        else printf("null");
+    }
+    pattern_stats_init();
+    printf("],\"empty\":%d}\n", pattern_stats_next_packet(&pkt));
+    return 0;
+}
@@ -0,0 +1,78 @@
+/**
+ * Perf probes: the control path built with -DSESHAT_PERF_PROBES, drained
+ * through the diagnostics channel and decoded by the coordinator.
+ */
+
+import { describe, it, expect, beforeAll } from 'vitest';
+import { execFileSync } from 'node:child_process';
+import {
+  findHostCompiler,
+  stageFirmware,
+  compileObject,
+  linkProgram,
+} from './host-cc.js';
+import {
+  decodeDiagnosticsPacket,
+  PERF_PROBE_NAMES,
+  type ProbeDiagnostics,
+} from '../../src/coordinator/comms.js';
+
+interface ProbeReport {
+  loops: number;
+  packets: string[];
+  after_reset: number;
+}
+
+const LOOPS = 1600;
+const PROBES = ['SESHAT_PERF_PROBES'];
+
+const cc = findHostCompiler();
+
+describe.skipIf(!cc)('perf probes (host)', () => {
+  let report: ProbeReport;
+  let probes: ProbeDiagnostics[];
+
+  beforeAll(() => {
+    const dir = stageFirmware('catalog_data.h');
+    const objects = [
+      'pattern_executor.c', 'command_parser.c', 'telemetry_reporter.c', 'event_queue.c',
+      'perf_probes.c',
+    ].map((src) => compileObject(cc!, dir, src, PROBES));
+    const exe = linkProgram(cc!, dir, 'perf_probes_harness.c', objects, PROBES);
+    report = JSON.parse(execFileSync(exe, [String(LOOPS)], { encoding: 'utf-8' }));
+    probes = report.packets.map((hex) => {
+      const d = decodeDiagnosticsPacket(Uint8Array.from(Buffer.from(hex, 'hex')));
+      expect(d).not.toBeNull();
+      return d!;
+    });
+  }, 60_000);
+
+  it('reports every probe once per round-robin cycle', () => {
+    expect(probes.map((p) => p.probe).sort()).toEqual([...PERF_PROBE_NAMES].sort());
+  });
+
+  it('counts one sample per call site', () => {
+    const byName = new Map(probes.map((p) => [p.probe, p]));
+    expect(byName.get('command-parse')!.count).toBe(LOOPS);
+    expect(byName.get('catalog-lookup')!.count).toBe(LOOPS);
+    expect(byName.get('telemetry-pack')!.count).toBe(LOOPS);
+    const generatorSamples = probes
+      .filter((p) => p.probe.startsWith('gen:'))
+      .reduce((sum, p) => sum + p.count, 0);
+    expect(generatorSamples).toBe(LOOPS);
+  });
+
+  it('keeps min <= mean <= max and a histogram summing to one', () => {
+    for (const p of probes) {
+      expect(p.minUs).toBeLessThanOrEqual(p.meanUs);
+      expect(p.meanUs).toBeLessThanOrEqual(p.maxUs);
+      const total = p.histogram.reduce((a, b) => a + b, 0);
+      expect(total).toBeGreaterThan(0.97);
+      expect(total).toBeLessThan(1.03);
+    }
+  });
+
+  it('has nothing to send after a reset', () => {
+    expect(report.after_reset).toBe(0);
+  });
+});
@@ -0,0 +1,82 @@
+/**
+ * Perf probe harness: runs the control path built with -DSESHAT_PERF_PROBES
+ * (command parse -> executor step -> telemetry pack) against the fixture
+ * catalog, cycling through every fixture pattern, then drains the
+ * diagnostics channel.
+ *
+ * Prints one JSON object:
+ *   loops          Control-loop iterations run
+ *   packets        Hex-encoded DiagnosticsPackets, one full round-robin cycle
+ *   after_reset    Packets available after perf_probes_reset() (expect 0)
+ *
+ * Usage: perf_probes_harness [loops]
+ */
+
+#include "types.h"
+#include "command_parser.h"
+#include "pattern_executor.h"
+#include "perf_probes.h"
+#include "telemetry_reporter.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define PATTERN_COUNT 8      /* tests/firmware/fixtures/catalog_data.h */
+
+static void print_hex(const void* data, size_t len) {
+    const uint8_t* p = (const uint8_t*)data;
+    size_t i;
+    putchar('"');
+    for (i = 0; i < len; i++) printf("%02x", p[i]);
+    putchar('"');
+}
+
+int main(int argc, char** argv) {
+    long loops = argc > 1 ? atol(argv[1]) : 1000;
+    long i;
+    int n;
+    int first = 1;
+    DiagnosticsPacket pkt;
+
+    perf_probes_init();
+    pattern_executor_init();
+
+    for (i = 0; i < loops; i++) {
+        GroundCommand wire;
+        GroundCommand cmd;
+        SensorState state;
+        TelemetryPacket telem;
+        uint8_t raw[sizeof(GroundCommand)];
+
+        memset(&wire, 0, sizeof(wire));
+        wire.pattern_id = (uint16_t)((i / 16) % PATTERN_COUNT);
+        wire.target_pos_x = (int16_t)(i % 2000 - 1000);
+        wire.target_pos_z = 1000;
+        memcpy(raw, &wire, sizeof(raw));
+
+        memset(&state, 0, sizeof(state));
+        state.position.x = (float)(i % 100) * 0.01f;
+        state.position.z = 0.9f;
+        state.battery_pct = 0.8f;
+        state.pos_quality = 0.95f;
+        state.flags = SENSOR_FLAG_POS_VALID;
+
+        if (command_parse(raw, sizeof(raw), &cmd)) {
+            (void)pattern_executor_step(&cmd, &state);
+        }
+        telemetry_pack(&state, pattern_executor_active_pattern(),
+                       telemetry_build_flags(&state, pattern_executor_active_pattern()),
+                       &telem);
+    }
+
+    printf("{\"loops\":%ld,\"packets\":[", loops);
+    for (n = 0; n < PROBE_COUNT; n++) {
+        if (!perf_probes_next_packet(&pkt)) break;
+        if (!first) putchar(',');
+        first = 0;
+        print_hex(&pkt, sizeof(pkt));
+    }
+    perf_probes_reset();
+    printf("],\"after_reset\":%d}\n", perf_probes_next_packet(&pkt));
+    return 0;
+}
@@ -0,0 +1,237 @@
+/**
+ * Host equivalence + timing harness: float vs Q16.16 pattern executor.
+ *
+ * Links two copies of pattern_executor.c, renamed at compile time:
+ *   pe_float_*  default build
+ *   pe_q16_*    -DSESHAT_FIXED_POINT
+ * drives both with the same seeded command/sensor stream, and prints one
+ * JSON object with the largest setpoint differences, the conversion
+ * checks and per-step timings. Driven by fixed-point.test.ts.
+ *
+ * Usage: q16_equivalence [steps]
+ */
+
+#include "types.h"
+#include "fixed_point.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+void pe_float_init(void);
+MotorSetpoints pe_float_step(const GroundCommand* cmd, const SensorState* state);
+void pe_q16_init(void);
+MotorSetpoints pe_q16_step(const GroundCommand* cmd, const SensorState* state);
+
+#define PATTERN_COUNT 8       /* tests/firmware/fixtures/catalog_data.h */
+#define HOLD_STEPS    50      /* Steps per commanded pattern */
+
+/* -- Deterministic inputs ------------------------------------------------ */
+
+static uint32_t s_rng = 0x5E5A7u;
+
+static uint32_t rng_next(void) {
+    s_rng ^= s_rng << 13;
+    s_rng ^= s_rng >> 17;
+    s_rng ^= s_rng << 5;
+    return s_rng;
+}
+
+static float rng_range(float lo, float hi) {
+    return lo + (hi - lo) * (float)(rng_next() & 0xFFFFFFu) / (float)0xFFFFFFu;
+}
+
+static void random_command(GroundCommand* cmd) {
+    uint32_t pick = rng_next() % 100u;
+    cmd->pattern_id   = (uint16_t)(pick < 3u ? PATTERN_COUNT + pick : pick % PATTERN_COUNT);
+    cmd->target_pos_x = float_to_mm(rng_range(-3.0f, 3.0f));
+    cmd->target_pos_y = float_to_mm(rng_range(-3.0f, 3.0f));
+    cmd->target_pos_z = float_to_mm(rng_range(0.0f, 2.5f));
+    cmd->target_vel_x = float_to_mm(rng_range(-2.0f, 2.0f));
+    cmd->target_vel_y = float_to_mm(rng_range(-2.0f, 2.0f));
+    cmd->target_vel_z = 0;
+    cmd->flags = (rng_next() % 50u == 0u) ? CMD_FLAG_EMERGENCY : 0u;
+}
+
+static void random_state(SensorState* s, const GroundCommand* cmd) {
+    s->position.x = mm_to_float(cmd->target_pos_x) + rng_range(-2.0f, 2.0f);
+    s->position.y = mm_to_float(cmd->target_pos_y) + rng_range(-2.0f, 2.0f);
+    s->position.z = rng_range(0.0f, 2.5f);
+    s->velocity.x = rng_range(-2.0f, 2.0f);
+    s->velocity.y = rng_range(-2.0f, 2.0f);
+    s->velocity.z = rng_range(-1.0f, 1.0f);
+    s->battery_pct = 0.8f;
+    s->pos_quality = 0.9f;
+    s->flags = SENSOR_FLAG_POS_VALID;
+}
+
+/* Small motion between steps so stateful generators see a trajectory. */
+static void drift_state(SensorState* s) {
+    s->position.x += s->velocity.x * 0.002f;
+    s->position.y += s->velocity.y * 0.002f;
+    s->velocity.x += rng_range(-0.05f, 0.05f);
+    s->velocity.y += rng_range(-0.05f, 0.05f);
+}
+
+/* -- Checks -------------------------------------------------------------- */
+
+typedef struct {
+    double roll, pitch, yaw, thrust;
+} MaxDiff;
+
+static void track(MaxDiff* m, MotorSetpoints a, MotorSetpoints b) {
+    double d;
+    d = fabs((double)a.roll - b.roll);     if (d > m->roll)   m->roll = d;
+    d = fabs((double)a.pitch - b.pitch);   if (d > m->pitch)  m->pitch = d;
+    d = fabs((double)a.yaw - b.yaw);       if (d > m->yaw)    m->yaw = d;
+    d = fabs((double)a.thrust - b.thrust); if (d > m->thrust) m->thrust = d;
+}
+
+/** Wire encoding. Q16 decode -> encode must round-trip every int16 value;
+ *  for the same real value both builds may differ by the final truncation
+ *  (1 mm), since Q16.16 cannot represent every millimetre exactly. */
+static int mm_roundtrip_failures(void) {
+    int32_t mm;
+    int bad = 0;
+    for (mm = -32767; mm <= 32767; mm++) {
+        if (q16_to_mm(q16_from_mm((int16_t)mm)) != (int16_t)mm) bad++;
+    }
+    return bad;
+}
+
+static int mm_encode_max_diff(void) {
+    int worst = 0, i;
+    for (i = 0; i < 200000; i++) {
+        float f = rng_range(-40.0f, 40.0f);
+        int d = abs(q16_to_mm(q16_from_float(f)) - float_to_mm(f));
+        if (d > worst) worst = d;
+    }
+    return worst;
+}
+
+/** q16_from_float / q16_to_float against a double reference, in LSBs. */
+static double conversion_error(void) {
+    double worst = 0.0;
+    int i;
+    for (i = 0; i < 200000; i++) {
+        float f = rng_range(-32000.0f, 32000.0f) * ((i & 1) ? 1.0f : 1e-4f);
+        double ref = floor((double)f * 65536.0 + 0.5);
+        double d = fabs((double)q16_from_float(f) - ref);
+        q16_t q = (q16_t)(rng_next() & 0x00FFFFFFu) - 0x00800000;
+        double e = fabs((double)q16_to_float(q) * 65536.0 - (double)q);
+        if (d > worst) worst = d;
+        if (e > worst) worst = e;
+    }
+    return worst;
+}
+
+/** Non-finite sensor input must still yield finite, clamped fixed-point setpoints. */
+static int nonfinite_violations(void) {
+    const float bad[] = { NAN, INFINITY, -INFINITY, 1e-40f, 3.4e38f, -3.4e38f };
+    GroundCommand cmd;
+    SensorState s;
+    int violations = 0;
+    unsigned i, gen;
+    pe_q16_init();
+    for (gen = 0; gen < PATTERN_COUNT; gen++) {
+        for (i = 0; i < sizeof(bad) / sizeof(bad[0]); i++) {
+            MotorSetpoints sp;
+            random_command(&cmd);
+            cmd.pattern_id = (uint16_t)gen;
+            cmd.flags = 0;
+            random_state(&s, &cmd);
+            s.position.x = bad[i];
+            s.velocity.y = bad[(i + 1) % (sizeof(bad) / sizeof(bad[0]))];
+            sp = pe_q16_step(&cmd, &s);
+            if (!isfinite(sp.roll) || !isfinite(sp.pitch) || !isfinite(sp.thrust)
+                || fabsf(sp.roll) > 25.0f || fabsf(sp.pitch) > 25.0f
+                || sp.thrust < 0.0f || sp.thrust > 60000.0f) {
+                violations++;
+            }
+        }
+    }
+    return violations;
+}
+
+/* -- Timing -------------------------------------------------------------- */
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+typedef MotorSetpoints (*StepFn)(const GroundCommand*, const SensorState*);
+
+static volatile float s_sink;
+
+static double ns_per_step(void (*init)(void), StepFn step,
+                          const GroundCommand* cmds, const SensorState* states, int n) {
+    double t0, best = 1e30;
+    int rep, i;
+    for (rep = 0; rep < 5; rep++) {
+        init();
+        t0 = now_ns();
+        for (i = 0; i < n; i++) s_sink += step(&cmds[i], &states[i]).thrust;
+        t0 = now_ns() - t0;
+        if (t0 < best) best = t0;
+    }
+    return best / n;
+}
+
+/* -- Main ---------------------------------------------------------------- */
+
+int main(int argc, char** argv) {
+    int steps = (argc > 1) ? atoi(argv[1]) : 200000;
+    GroundCommand* cmds = malloc(sizeof(GroundCommand) * (size_t)steps);
+    SensorState* states = malloc(sizeof(SensorState) * (size_t)steps);
+    MaxDiff all = {0}, per_gen[PATTERN_COUNT];
+    int i, g;
+    if (!cmds || !states) return 1;
+
+    for (g = 0; g < PATTERN_COUNT; g++) per_gen[g] = all;
+    for (i = 0; i < steps; i++) {
+        if (i % HOLD_STEPS == 0) {
+            random_command(&cmds[i]);
+            random_state(&states[i], &cmds[i]);
+        } else {
+            cmds[i] = cmds[i - 1];
+            cmds[i].flags = 0;
+            states[i] = states[i - 1];
+            drift_state(&states[i]);
+        }
+    }
+
+    pe_float_init();
+    pe_q16_init();
+    for (i = 0; i < steps; i++) {
+        MotorSetpoints a = pe_float_step(&cmds[i], &states[i]);
+        MotorSetpoints b = pe_q16_step(&cmds[i], &states[i]);
+        track(&all, a, b);
+        if (cmds[i].pattern_id < PATTERN_COUNT && !(cmds[i].flags & CMD_FLAG_EMERGENCY))
+            track(&per_gen[cmds[i].pattern_id], a, b);
+    }
+
+    printf("{\n  \"steps\": %d,\n", steps);
+    printf("  \"max_diff\": {\"roll\": %.6g, \"pitch\": %.6g, \"yaw\": %.6g, \"thrust\": %.6g},\n",
+           all.roll, all.pitch, all.yaw, all.thrust);
+    printf("  \"per_generator\": [");
+    for (g = 0; g < PATTERN_COUNT; g++) {
+        printf("%s\n    {\"generator\": %d, \"attitude\": %.6g, \"thrust\": %.6g}",
+               g ? "," : "", g,
+               per_gen[g].roll > per_gen[g].pitch ? per_gen[g].roll : per_gen[g].pitch,
+               per_gen[g].thrust);
+    }
+    printf("\n  ],\n");
+    printf("  \"mm_roundtrip_failures\": %d,\n", mm_roundtrip_failures());
+    printf("  \"mm_encode_max_diff\": %d,\n", mm_encode_max_diff());
+    printf("  \"conversion_error_lsb\": %.6g,\n", conversion_error());
+    printf("  \"nonfinite_violations\": %d,\n", nonfinite_violations());
+    printf("  \"ns_per_step\": {\"float\": %.2f, \"q16\": %.2f}\n}\n",
+           ns_per_step(pe_float_init, pe_float_step, cmds, states, steps),
+           ns_per_step(pe_q16_init, pe_q16_step, cmds, states, steps));
+
+    free(cmds);
+    free(states);
+    return 0;
+}
@@ -0,0 +1,96 @@
+/**
+ * Multiplexed telemetry: packets from telemetry_reporter.c decoded and
+ * reassembled by the coordinator's TelemetryReassembler.
+ */
+
+import { describe, it, expect, beforeAll } from 'vitest';
+import { execFileSync } from 'node:child_process';
+import {
+  findHostCompiler,
+  stageFirmware,
+  compileObject,
+  linkProgram,
+} from './host-cc.js';
+import {
+  TelemetryReassembler,
+  TELEMETRY_PACKET_SIZE,
+  TelemExtSlot,
+} from '../../src/coordinator/comms.js';
+
+interface TelemetryReport {
+  size: number;
+  packets: string[];
+  nan_slot: string;
+}
+
+const hex = (s: string): Uint8Array => Uint8Array.from(Buffer.from(s, 'hex'));
+
+const cc = findHostCompiler();
+
+describe.skipIf(!cc)('multiplexed telemetry (host)', () => {
+  let report: TelemetryReport;
+
+  beforeAll(() => {
+    const dir = stageFirmware();
+    const exe = linkProgram(cc!, dir, 'telemetry_harness.c', [
+      compileObject(cc!, dir, 'telemetry_reporter.c'),
+      compileObject(cc!, dir, 'event_queue.c'),
+    ]);
+    report = JSON.parse(execFileSync(exe, { encoding: 'utf-8' }));
+  }, 60_000);
+
+  it('agrees with the firmware on the packet size', () => {
+    expect(report.size).toBe(TELEMETRY_PACKET_SIZE);
+    for (const p of report.packets) expect(hex(p)).toHaveLength(TELEMETRY_PACKET_SIZE);
+  });
+
+  it('rotates one ext slot per packet', () => {
+    const slots = report.packets.map((p) => hex(p)[18]);
+    expect(slots).toEqual([0, 1, 2, 3, 4, 0]);
+  });
+
+  it('decodes the high-rate fields from every packet', () => {
+    const r = new TelemetryReassembler();
+    const t = r.decode('d1', hex(report.packets[0]!))!;
+    expect(t.state.position.x).toBeCloseTo(1.234, 3);
+    expect(t.state.position.y).toBeCloseTo(-2.5, 3);
+    expect(t.state.velocity.x).toBeCloseTo(0.25, 3);
+    expect(t.state.battery.percentage).toBeCloseTo(0.6, 2);
+    expect(t.state.position_quality).toBeCloseTo(0.9, 2);
+    expect(t.currentPatternId).toBe(42);
+    expect(r.isComplete('d1')).toBe(false);
+  });
+
+  it('reassembles the full SensorState after one rotation', () => {
+    const r = new TelemetryReassembler();
+    let last = null;
+    for (const p of report.packets.slice(0, TelemExtSlot.COUNT)) last = r.decode('d1', hex(p));
+    expect(r.isComplete('d1')).toBe(true);
+    const s = last!.state;
+    expect(s.orientation.x).toBeCloseTo(0.1, 3);
+    expect(s.orientation.y).toBeCloseTo(-0.2, 3);
+    expect(s.orientation.z).toBeCloseTo(3.0, 3);
+    expect(s.battery.voltage).toBeCloseTo(3.912, 3);
+    expect(s.battery.discharge_rate).toBeCloseTo(7.35, 2);
+    expect(s.battery.estimated_remaining).toBe(420);
+    expect(last!.sensorFlags).toBe(0b11 | (1 << 20));
+    expect(last!.batteryForecast!.restingSoc).toBeCloseTo(0.6, 5);
+    expect(last!.batteryForecast!.resistanceOhm).toBeCloseTo(0.152, 5);
+  });
+
+  it('keeps low-rate state per drone', () => {
+    const r = new TelemetryReassembler();
+    for (const p of report.packets.slice(0, TelemExtSlot.COUNT)) r.decode('d1', hex(p));
+    r.decode('d2', hex(report.packets[0]!));
+    expect(r.isComplete('d1')).toBe(true);
+    expect(r.isComplete('d2')).toBe(false);
+    r.forget('d1');
+    expect(r.isComplete('d1')).toBe(false);
+  });
+
+  it('carries NaN through the ext slot and rejects short packets', () => {
+    const r = new TelemetryReassembler();
+    expect(r.decode('d1', hex(report.nan_slot))!.state.orientation.x).toBeNaN();
+    expect(r.decode('d1', new Uint8Array(18))).toBeNull();
+  });
+});
@@ -0,0 +1,82 @@
+/**
+ * Motion-adaptive telemetry rate: telemetry_rate.c driven through idle
+ * and active flight profiles, and the swarm downlink it implies.
+ */
+
+import { describe, it, expect, beforeAll } from 'vitest';
+import { execFileSync } from 'node:child_process';
+import {
+  findHostCompiler,
+  stageFirmware,
+  compileObject,
+  linkProgram,
+} from './host-cc.js';
+
+interface ScenarioStats {
+  sent: number;
+  max_gap_ms: number;
+  min_gap_ms: number;
+}
+
+interface RateReport {
+  pad: ScenarioStats;
+  hover: ScenarioStats;
+  drift: ScenarioStats;
+  performer: ScenarioStats;
+  flags: ScenarioStats;
+  seconds: number;
+  advertised_ms: number;
+}
+
+const FAST_HZ = 100;
+const KEEPALIVE_MS = 500;
+
+const cc = findHostCompiler();
+
+describe.skipIf(!cc)('telemetry rate (host)', () => {
+  let report: RateReport;
+
+  beforeAll(() => {
+    const dir = stageFirmware();
+    const exe = linkProgram(cc!, dir, 'telemetry_rate_harness.c', [
+      compileObject(cc!, dir, 'telemetry_rate.c'),
+      compileObject(cc!, dir, 'telemetry_reporter.c'),
+      compileObject(cc!, dir, 'event_queue.c'),
+    ]);
+    report = JSON.parse(execFileSync(exe, { encoding: 'utf-8' }));
+  }, 60_000);
+
+  it('falls back to the keepalive when still', () => {
+    for (const s of [report.pad, report.hover]) {
+      expect(s.sent).toBe((report.seconds * 1000) / KEEPALIVE_MS);
+      expect(s.max_gap_ms).toBe(KEEPALIVE_MS);
+    }
+  });
+
+  it('reports at the fast rate while moving', () => {
+    expect(report.performer.sent).toBe(report.seconds * FAST_HZ);
+    expect(report.performer.max_gap_ms).toBe(1000 / FAST_HZ);
+  });
+
+  it('sends early when the ground view drifts or flags change', () => {
+    expect(report.drift.max_gap_ms).toBeLessThan(KEEPALIVE_MS);
+    expect(report.drift.sent).toBeGreaterThan(report.pad.sent);
+    expect(report.flags.min_gap_ms).toBeLessThan(KEEPALIVE_MS);
+    expect(report.flags.sent).toBeGreaterThan(report.pad.sent);
+  });
+
+  it('never exceeds the advertised keepalive', () => {
+    expect(report.advertised_ms).toBe(KEEPALIVE_MS);
+    for (const s of [report.pad, report.hover, report.drift, report.performer, report.flags]) {
+      expect(s.max_gap_ms).toBeLessThanOrEqual(report.advertised_ms);
+    }
+  });
+
+  it('scales swarm downlink with activity, not size', () => {
+    // 30-drone show: 3 performers flying, 27 reserves on their pads.
+    const perSecond = (s: ScenarioStats): number => s.sent / report.seconds;
+    const adaptive = 3 * perSecond(report.performer) + 27 * perSecond(report.pad);
+    const fixed = 30 * FAST_HZ;
+    expect(adaptive).toBeLessThan(fixed * 0.15);
+  });
+});
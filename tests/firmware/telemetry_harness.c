@@ -0,0 +1,59 @@
+/**
+ * Telemetry harness: packs and serializes consecutive TelemetryPackets
+ * from one known SensorState with telemetry_reporter.c, as the radio
+ * layer would, so the ground-side decoder can be checked byte for byte.
+ *
+ * Prints one JSON object:
+ *   size      TELEMETRY_PACKET_SIZE
+ *   packets   Hex-encoded packets from 6 consecutive telemetry_pack calls
+ *   nan_slot  Hex-encoded packet whose ATTITUDE slot holds a NaN roll
+ */
+
+#include "types.h"
+#include "telemetry_reporter.h"
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+static void print_packet(const TelemetryPacket* pkt) {
+    uint8_t buf[TELEMETRY_PACKET_SIZE];
+    uint16_t n = telemetry_serialize(pkt, buf, sizeof(buf));
+    uint16_t b;
+    putchar('"');
+    for (b = 0; b < n; b++) printf("%02x", buf[b]);
+    putchar('"');
+}
+
+int main(void) {
+    SensorState st;
+    TelemetryPacket pkt;
+    int i;
+
+    memset(&st, 0, sizeof(st));
+    st.position.x = 1.234f;
+    st.position.y = -2.5f;
+    st.position.z = 0.8f;
+    st.velocity.x = 0.25f;
+    st.orientation.x = 0.1f;
+    st.orientation.y = -0.2f;
+    st.orientation.z = 3.0f;
+    st.battery_pct = 0.6f;
+    st.battery_voltage = 3.912f;
+    st.discharge_rate = 7.35f;
+    st.pos_quality = 0.9f;
+    st.flags = SENSOR_FLAG_POS_VALID | SENSOR_FLAG_LIGHTHOUSE_OK | (1u << 20);
+    telemetry_set_forecast(420, 120, 38);
+
+    printf("{\"size\":%u,\"packets\":[", TELEMETRY_PACKET_SIZE);
+    for (i = 0; i < 6; i++) {
+        telemetry_pack(&st, 42, telemetry_build_flags(&st, 42), &pkt);
+        if (i > 0) putchar(',');
+        print_packet(&pkt);
+    }
+    printf("],\"nan_slot\":");
+    st.orientation.x = NAN;
+    telemetry_pack_ext(&st, TELEM_EXT_ATTITUDE, &pkt);
+    print_packet(&pkt);
+    printf("}\n");
+    return 0;
+}
@@ -0,0 +1,127 @@
+/**
+ * Telemetry rate harness: drives telemetry_rate.c at 500 Hz for 10 s per
+ * scenario and counts the packets it would send.
+ *
+ * Scenarios:
+ *   pad        Grounded reserve, ±2 mm position noise
+ *   hover      Hovering, ±5 mm / ±0.02 m/s noise
+ *   drift      Creeping at 4.5 cm/s (below the moving threshold)
+ *   performer  Flying a 1 m circle at 0.6 m/s
+ *   flags      On the pad, status flags toggle every 2 s off the keepalive grid
+ *
+ * Prints one JSON object: per scenario, packets sent, the longest and
+ * shortest gap between packets (ms), plus the keepalive the reporter
+ * advertises in TELEM_EXT_DISCHARGE.
+ */
+
+#include "types.h"
+#include "telemetry_rate.h"
+#include "telemetry_reporter.h"
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#define LOOP_US   2000u
+#define DURATION  5000   /* Steps: 10 s at 500 Hz */
+
+typedef enum { SC_PAD, SC_HOVER, SC_DRIFT, SC_PERFORMER, SC_FLAGS, SC_COUNT } Scenario;
+
+static const char* const NAMES[SC_COUNT] = { "pad", "hover", "drift", "performer", "flags" };
+
+static uint32_t s_rng = 0x5EED5u;
+
+static float noise(float amp) {
+    s_rng ^= s_rng << 13;
+    s_rng ^= s_rng >> 17;
+    s_rng ^= s_rng << 5;
+    return amp * ((float)(s_rng & 0xFFFFu) / 32767.5f - 1.0f);
+}
+
+static void run(Scenario sc) {
+    SensorState st;
+    uint32_t sent = 0;
+    uint32_t last = 0;
+    uint32_t max_gap = 0;
+    uint32_t min_gap = 0xFFFFFFFFu;
+    int i;
+
+    telemetry_rate_init(NULL);
+
+    for (i = 0; i < DURATION; i++) {
+        uint32_t now = 1000u + (uint32_t)i * LOOP_US;
+        float t = (float)i * (float)LOOP_US * 1e-6f;
+        uint8_t flags = 0;
+
+        memset(&st, 0, sizeof(st));
+        st.battery_pct = 0.8f;
+        st.pos_quality = 0.95f;
+        switch (sc) {
+        case SC_PAD:
+        case SC_FLAGS:
+            st.position.x = noise(0.002f);
+            st.position.y = noise(0.002f);
+            if (sc == SC_FLAGS && ((int)((t + 0.25f) / 2.0f) & 1)) flags = TELEM_FLAG_LOW_BATTERY;
+            break;
+        case SC_HOVER:
+            st.position.x = noise(0.005f);
+            st.position.y = noise(0.005f);
+            st.position.z = 1.0f + noise(0.005f);
+            st.velocity.x = noise(0.02f);
+            st.velocity.y = noise(0.02f);
+            flags = TELEM_FLAG_AIRBORNE | TELEM_FLAG_PATTERN_ACTIVE;
+            break;
+        case SC_DRIFT:
+            st.position.x = 0.045f * t;
+            st.position.z = 1.0f;
+            st.velocity.x = 0.045f;
+            flags = TELEM_FLAG_AIRBORNE;
+            break;
+        case SC_PERFORMER:
+            st.position.x = cosf(0.6f * t);
+            st.position.y = sinf(0.6f * t);
+            st.position.z = 1.0f;
+            st.velocity.x = -0.6f * sinf(0.6f * t);
+            st.velocity.y = 0.6f * cosf(0.6f * t);
+            flags = TELEM_FLAG_AIRBORNE | TELEM_FLAG_PATTERN_ACTIVE;
+            break;
+        default:
+            break;
+        }
+
+        if (telemetry_rate_poll(now, &st, flags, 7)) {
+            if (sent > 0) {
+                uint32_t gap = now - last;
+                if (gap > max_gap) max_gap = gap;
+                if (gap < min_gap) min_gap = gap;
+            }
+            last = now;
+            sent++;
+        }
+    }
+
+    printf("\"%s\":{\"sent\":%u,\"max_gap_ms\":%u,\"min_gap_ms\":%u}",
+           NAMES[sc], sent, max_gap / 1000u, min_gap / 1000u);
+}
+
+int main(void) {
+    TelemetryPacket pkt;
+    uint16_t advertised;
+    int sc;
+
+    putchar('{');
+    for (sc = 0; sc < SC_COUNT; sc++) {
+        run((Scenario)sc);
+        putchar(',');
+    }
+
+    memset(&pkt, 0, sizeof(pkt));
+    {
+        SensorState st;
+        memset(&st, 0, sizeof(st));
+        telemetry_pack_ext(&st, TELEM_EXT_DISCHARGE, &pkt);
+    }
+    advertised = (uint16_t)(pkt.ext[2] | (pkt.ext[3] << 8));
+    printf("\"steps_per_s\":%u,\"seconds\":%d,\"advertised_ms\":%u}\n",
+           1000000u / LOOP_US, DURATION / (int)(1000000u / LOOP_US), advertised);
+    return 0;
+}
@@ -0,0 +1,124 @@
+/**
+ * Worst-case execution time: pattern_executor_step under generated and
+ * fuzzed inputs, float and Q16.16 builds.
+ *
+ * Timings are host-dependent and only reported; the assertions hold the
+ * deterministic parts — path coverage, instruction counts (when ptrace is
+ * available) and finite output from the fixed-point build.
+ */
+
+import { describe, it, expect, beforeAll } from 'vitest';
+import { execFileSync } from 'node:child_process';
+import {
+  findHostCompiler,
+  stageFirmware,
+  compileRenamed,
+  linkProgram,
+} from './host-cc.js';
+
+interface PathReport {
+  build: 'float' | 'q16';
+  case: string;
+  input: string;
+  samples: number;
+  max_ticks: number;
+  max_insns: number;
+  nonfinite: number;
+}
+
+interface SlowInput {
+  build: string;
+  case: string;
+  input: string;
+  ticks: number;
+  insns: number;
+  cmd: Record<string, unknown>;
+  state: Record<string, unknown>;
+}
+
+interface WcetReport {
+  tick_unit: string;
+  samples_per_path: number;
+  insn_samples_per_path: number;
+  paths: PathReport[];
+  slowest: SlowInput[];
+}
+
+const CASES = [
+  'position-hold', 'velocity-track', 'waypoint-sequence', 'relative-offset',
+  'orbit-center', 'trajectory-spline', 'emergency-stop', 'idle',
+  'invalid-id', 'emergency-flag',
+];
+const INPUTS = ['nominal', 'switch', 'nan', 'inf', 'denormal', 'mm-boundary', 'fuzz'];
+
+/** Generous host-instruction ceiling per step; catches accidental loops. */
+const INSN_BUDGET = 5000;
+
+const cc = findHostCompiler();
+
+describe.skipIf(!cc)('pattern_executor_step WCET (host)', () => {
+  let report: WcetReport;
+
+  beforeAll(() => {
+    const dir = stageFirmware('catalog_data.h');
+    const objects = [
+      compileRenamed(cc!, dir, 'pattern_executor.c', 'pe_float'),
+      compileRenamed(cc!, dir, 'pattern_executor.c', 'pe_q16', ['SESHAT_FIXED_POINT']),
+    ];
+    const exe = linkProgram(cc!, dir, 'wcet_harness.c', objects);
+    report = JSON.parse(execFileSync(exe, ['100', '4'], { encoding: 'utf-8' }));
+  }, 120_000);
+
+  it('covers every generator, fallback and input class in both builds', () => {
+    for (const build of ['float', 'q16']) {
+      for (const c of CASES) {
+        for (const input of INPUTS) {
+          const path = report.paths.find(
+            (p) => p.build === build && p.case === c && p.input === input,
+          );
+          expect(path).toBeDefined();
+          expect(path!.samples).toBe(report.samples_per_path);
+          expect(path!.max_ticks).toBeGreaterThan(0);
+        }
+      }
+    }
+  });
+
+  it('keeps every path within the instruction budget', () => {
+    if (report.insn_samples_per_path === 0) return;  // No ptrace on this host
+    for (const p of report.paths) {
+      expect(p.max_insns).toBeGreaterThan(0);
+      expect(p.max_insns).toBeLessThan(INSN_BUDGET);
+    }
+  });
+
+  it('has no data-dependent blow-up on NaN, Inf, denormal or fuzzed input', () => {
+    if (report.insn_samples_per_path === 0) return;
+    for (const build of ['float', 'q16']) {
+      for (const c of CASES) {
+        const paths = report.paths.filter((p) => p.build === build && p.case === c);
+        const baseline = Math.max(
+          ...paths.filter((p) => p.input === 'nominal' || p.input === 'switch')
+            .map((p) => p.max_insns),
+        );
+        for (const p of paths) {
+          expect(p.max_insns).toBeLessThanOrEqual(baseline * 2);
+        }
+      }
+    }
+  });
+
+  it('never emits non-finite setpoints from the fixed-point build', () => {
+    for (const p of report.paths.filter((p) => p.build === 'q16')) {
+      expect(p.nonfinite).toBe(0);
+    }
+  });
+
+  it('reports the slowest inputs found per build', () => {
+    expect(report.slowest.filter((s) => s.build === 'float')).toHaveLength(5);
+    expect(report.slowest.filter((s) => s.build === 'q16')).toHaveLength(5);
+    for (const s of report.slowest) {
+      expect(s.ticks).toBeGreaterThan(0);
+    }
+  });
+});
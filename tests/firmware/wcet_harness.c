@@ -0,0 +1,462 @@
+/**
+ * Worst-case execution time harness for pattern_executor_step.
+ *
+ * Links the float and Q16.16 builds of pattern_executor.c (renamed
+ * pe_float_* / pe_q16_*, see host-cc.ts) against the fixture catalog, and
+ * drives each with generated and fuzzed inputs. Every sample belongs to a
+ * path: (build, case, input class), where case is the generator that runs
+ * (one fixture pattern per GeneratorType), an invalid pattern ID, or the
+ * emergency flag.
+ *
+ * Two measurements per sample:
+ *   ticks  Best of WCET_REPEATS runs, primed with the same previous
+ *          command each time (TSC on x86, CLOCK_MONOTONIC ns elsewhere).
+ *   insns  Exact user-space instruction count of one step, by single-
+ *          stepping a forked child under ptrace (Linux only; -1 elsewhere).
+ *          Deterministic, so it is the number to hold a budget against.
+ *
+ * Prints one JSON object: per-path maxima and the slowest inputs found.
+ *
+ * Usage: wcet_harness [samples_per_path] [insn_samples_per_path]
+ */
+
+#include "types.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(__linux__)
+#include <signal.h>
+#include <sys/ptrace.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#define HAVE_PTRACE 1
+#else
+#define HAVE_PTRACE 0
+#endif
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define TICK_UNIT "tsc"
+static uint64_t ticks_now(void) { _mm_lfence(); return __rdtsc(); }
+#else
+#define TICK_UNIT "ns"
+static uint64_t ticks_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+#endif
+
+void pe_float_init(void);
+MotorSetpoints pe_float_step(const GroundCommand* cmd, const SensorState* state);
+void pe_q16_init(void);
+MotorSetpoints pe_q16_step(const GroundCommand* cmd, const SensorState* state);
+
+/* -- Paths -------------------------------------------------------------- */
+
+#define PATTERN_COUNT  8      /* tests/firmware/fixtures/catalog_data.h */
+#define WCET_REPEATS   7
+#define TOP_SLOWEST    5
+
+typedef struct {
+    const char* name;
+    void (*init)(void);
+    MotorSetpoints (*step)(const GroundCommand*, const SensorState*);
+} Build;
+
+static const Build BUILDS[] = {
+    { "float", pe_float_init, pe_float_step },
+    { "q16",   pe_q16_init,   pe_q16_step },
+};
+#define BUILD_COUNT 2
+
+/* Cases 0..7 are GeneratorType values (fixture pattern i uses generator i). */
+#define CASE_INVALID_ID  PATTERN_COUNT
+#define CASE_EMERGENCY   (PATTERN_COUNT + 1)
+#define CASE_COUNT       (PATTERN_COUNT + 2)
+
+static const char* const CASE_NAMES[CASE_COUNT] = {
+    "position-hold", "velocity-track", "waypoint-sequence", "relative-offset",
+    "orbit-center", "trajectory-spline", "emergency-stop", "idle",
+    "invalid-id", "emergency-flag",
+};
+
+typedef enum {
+    IN_NOMINAL,      /* In-range values, same pattern as the previous step  */
+    IN_SWITCH,       /* Previous step ran another pattern: entry hooks run  */
+    IN_NAN,          /* NaN in sensor fields                                */
+    IN_INF,          /* +/-Inf and float extremes in sensor fields          */
+    IN_DENORMAL,     /* Denormal inputs and near-cancelling differences     */
+    IN_MM_BOUNDARY,  /* float_to_mm / int16 wire limits                     */
+    IN_FUZZ,         /* Random bit patterns                                 */
+    IN_COUNT
+} InputClass;
+
+static const char* const INPUT_NAMES[IN_COUNT] = {
+    "nominal", "switch", "nan", "inf", "denormal", "mm-boundary", "fuzz",
+};
+
+typedef struct {
+    GroundCommand prev;       /* Primes executor state before the timed step */
+    GroundCommand cmd;
+    SensorState   state;
+    uint8_t       case_id;
+    uint8_t       input;
+} Sample;
+
+typedef struct {
+    uint64_t max_ticks;
+    long     max_insns;
+    uint32_t samples;
+    uint32_t nonfinite;       /* Steps whose setpoints were NaN/Inf */
+} PathStats;
+
+/* -- Input generation --------------------------------------------------- */
+
+static uint32_t s_rng = 0xC0FFEEu;
+
+static uint32_t rng_next(void) {
+    s_rng ^= s_rng << 13;
+    s_rng ^= s_rng >> 17;
+    s_rng ^= s_rng << 5;
+    return s_rng;
+}
+
+static float rng_range(float lo, float hi) {
+    return lo + (hi - lo) * (float)(rng_next() & 0xFFFFFFu) / (float)0xFFFFFFu;
+}
+
+static float bits_to_float(uint32_t bits) {
+    float f;
+    memcpy(&f, &bits, sizeof(f));
+    return f;
+}
+
+static float random_denormal(void) {
+    uint32_t bits = (rng_next() & 0x007FFFFFu) | 1u;
+    return bits_to_float(bits | (rng_next() & 0x80000000u));
+}
+
+static float make_nan(void) {
+    return NAN;
+}
+
+static float random_special(void) {
+    static const float SPECIAL[] = { INFINITY, -INFINITY, 3.4e38f, -3.4e38f, 1e30f, -1e30f };
+    return SPECIAL[rng_next() % (sizeof(SPECIAL) / sizeof(SPECIAL[0]))];
+}
+
+static int16_t random_mm_boundary(void) {
+    static const int16_t MM[] = { -32768, -32767, -32766, -1, 0, 1, 32766, 32767 };
+    return MM[rng_next() % (sizeof(MM) / sizeof(MM[0]))];
+}
+
+static float random_m_boundary(void) {
+    static const float M[] = { 32.767f, -32.767f, 32.7675f, -32.7675f, 32.768f,
+                               -32.768f, 65.535f, -65.535f, 0.0005f, -0.0005f };
+    return M[rng_next() % (sizeof(M) / sizeof(M[0]))];
+}
+
+/** Apply f to a random non-empty subset of the sensor fields generators read. */
+static void perturb_state(SensorState* s, float (*f)(void)) {
+    float* fields[5];
+    uint32_t mask = 0;
+    int i;
+    fields[0] = &s->position.x; fields[1] = &s->position.y; fields[2] = &s->position.z;
+    fields[3] = &s->velocity.x; fields[4] = &s->velocity.y;
+    while (mask == 0) mask = rng_next() & 0x1Fu;
+    for (i = 0; i < 5; i++) {
+        if (mask & (1u << i)) *fields[i] = f();
+    }
+}
+
+static void nominal_command(GroundCommand* cmd, uint16_t pattern_id) {
+    memset(cmd, 0, sizeof(*cmd));
+    cmd->pattern_id   = pattern_id;
+    cmd->target_pos_x = float_to_mm(rng_range(-3.0f, 3.0f));
+    cmd->target_pos_y = float_to_mm(rng_range(-3.0f, 3.0f));
+    cmd->target_pos_z = float_to_mm(rng_range(0.2f, 2.5f));
+    cmd->target_vel_x = float_to_mm(rng_range(-2.0f, 2.0f));
+    cmd->target_vel_y = float_to_mm(rng_range(-2.0f, 2.0f));
+}
+
+static void nominal_state(SensorState* s, const GroundCommand* cmd) {
+    memset(s, 0, sizeof(*s));
+    s->position.x = mm_to_float(cmd->target_pos_x) + rng_range(-2.0f, 2.0f);
+    s->position.y = mm_to_float(cmd->target_pos_y) + rng_range(-2.0f, 2.0f);
+    s->position.z = rng_range(0.0f, 2.5f);
+    s->velocity.x = rng_range(-2.0f, 2.0f);
+    s->velocity.y = rng_range(-2.0f, 2.0f);
+    s->battery_pct = 0.8f;
+    s->pos_quality = 0.9f;
+    s->flags = SENSOR_FLAG_POS_VALID;
+}
+
+static void make_sample(Sample* smp, uint8_t case_id, uint8_t input) {
+    uint16_t pattern_id = (case_id < PATTERN_COUNT) ? case_id : 0;
+    if (case_id == CASE_INVALID_ID) pattern_id = (uint16_t)(PATTERN_COUNT + rng_next() % 0xFF00u);
+
+    smp->case_id = case_id;
+    smp->input = input;
+    nominal_command(&smp->cmd, pattern_id);
+    nominal_state(&smp->state, &smp->cmd);
+    smp->prev = smp->cmd;
+
+    switch ((InputClass)input) {
+    case IN_NOMINAL:
+        break;
+    case IN_SWITCH:
+        smp->prev.pattern_id = (uint16_t)((pattern_id + 1 + rng_next() % (PATTERN_COUNT - 1))
+                                          % PATTERN_COUNT);
+        break;
+    case IN_NAN:
+        perturb_state(&smp->state, make_nan);
+        break;
+    case IN_INF:
+        perturb_state(&smp->state, random_special);
+        break;
+    case IN_DENORMAL:
+        if (rng_next() & 1u) {
+            perturb_state(&smp->state, random_denormal);
+        } else {
+            /* Land exactly on the target so differences cancel and their
+             * squares underflow. */
+            smp->cmd.target_pos_x = smp->cmd.target_pos_y = 0;
+            smp->prev = smp->cmd;
+            smp->state.position.x = random_denormal() * 1e20f;
+            smp->state.position.y = random_denormal() * 1e20f;
+            smp->state.velocity.x = random_denormal();
+            smp->state.velocity.y = random_denormal();
+        }
+        break;
+    case IN_MM_BOUNDARY:
+        smp->cmd.target_pos_x = random_mm_boundary();
+        smp->cmd.target_pos_y = random_mm_boundary();
+        smp->cmd.target_pos_z = random_mm_boundary();
+        smp->cmd.target_vel_x = random_mm_boundary();
+        smp->cmd.target_vel_y = random_mm_boundary();
+        smp->prev = smp->cmd;
+        perturb_state(&smp->state, random_m_boundary);
+        break;
+    case IN_FUZZ: {
+        uint8_t* raw = (uint8_t*)&smp->cmd;
+        size_t i;
+        for (i = sizeof(uint16_t); i < sizeof(smp->cmd); i++) raw[i] = (uint8_t)rng_next();
+        smp->state.position.x = bits_to_float(rng_next());
+        smp->state.position.y = bits_to_float(rng_next());
+        smp->state.position.z = bits_to_float(rng_next());
+        smp->state.velocity.x = bits_to_float(rng_next());
+        smp->state.velocity.y = bits_to_float(rng_next());
+        smp->prev = smp->cmd;
+        smp->prev.pattern_id = (uint16_t)(rng_next() % PATTERN_COUNT);
+        break;
+    }
+    default:
+        break;
+    }
+
+    smp->cmd.flags = (uint8_t)(smp->cmd.flags & (uint8_t)~CMD_FLAG_EMERGENCY);
+    if (case_id == CASE_EMERGENCY) smp->cmd.flags |= CMD_FLAG_EMERGENCY;
+    smp->prev.flags = 0;
+}
+
+/* -- Measurement -------------------------------------------------------- */
+
+static volatile float s_sink;
+
+static void prime(const Build* b, const Sample* smp) {
+    b->init();
+    s_sink += b->step(&smp->prev, &smp->state).thrust;
+}
+
+static uint64_t measure_ticks(const Build* b, const Sample* smp, int* nonfinite) {
+    uint64_t best = UINT64_MAX;
+    int r;
+    for (r = 0; r < WCET_REPEATS; r++) {
+        MotorSetpoints sp;
+        uint64_t t0, t1;
+        prime(b, smp);
+        t0 = ticks_now();
+        sp = b->step(&smp->cmd, &smp->state);
+        t1 = ticks_now();
+        if (t1 - t0 < best) best = t1 - t0;
+        *nonfinite = !isfinite(sp.roll) || !isfinite(sp.pitch)
+                  || !isfinite(sp.yaw) || !isfinite(sp.thrust);
+        s_sink += sp.thrust;
+    }
+    return best;
+}
+
+#if HAVE_PTRACE
+/** Count instructions between two SIGUSR1 markers per sample, in order.
+ *  The first region is empty and calibrates the marker overhead. */
+static int count_instructions(const Build* b, const Sample* smp, int n, long* out) {
+    pid_t child = fork();
+    int status, i;
+    long overhead = 0;
+    if (child < 0) return -1;
+    if (child == 0) {
+        if (ptrace(PTRACE_TRACEME, 0, 0, 0) < 0) _exit(1);
+        raise(SIGSTOP);
+        raise(SIGUSR1);
+        raise(SIGUSR1);
+        for (i = 0; i < n; i++) {
+            prime(b, &smp[i]);
+            raise(SIGUSR1);
+            s_sink += b->step(&smp[i].cmd, &smp[i].state).thrust;
+            raise(SIGUSR1);
+        }
+        _exit(0);
+    }
+    waitpid(child, &status, 0);                          /* SIGSTOP */
+    if (!WIFSTOPPED(status)) return -1;
+    for (i = -1; i < n; i++) {
+        long count = 0;
+        ptrace(PTRACE_CONT, child, 0, 0);                /* Run to start marker */
+        waitpid(child, &status, 0);
+        if (!WIFSTOPPED(status)) return -1;
+        for (;;) {
+            ptrace(PTRACE_SINGLESTEP, child, 0, 0);
+            waitpid(child, &status, 0);
+            if (!WIFSTOPPED(status)) return -1;
+            if (WSTOPSIG(status) == SIGUSR1) break;     /* End marker */
+            count++;
+        }
+        if (i < 0) overhead = count;
+        else out[i] = count - overhead;
+    }
+    ptrace(PTRACE_CONT, child, 0, 0);
+    waitpid(child, &status, 0);
+    return 0;
+}
+#endif
+
+/* -- Report ------------------------------------------------------------- */
+
+typedef struct {
+    uint64_t ticks;
+    long     insns;
+    int      build;
+    const Sample* smp;
+} Slow;
+
+static void print_sample(const Slow* s) {
+    const Sample* m = s->smp;
+    printf("{\"build\": \"%s\", \"case\": \"%s\", \"input\": \"%s\", "
+           "\"ticks\": %llu, \"insns\": %ld, "
+           "\"cmd\": {\"pattern_id\": %u, \"pos_mm\": [%d, %d, %d], \"vel_mm\": [%d, %d], "
+           "\"flags\": %u, \"prev_pattern_id\": %u}, "
+           "\"state\": {\"pos\": [\"%g\", \"%g\", \"%g\"], \"vel\": [\"%g\", \"%g\"]}}",
+           BUILDS[s->build].name, CASE_NAMES[m->case_id], INPUT_NAMES[m->input],
+           (unsigned long long)s->ticks, s->insns,
+           m->cmd.pattern_id, m->cmd.target_pos_x, m->cmd.target_pos_y, m->cmd.target_pos_z,
+           m->cmd.target_vel_x, m->cmd.target_vel_y, m->cmd.flags, m->prev.pattern_id,
+           (double)m->state.position.x, (double)m->state.position.y,
+           (double)m->state.position.z, (double)m->state.velocity.x,
+           (double)m->state.velocity.y);
+}
+
+static void insert_slowest(Slow* top, Slow s) {
+    int i, j;
+    for (i = 0; i < TOP_SLOWEST; i++) {
+        if (!top[i].smp || s.ticks > top[i].ticks) {
+            for (j = TOP_SLOWEST - 1; j > i; j--) top[j] = top[j - 1];
+            top[i] = s;
+            return;
+        }
+    }
+}
+
+/* -- Main --------------------------------------------------------------- */
+
+int main(int argc, char** argv) {
+    int per_path = (argc > 1) ? atoi(argv[1]) : 1000;
+    int insn_per_path = (argc > 2) ? atoi(argv[2]) : 16;
+    int n_samples = CASE_COUNT * IN_COUNT * per_path;
+    Sample* samples = malloc(sizeof(Sample) * (size_t)n_samples);
+    Sample* counted = malloc(sizeof(Sample) * (size_t)(CASE_COUNT * IN_COUNT * insn_per_path + 1));
+    long* insns = malloc(sizeof(long) * (size_t)(CASE_COUNT * IN_COUNT * insn_per_path + 1));
+    static PathStats stats[BUILD_COUNT][CASE_COUNT][IN_COUNT];
+    Slow top[BUILD_COUNT][TOP_SLOWEST];
+    Sample slowest[TOP_SLOWEST];
+    int b, c, in, k, i, n_counted = 0, first = 1, have_insns = 0;
+    if (!samples || !counted || !insns) return 1;
+    memset(top, 0, sizeof(top));
+    for (b = 0; b < BUILD_COUNT; b++)
+        for (c = 0; c < CASE_COUNT; c++)
+            for (in = 0; in < IN_COUNT; in++) stats[b][c][in].max_insns = -1;
+
+    i = 0;
+    for (c = 0; c < CASE_COUNT; c++)
+        for (in = 0; in < IN_COUNT; in++)
+            for (k = 0; k < per_path; k++) {
+                make_sample(&samples[i], (uint8_t)c, (uint8_t)in);
+                if (k < insn_per_path) counted[n_counted++] = samples[i];
+                i++;
+            }
+
+    for (b = 0; b < BUILD_COUNT; b++) {
+        for (i = 0; i < n_samples; i++) {
+            const Sample* smp = &samples[i];
+            PathStats* ps = &stats[b][smp->case_id][smp->input];
+            int nonfinite = 0;
+            Slow s;
+            s.ticks = measure_ticks(&BUILDS[b], smp, &nonfinite);
+            s.insns = -1;
+            s.build = b;
+            s.smp = smp;
+            if (s.ticks > ps->max_ticks) ps->max_ticks = s.ticks;
+            ps->samples++;
+            ps->nonfinite += (uint32_t)nonfinite;
+            insert_slowest(top[b], s);
+        }
+#if HAVE_PTRACE
+        if (n_counted > 0 && count_instructions(&BUILDS[b], counted, n_counted, insns) == 0) {
+            have_insns = 1;
+            for (i = 0; i < n_counted; i++) {
+                PathStats* ps = &stats[b][counted[i].case_id][counted[i].input];
+                if (insns[i] > ps->max_insns) ps->max_insns = insns[i];
+            }
+        }
+        /* Slowest inputs by ticks, so the report shows their exact cost too. */
+        for (k = 0; k < TOP_SLOWEST && top[b][k].smp; k++) slowest[k] = *top[b][k].smp;
+        if (have_insns && count_instructions(&BUILDS[b], slowest, k, insns) == 0) {
+            for (i = 0; i < k; i++) top[b][i].insns = insns[i];
+        }
+#endif
+    }
+
+    printf("{\n  \"tick_unit\": \"%s\",\n  \"samples_per_path\": %d,\n"
+           "  \"insn_samples_per_path\": %d,\n  \"paths\": [",
+           TICK_UNIT, per_path, have_insns ? insn_per_path : 0);
+    for (b = 0; b < BUILD_COUNT; b++)
+        for (c = 0; c < CASE_COUNT; c++)
+            for (in = 0; in < IN_COUNT; in++) {
+                const PathStats* ps = &stats[b][c][in];
+                printf("%s\n    {\"build\": \"%s\", \"case\": \"%s\", \"input\": \"%s\", "
+                       "\"samples\": %u, \"max_ticks\": %llu, \"max_insns\": %ld, "
+                       "\"nonfinite\": %u}",
+                       first ? "" : ",", BUILDS[b].name, CASE_NAMES[c], INPUT_NAMES[in],
+                       ps->samples, (unsigned long long)ps->max_ticks, ps->max_insns,
+                       ps->nonfinite);
+                first = 0;
+            }
+    printf("\n  ],\n  \"slowest\": [");
+    first = 1;
+    for (b = 0; b < BUILD_COUNT; b++)
+        for (k = 0; k < TOP_SLOWEST && top[b][k].smp; k++) {
+            printf("%s\n    ", first ? "" : ",");
+            print_sample(&top[b][k]);
+            first = 0;
+        }
+    printf("\n  ]\n}\n");
+
+    free(samples);
+    free(counted);
+    free(insns);
+    return 0;
+}